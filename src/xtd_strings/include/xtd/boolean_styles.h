@@ -0,0 +1,44 @@
+/// @file
+/// @brief Contains xtd::boolean_styles enum class.
+#pragma once
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Determines the styles permitted in boolean string arguments that are passed to the xtd::parse and xtd::try_parse methods.
+  /// This enumeration has a flags attribute that allows a bitwise combination of its member values.
+  /// @remarks The "true" and "false" spellings are always accepted, case insensitively.
+  enum class boolean_styles {
+    /// @brief Indicates that only "true" or "false", case insensitively, can be present in the parsed string.
+    none = 0x0,
+    /// @brief Indicates that leading white-space characters can be present in the parsed string. Valid white-space characters have the Unicode values U+0009, U+000A, U+000B, U+000C, U+000D, and U+0020.
+    allow_leading_white = 0b1,
+    /// @brief Indicates that trailing white-space characters can be present in the parsed string. Valid white-space characters have the Unicode values U+0009, U+000A, U+000B, U+000C, U+000D, and U+0020.
+    allow_trailing_white = 0b10,
+    /// @brief Indicates that "1" and "0" are accepted as true and false.
+    allow_numeric = 0b100,
+    /// @brief Indicates that "yes" and "no", case insensitively, are accepted as true and false.
+    allow_yes_no = 0b1000,
+    /// @brief Indicates that "on" and "off", case insensitively, are accepted as true and false.
+    allow_on_off = 0b10000,
+    /// @brief Indicates that the allow_leading_white, allow_trailing_white, and allow_numeric styles are used. This is a composite boolean style and the default one.
+    boolean = allow_leading_white + allow_trailing_white + allow_numeric,
+    /// @brief Indicates that all styles are used. This is a composite boolean style.
+    any = allow_leading_white + allow_trailing_white + allow_numeric + allow_yes_no + allow_on_off,
+  };
+
+  /// @cond
+  inline xtd::boolean_styles& operator^=(xtd::boolean_styles& lhs, xtd::boolean_styles rhs) {lhs = static_cast<xtd::boolean_styles>(static_cast<int>(lhs) ^ static_cast<int>(rhs)); return lhs;}
+  inline xtd::boolean_styles& operator&=(xtd::boolean_styles& lhs, xtd::boolean_styles rhs) {lhs = static_cast<xtd::boolean_styles>(static_cast<int>(lhs) & static_cast<int>(rhs)); return lhs;}
+  inline xtd::boolean_styles& operator|=(xtd::boolean_styles& lhs, xtd::boolean_styles rhs) {lhs = static_cast<xtd::boolean_styles>(static_cast<int>(lhs) | static_cast<int>(rhs)); return lhs;}
+  inline xtd::boolean_styles& operator+=(xtd::boolean_styles& lhs, xtd::boolean_styles rhs) {lhs = static_cast<xtd::boolean_styles>(static_cast<int>(lhs) + static_cast<int>(rhs)); return lhs;}
+  inline xtd::boolean_styles& operator-=(xtd::boolean_styles& lhs, xtd::boolean_styles rhs) {lhs = static_cast<xtd::boolean_styles>(static_cast<int>(lhs) - static_cast<int>(rhs)); return lhs;}
+
+  inline xtd::boolean_styles operator^(xtd::boolean_styles lhs, xtd::boolean_styles rhs) {return static_cast<xtd::boolean_styles>(static_cast<int>(lhs) ^ static_cast<int>(rhs));}
+  inline xtd::boolean_styles operator&(xtd::boolean_styles lhs, xtd::boolean_styles rhs) {return static_cast<xtd::boolean_styles>(static_cast<int>(lhs) & static_cast<int>(rhs));}
+  inline xtd::boolean_styles operator|(xtd::boolean_styles lhs, xtd::boolean_styles rhs) {return static_cast<xtd::boolean_styles>(static_cast<int>(lhs) | static_cast<int>(rhs));}
+  inline xtd::boolean_styles operator+(xtd::boolean_styles lhs, xtd::boolean_styles rhs) {return static_cast<xtd::boolean_styles>(static_cast<int>(lhs) + static_cast<int>(rhs));}
+  inline xtd::boolean_styles operator-(xtd::boolean_styles lhs, xtd::boolean_styles rhs) {return static_cast<xtd::boolean_styles>(static_cast<int>(lhs) - static_cast<int>(rhs));}
+
+  inline xtd::boolean_styles operator~(xtd::boolean_styles lhs) {return static_cast<xtd::boolean_styles>(~static_cast<int>(lhs));}
+  /// @endcond
+}
@@ -0,0 +1,159 @@
+/// @file
+/// @brief Contains xtd::char_set class.
+#pragma once
+
+/// @cond
+#define __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include "internal/__shufti.h"
+
+/// @cond
+#undef __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Represents a precompiled set of characters used to scan strings for any of them, as xtd::strings::index_of_any, xtd::strings::split or xtd::strings::trim do.
+  /// @par Examples
+  /// @code
+  /// static const xtd::char_set<char> delimiters {' ', '\t', ',', ';', '='};
+  /// for (size_t index = delimiters.find_first(line); index != xtd::char_set<char>::npos; index = delimiters.find_first(line, index + 1))
+  ///   on_delimiter(index);
+  /// @endcode
+  /// @remarks Characters below U+0100 are stored in a 256-bit bitmap; other characters are kept in a sorted array.
+  /// @remarks For char, when SSSE3 is available, strings are scanned 16 bytes at a time with a nibble lookup (shufti). Build the set once and reuse it: construction costs more than a single scan of a short string.
+  template<typename char_t>
+  class char_set {
+  public:
+    /// @brief Represents the value returned when no character is found.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /// @brief Initializes a new empty instance of the xtd::char_set class.
+    char_set() noexcept = default;
+
+    /// @brief Initializes a new instance of the xtd::char_set class with the specified characters.
+    /// @param values The characters of the set.
+    char_set(std::initializer_list<char_t> values) {add(values.begin(), values.end());}
+
+    /// @brief Initializes a new instance of the xtd::char_set class with the specified characters.
+    /// @param values The characters of the set.
+    explicit char_set(const std::vector<char_t>& values) {add(values.begin(), values.end());}
+
+    /// @brief Initializes a new instance of the xtd::char_set class with the specified characters.
+    /// @param values The characters of the set.
+    explicit char_set(std::basic_string_view<char_t> values) {add(values.begin(), values.end());}
+
+    /// @brief Gets the set of the default white-space characters U+0009, U+000A, U+000B, U+000C, U+000D, and U+0020.
+    /// @return The white-space characters set.
+    static const char_set& white_spaces() {
+      static const char_set white_spaces {9, 10, 11, 12, 13, 32};
+      return white_spaces;
+    }
+
+    /// @brief Determines whether the specified character belongs to this set.
+    /// @param value The character to locate.
+    /// @return true if value belongs to this set; otherwise, false.
+    bool contains(char_t value) const noexcept {
+      auto code = static_cast<typename std::make_unsigned<char_t>::type>(value);
+      if (code < 256) return (bitmap_[code >> 6] >> (code & 63)) & 1;
+      return std::binary_search(wide_values_.begin(), wide_values_.end(), value);
+    }
+
+    /// @brief Gets a value indicating whether this set is empty.
+    /// @return true if this set contains no character; otherwise, false.
+    bool empty() const noexcept {return (bitmap_[0] | bitmap_[1] | bitmap_[2] | bitmap_[3]) == 0 && wide_values_.empty();}
+
+    /// @brief Reports the index of the first character of the specified string that belongs to this set.
+    /// @param str The string to scan.
+    /// @param start_index The search starting position.
+    /// @return The index of the first character found; or xtd::char_set::npos if there is none.
+    size_t find_first(std::basic_string_view<char_t> str, size_t start_index = 0) const noexcept {
+      if (start_index >= str.size()) return npos;
+      if constexpr (sizeof(char_t) == 1) {
+        size_t length = str.size() - start_index;
+        size_t index = __shufti_find_first(reinterpret_cast<const unsigned char*>(str.data() + start_index), length, low_table_, high_table_, exact_, [this](unsigned char c) {return contains(static_cast<char_t>(c));});
+        return index == length ? npos : start_index + index;
+      } else {
+        for (size_t index = start_index; index < str.size(); ++index)
+          if (contains(str[index])) return index;
+        return npos;
+      }
+    }
+
+    /// @brief Reports the index of the last character of the specified string that belongs to this set.
+    /// @param str The string to scan.
+    /// @return The index of the last character found; or xtd::char_set::npos if there is none.
+    size_t find_last(std::basic_string_view<char_t> str) const noexcept {
+      if constexpr (sizeof(char_t) == 1) {
+        size_t index = __shufti_find_last(reinterpret_cast<const unsigned char*>(str.data()), str.size(), low_table_, high_table_, exact_, [this](unsigned char c) {return contains(static_cast<char_t>(c));});
+        return index == str.size() ? npos : index;
+      } else {
+        for (size_t index = str.size(); index > 0; --index)
+          if (contains(str[index - 1])) return index - 1;
+        return npos;
+      }
+    }
+
+    /// @brief Reports the index of the first character of the specified string that does not belong to this set.
+    /// @param str The string to scan.
+    /// @param start_index The search starting position.
+    /// @return The index of the first character found; or xtd::char_set::npos if there is none.
+    size_t find_first_not(std::basic_string_view<char_t> str, size_t start_index = 0) const noexcept {
+      for (size_t index = start_index; index < str.size(); ++index)
+        if (!contains(str[index])) return index;
+      return npos;
+    }
+
+    /// @brief Reports the index of the last character of the specified string that does not belong to this set.
+    /// @param str The string to scan.
+    /// @return The index of the last character found; or xtd::char_set::npos if there is none.
+    size_t find_last_not(std::basic_string_view<char_t> str) const noexcept {
+      for (size_t index = str.size(); index > 0; --index)
+        if (!contains(str[index - 1])) return index - 1;
+      return npos;
+    }
+
+  private:
+    template<typename iterator_t>
+    void add(iterator_t first, iterator_t last) {
+      for (; first != last; ++first) {
+        auto code = static_cast<typename std::make_unsigned<char_t>::type>(*first);
+        if (code < 256) bitmap_[code >> 6] |= uint64_t(1) << (code & 63);
+        else wide_values_.push_back(*first);
+      }
+      std::sort(wide_values_.begin(), wide_values_.end());
+      wide_values_.erase(std::unique(wide_values_.begin(), wide_values_.end()), wide_values_.end());
+      if constexpr (sizeof(char_t) == 1) compile_shufti_tables();
+    }
+
+    // Gives each distinct high nibble its own bucket; past eight high nibbles buckets are shared and the scan confirms candidates with the bitmap.
+    void compile_shufti_tables() noexcept {
+      size_t buckets = 0;
+      for (unsigned high = 0; high < 16; ++high) {
+        unsigned low_nibbles = 0;
+        for (unsigned low = 0; low < 16; ++low)
+          if (contains(static_cast<char_t>(high << 4 | low))) low_nibbles |= 1u << low;
+        if (low_nibbles == 0) continue;
+        uint8_t bucket = static_cast<uint8_t>(1u << (buckets++ % 8));
+        high_table_[high] |= bucket;
+        for (unsigned low = 0; low < 16; ++low)
+          if ((low_nibbles >> low) & 1) low_table_[low] |= bucket;
+      }
+      exact_ = buckets <= 8;
+    }
+
+    uint64_t bitmap_[4] {};
+    std::vector<char_t> wide_values_;
+    uint8_t low_table_[16] {};
+    uint8_t high_table_[16] {};
+    bool exact_ = true;
+  };
+}
@@ -0,0 +1,170 @@
+/// @file
+/// @brief Contains xtd::fixed_string class.
+#pragma once
+
+#include "fixed_string_overflow.h"
+
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Represents a string of at most capacity_v characters, stored inline with its length: it never allocates and is trivially copyable, so that it can live on the stack.
+  /// @par Examples
+  /// @code
+  /// xtd::fixed_string<char, 64> line;
+  /// xtd::strings::format_to(line, "{0} {1,8}\n", id, count);
+  /// write(fd, line.data(), line.size());
+  /// @endcode
+  /// @remarks xtd::strings::format_to and xtd::to_string append to a fixed string; the caller chooses with xtd::fixed_string_overflow whether a text longer than the remaining capacity is truncated or throws.
+  /// @remarks The characters are always followed by a null character.
+  template<typename char_t, size_t capacity_v>
+  class fixed_string {
+  public:
+    /// @cond
+    using value_type = char_t;
+    using size_type = size_t;
+    using view_type = std::basic_string_view<char_t>;
+    using iterator = char_t*;
+    using const_iterator = const char_t*;
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    /// @endcond
+
+    /// @brief Initializes a new empty instance of the xtd::fixed_string class.
+    fixed_string() noexcept {data_[0] = char_t();}
+
+    /// @brief Initializes a new instance of the xtd::fixed_string class with the specified characters.
+    /// @param str The characters of the string.
+    /// @param overflow What happens when str is longer than capacity_v.
+    /// @exception std::length_error str is longer than capacity_v and overflow is xtd::fixed_string_overflow::error.
+    explicit fixed_string(view_type str, xtd::fixed_string_overflow overflow = xtd::fixed_string_overflow::error) : fixed_string() {append(str, overflow);}
+    /// @cond
+    explicit fixed_string(const char_t* str, xtd::fixed_string_overflow overflow = xtd::fixed_string_overflow::error) : fixed_string(view_type(str), overflow) {}
+    /// @endcond
+
+    /// @brief Gets the maximum number of characters of this string.
+    /// @return The capacity.
+    static constexpr size_t capacity() noexcept {return capacity_v;}
+
+    /// @brief Gets the number of characters of this string.
+    /// @return The number of characters.
+    size_t size() const noexcept {return length_;}
+    /// @cond
+    size_t length() const noexcept {return length_;}
+    /// @endcond
+
+    /// @brief Gets a value indicating whether this string is empty.
+    /// @return true if this string is empty; otherwise, false.
+    bool empty() const noexcept {return length_ == 0;}
+
+    /// @brief Gets a value indicating whether this string has no remaining capacity.
+    /// @return true if the size of this string is its capacity; otherwise, false.
+    bool full() const noexcept {return length_ == capacity_v;}
+
+    /// @brief Gets the characters of this string, terminated by a null character.
+    /// @return The characters of this string.
+    const char_t* c_str() const noexcept {return data_;}
+    /// @cond
+    const char_t* data() const noexcept {return data_;}
+    char_t* data() noexcept {return data_;}
+    const_iterator begin() const noexcept {return data_;}
+    const_iterator end() const noexcept {return data_ + length_;}
+    iterator begin() noexcept {return data_;}
+    iterator end() noexcept {return data_ + length_;}
+    const char_t& operator[](size_t index) const noexcept {return data_[index];}
+    char_t& operator[](size_t index) noexcept {return data_[index];}
+    /// @endcond
+
+    /// @brief Gets the character at the specified index.
+    /// @param index The index of the character.
+    /// @return The character at index.
+    /// @exception std::out_of_range index is greater than or equal to the size of this string.
+    const char_t& at(size_t index) const {
+      if (index >= length_) throw std::out_of_range("index out of range");
+      return data_[index];
+    }
+
+    /// @brief Removes all the characters of this string.
+    void clear() noexcept {resize_unchecked(0);}
+
+    /// @brief Sets the number of characters of this string; new characters are set to c.
+    /// @param count The new number of characters.
+    /// @param c The value of the new characters.
+    /// @exception std::length_error count is greater than capacity_v.
+    void resize(size_t count, char_t c = char_t()) {
+      if (count > capacity_v) throw std::length_error("fixed_string capacity exceeded");
+      if (count > length_) std::char_traits<char_t>::assign(data_ + length_, count - length_, c);
+      resize_unchecked(count);
+    }
+
+    /// @brief Appends the specified characters to this string.
+    /// @param str The characters to append.
+    /// @return This string.
+    /// @exception std::length_error str is longer than the remaining capacity; this string is left unchanged.
+    fixed_string& append(view_type str) {
+      append(str, xtd::fixed_string_overflow::error);
+      return *this;
+    }
+
+    /// @brief Appends the specified characters to this string; what happens when they do not fit is specified by overflow.
+    /// @param str The characters to append.
+    /// @param overflow What happens when str is longer than the remaining capacity.
+    /// @return true if all the characters are appended; false if they are truncated.
+    /// @exception std::length_error str is longer than the remaining capacity and overflow is xtd::fixed_string_overflow::error; this string is left unchanged.
+    bool append(view_type str, xtd::fixed_string_overflow overflow) {
+      size_t count = fit(str.size(), overflow);
+      std::char_traits<char_t>::copy(data_ + length_, str.data(), count);
+      resize_unchecked(length_ + count);
+      return count == str.size();
+    }
+
+    /// @brief Appends count copies of the specified character to this string; what happens when they do not fit is specified by overflow.
+    /// @param count The number of characters to append.
+    /// @param c The character to append.
+    /// @param overflow What happens when count is greater than the remaining capacity.
+    /// @return true if all the characters are appended; false if they are truncated.
+    /// @exception std::length_error count is greater than the remaining capacity and overflow is xtd::fixed_string_overflow::error; this string is left unchanged.
+    bool append(size_t count, char_t c, xtd::fixed_string_overflow overflow = xtd::fixed_string_overflow::error) {
+      size_t fitting = fit(count, overflow);
+      std::char_traits<char_t>::assign(data_ + length_, fitting, c);
+      resize_unchecked(length_ + fitting);
+      return fitting == count;
+    }
+
+    /// @brief Appends the specified character to this string.
+    /// @param c The character to append.
+    /// @exception std::length_error This string is full.
+    void push_back(char_t c) {append(1, c);}
+
+    /// @cond
+    operator view_type() const noexcept {return view_type(data_, length_);}
+    explicit operator std::basic_string<char_t>() const {return std::basic_string<char_t>(data_, length_);}
+
+    friend bool operator==(const fixed_string& a, const fixed_string& b) noexcept {return view_type(a) == view_type(b);}
+    friend bool operator==(const fixed_string& a, view_type b) noexcept {return view_type(a) == b;}
+    friend bool operator==(view_type a, const fixed_string& b) noexcept {return a == view_type(b);}
+    friend bool operator!=(const fixed_string& a, const fixed_string& b) noexcept {return !(a == b);}
+    friend bool operator!=(const fixed_string& a, view_type b) noexcept {return !(a == b);}
+    friend bool operator!=(view_type a, const fixed_string& b) noexcept {return !(a == b);}
+    friend std::basic_ostream<char_t>& operator<<(std::basic_ostream<char_t>& os, const fixed_string& str) {return os << view_type(str);}
+    /// @endcond
+
+  private:
+    size_t fit(size_t count, xtd::fixed_string_overflow overflow) const {
+      if (count <= capacity_v - length_) return count;
+      if (overflow == xtd::fixed_string_overflow::error) throw std::length_error("fixed_string capacity exceeded");
+      return capacity_v - length_;
+    }
+
+    void resize_unchecked(size_t count) noexcept {
+      length_ = count;
+      data_[length_] = char_t();
+    }
+
+    size_t length_ = 0;
+    char_t data_[capacity_v + 1];
+  };
+}
@@ -0,0 +1,25 @@
+/// @file
+/// @brief Contains xtd::fixed_string_overflow enum class.
+#pragma once
+
+#include <ostream>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Specifies what happens when a text written to an xtd::fixed_string does not fit in its remaining capacity.
+  /// @see xtd::fixed_string
+  enum class fixed_string_overflow {
+    /// @brief A std::length_error is thrown and the string is left unchanged.
+    error,
+    /// @brief The text is truncated to the remaining capacity, and the method returns false.
+    truncate
+  };
+
+  inline std::ostream& operator<<(std::ostream& os, xtd::fixed_string_overflow overflow) {
+    switch (overflow) {
+      case xtd::fixed_string_overflow::error: os << "error"; break;
+      case xtd::fixed_string_overflow::truncate: os << "truncate"; break;
+    }
+    return os;
+  }
+}
@@ -0,0 +1,81 @@
+/// @file
+/// @brief Contains __concat_size_hint and __concat_append methods.
+#pragma once
+
+/// @cond
+#ifndef __XTD_STRINGS_INCLUDE__
+#error "Do not include this file yourself, use only #include <xtd/xtd.strings>"
+#endif
+/// @endcond
+
+#include <charconv>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/// @cond
+template<typename value_t>
+struct __concat_string_char {using type = void;};
+template<typename char_t, typename traits_t, typename allocator_t>
+struct __concat_string_char<std::basic_string<char_t, traits_t, allocator_t>> {using type = char_t;};
+template<typename char_t, typename traits_t>
+struct __concat_string_char<std::basic_string_view<char_t, traits_t>> {using type = char_t;};
+template<>
+struct __concat_string_char<const char*> {using type = char;};
+template<>
+struct __concat_string_char<const wchar_t*> {using type = wchar_t;};
+template<>
+struct __concat_string_char<const char16_t*> {using type = char16_t;};
+template<>
+struct __concat_string_char<const char32_t*> {using type = char32_t;};
+template<typename char_t>
+struct __concat_string_char<char_t*> : __concat_string_char<const char_t*> {};
+
+// The character type of a concatenation: char_t when it is specified, otherwise the character type of the first string argument, otherwise char.
+template<typename char_t, typename ...args_t>
+struct __concat_char {using type = char_t;};
+template<>
+struct __concat_char<void> {using type = char;};
+template<typename arg_t, typename ...args_t>
+struct __concat_char<void, arg_t, args_t...> {
+  using string_char_t = typename __concat_string_char<typename std::decay<arg_t>::type>::type;
+  using type = typename std::conditional<std::is_void<string_char_t>::value, typename __concat_char<void, args_t...>::type, string_char_t>::type;
+};
+
+template<typename char_t, typename value_t>
+struct __concat_is_string : std::is_convertible<const value_t&, std::basic_string_view<char_t>> {};
+
+template<typename value_t>
+struct __concat_is_number : std::integral_constant<bool, std::is_arithmetic<value_t>::value && !std::is_same<value_t, bool>::value && !std::is_same<value_t, char>::value && !std::is_same<value_t, signed char>::value && !std::is_same<value_t, unsigned char>::value && !std::is_same<value_t, wchar_t>::value && !std::is_same<value_t, char16_t>::value && !std::is_same<value_t, char32_t>::value> {};
+
+// Returns the length of value once appended, or an upper bound for numbers; other objects are not measured.
+template<typename char_t, typename value_t>
+inline size_t __concat_size_hint(const value_t& value) noexcept {
+  if constexpr (__concat_is_string<char_t, value_t>::value) return std::basic_string_view<char_t>(value).size();
+  else if constexpr (std::is_same<value_t, char_t>::value || std::is_same<value_t, bool>::value) return 1;
+  else if constexpr (__concat_is_number<value_t>::value) return 24;
+  else return 0;
+}
+
+// Appends value to result, a std::basic_string or any type with append and push_back, as std::basic_ostream << value would in the classic locale: strings and numbers are copied or converted in place, other objects are streamed.
+template<typename result_t, typename value_t>
+inline void __concat_append(result_t& result, const value_t& value) {
+  using char_t = typename result_t::value_type;
+  if constexpr (__concat_is_string<char_t, value_t>::value) result.append(std::basic_string_view<char_t>(value));
+  else if constexpr (std::is_same<value_t, char_t>::value) result.push_back(value);
+  else if constexpr (std::is_same<value_t, bool>::value) result.push_back(static_cast<char_t>(value ? '1' : '0'));
+  else if constexpr (__concat_is_number<value_t>::value) {
+    char buffer[64];
+    const char* last = buffer;
+    if constexpr (std::is_integral<value_t>::value) last = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+    else last = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 6).ptr;
+    for (const char* c = buffer; c != last; ++c)
+      result.push_back(static_cast<char_t>(*c));
+  } else {
+    std::basic_stringstream<char_t> ss;
+    ss << value;
+    result.append(ss.str());
+  }
+}
+/// @endcond
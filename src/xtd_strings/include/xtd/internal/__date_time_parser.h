@@ -0,0 +1,295 @@
+/// @file
+/// @brief Contains __date_time_parser method.
+#pragma once
+
+/// @cond
+#ifndef __XTD_STRINGS_INCLUDE__
+#error "Do not include this file yourself, use only #include <xtd/xtd.strings>"
+#endif
+/// @endcond
+
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @cond
+enum class __date_time_token_kind {literal, year, month, day, hour, minute, second, weekday_name, month_name, fraction, offset};
+
+struct __date_time_token {
+  __date_time_token_kind kind = __date_time_token_kind::literal;
+  char literal = 0;
+};
+
+struct __date_time_fields {
+  int year = 1970;
+  int month = 1;
+  int day = 1;
+  int hour = 0;
+  int minute = 0;
+  int second = 0;
+  long nanoseconds = 0;
+  bool has_offset = false;
+  int offset_seconds = 0;
+  int weekday = -1;
+};
+
+using __date_time_pattern = std::vector<__date_time_token>;
+
+// Compiles a pattern description where 'y', 'M', 'd', 'h', 'm', 's' are numeric fields, 'W' is a weekday name, 'B' is a month name, 'f' is an optional fraction of second, 'z' is an optional offset and any other character is a literal.
+inline __date_time_pattern __date_time_compile_pattern(const char* description) {
+  __date_time_pattern pattern;
+  for (const char* c = description; *c != 0; ++c) {
+    switch (*c) {
+      case 'y': pattern.push_back({__date_time_token_kind::year}); break;
+      case 'M': pattern.push_back({__date_time_token_kind::month}); break;
+      case 'd': pattern.push_back({__date_time_token_kind::day}); break;
+      case 'h': pattern.push_back({__date_time_token_kind::hour}); break;
+      case 'm': pattern.push_back({__date_time_token_kind::minute}); break;
+      case 's': pattern.push_back({__date_time_token_kind::second}); break;
+      case 'W': pattern.push_back({__date_time_token_kind::weekday_name}); break;
+      case 'B': pattern.push_back({__date_time_token_kind::month_name}); break;
+      case 'f': pattern.push_back({__date_time_token_kind::fraction}); break;
+      case 'z': pattern.push_back({__date_time_token_kind::offset}); break;
+      default: pattern.push_back({__date_time_token_kind::literal, *c}); break;
+    }
+  }
+  return pattern;
+}
+
+// Patterns are the inverse of __date_time_formater; they are compiled once and shared by all parse calls.
+inline const __date_time_pattern& __date_time_get_pattern(char fmt) {
+  static const std::array<__date_time_pattern, 128> patterns = [] {
+    std::array<__date_time_pattern, 128> result;
+    result['d'] = result['D'] = __date_time_compile_pattern("M/d/y");
+    result['n'] = __date_time_compile_pattern("W, d B y");
+    result['N'] = result['U'] = __date_time_compile_pattern("W, d B y h:m:sfz");
+    result['o'] = result['O'] = __date_time_compile_pattern("d B y");
+    result['s'] = __date_time_compile_pattern("y-M-dTh:m:sfz");
+    result['t'] = result['T'] = __date_time_compile_pattern("h:m:sf");
+    result['u'] = __date_time_compile_pattern("y-M-d h:m:sfz");
+    result['v'] = result['V'] = __date_time_compile_pattern("h:m");
+    return result;
+  }();
+  // char may be unsigned: non-ASCII letters are rejected from their unsigned value.
+  size_t index = static_cast<unsigned char>(fmt);
+  if (index >= patterns.size() || patterns[index].empty()) throw std::invalid_argument("Invalid format");
+  return patterns[index];
+}
+
+inline const char* const* __date_time_month_names() noexcept {
+  static const char* const names[] = {"january", "february", "march", "april", "may", "june", "july", "august", "september", "october", "november", "december"};
+  return names;
+}
+
+inline const char* const* __date_time_weekday_names() noexcept {
+  static const char* const names[] = {"sunday", "monday", "tuesday", "wednesday", "thursday", "friday", "saturday"};
+  return names;
+}
+
+template<typename char_t>
+inline bool __date_time_is_digit(char_t c) noexcept {return c >= char_t('0') && c <= char_t('9');}
+
+template<typename char_t>
+inline bool __date_time_read_number(std::basic_string_view<char_t>& str, size_t max_digits, int& value) noexcept {
+  size_t count = 0;
+  value = 0;
+  while (count < str.size() && count < max_digits && __date_time_is_digit(str[count]))
+    value = value * 10 + static_cast<int>(str[count++] - char_t('0'));
+  str.remove_prefix(count);
+  return count != 0;
+}
+
+// Matches the full or the three letters abbreviated English name, case insensitively, and returns its index or -1.
+template<typename char_t>
+inline int __date_time_read_name(std::basic_string_view<char_t>& str, const char* const* names, int count) noexcept {
+  for (int index = 0; index < count; ++index) {
+    size_t length = 0;
+    for (; names[index][length] != 0 && length < str.size(); ++length) {
+      char_t c = str[length];
+      if (c >= char_t('A') && c <= char_t('Z')) c = static_cast<char_t>(c - char_t('A') + char_t('a'));
+      if (c != static_cast<char_t>(names[index][length])) break;
+    }
+    if (names[index][length] == 0 || length == 3) {
+      str.remove_prefix(length);
+      return index;
+    }
+  }
+  return -1;
+}
+
+template<typename char_t>
+inline void __date_time_read_fraction(std::basic_string_view<char_t>& str, __date_time_fields& fields) noexcept {
+  if (str.size() < 2 || (str[0] != char_t('.') && str[0] != char_t(',')) || !__date_time_is_digit(str[1])) return;
+  str.remove_prefix(1);
+  long scale = 100000000;
+  while (!str.empty() && __date_time_is_digit(str[0])) {
+    fields.nanoseconds += static_cast<long>(str[0] - char_t('0')) * scale;
+    scale /= 10;
+    str.remove_prefix(1);
+  }
+}
+
+template<typename char_t>
+inline bool __date_time_read_offset(std::basic_string_view<char_t>& str, __date_time_fields& fields) noexcept {
+  std::basic_string_view<char_t> offset = str;
+  while (!offset.empty() && offset[0] == char_t(' ')) offset.remove_prefix(1);
+  if (offset.empty()) return true;
+  if (offset[0] == char_t('Z') || offset[0] == char_t('z')) {
+    offset.remove_prefix(1);
+    fields.has_offset = true;
+  } else if (offset.size() >= 3 && ((offset[0] == char_t('G') && offset[1] == char_t('M') && offset[2] == char_t('T')) || (offset[0] == char_t('U') && offset[1] == char_t('T') && offset[2] == char_t('C')))) {
+    offset.remove_prefix(3);
+    fields.has_offset = true;
+  } else if (offset[0] == char_t('+') || offset[0] == char_t('-')) {
+    int sign = offset[0] == char_t('-') ? -1 : 1;
+    offset.remove_prefix(1);
+    int hours = 0, minutes = 0;
+    if (!__date_time_read_number(offset, 2, hours)) return false;
+    if (!offset.empty() && offset[0] == char_t(':')) offset.remove_prefix(1);
+    if (!offset.empty() && !__date_time_read_number(offset, 2, minutes)) return false;
+    if (hours > 23 || minutes > 59) return false;
+    fields.has_offset = true;
+    fields.offset_seconds = sign * (hours * 3600 + minutes * 60);
+  } else return false;
+  str = offset;
+  return true;
+}
+
+template<typename char_t>
+inline void __date_time_run_pattern(std::basic_string_view<char_t> str, const __date_time_pattern& pattern, __date_time_fields& fields) {
+  for (const auto& token : pattern) {
+    bool succeeded = true;
+    switch (token.kind) {
+      case __date_time_token_kind::literal: succeeded = !str.empty() && str[0] == static_cast<char_t>(token.literal); if (succeeded) str.remove_prefix(1); break;
+      case __date_time_token_kind::year: succeeded = __date_time_read_number(str, 4, fields.year); break;
+      case __date_time_token_kind::month: succeeded = __date_time_read_number(str, 2, fields.month); break;
+      case __date_time_token_kind::day: succeeded = __date_time_read_number(str, 2, fields.day); break;
+      case __date_time_token_kind::hour: succeeded = __date_time_read_number(str, 2, fields.hour); break;
+      case __date_time_token_kind::minute: succeeded = __date_time_read_number(str, 2, fields.minute); break;
+      case __date_time_token_kind::second: succeeded = __date_time_read_number(str, 2, fields.second); break;
+      case __date_time_token_kind::weekday_name: fields.weekday = __date_time_read_name(str, __date_time_weekday_names(), 7); succeeded = fields.weekday != -1; break;
+      case __date_time_token_kind::month_name: fields.month = __date_time_read_name(str, __date_time_month_names(), 12) + 1; succeeded = fields.month != 0; break;
+      case __date_time_token_kind::fraction: __date_time_read_fraction(str, fields); break;
+      case __date_time_token_kind::offset: succeeded = __date_time_read_offset(str, fields); break;
+    }
+    if (!succeeded) throw std::invalid_argument("Invalid date time format");
+  }
+  if (!str.empty()) throw std::invalid_argument("Invalid date time format");
+}
+
+// Fixed layout ISO-8601 "yyyy-MM-ddTHH:mm:ss[.fffffffff][Z|+hh:mm]" scanner; returns false to fall back to the generic pattern.
+template<typename char_t>
+inline bool __date_time_parse_iso_8601(std::basic_string_view<char_t> str, __date_time_fields& fields) noexcept {
+  if (str.size() < 19) return false;
+  static constexpr size_t digits[] = {0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, 17, 18};
+  for (auto index : digits)
+    if (!__date_time_is_digit(str[index])) return false;
+  if (str[4] != char_t('-') || str[7] != char_t('-') || (str[10] != char_t('T') && str[10] != char_t('t') && str[10] != char_t(' ')) || str[13] != char_t(':') || str[16] != char_t(':')) return false;
+  auto two_digits = [&](size_t index) {return static_cast<int>(str[index] - char_t('0')) * 10 + static_cast<int>(str[index + 1] - char_t('0'));};
+  fields.year = two_digits(0) * 100 + two_digits(2);
+  fields.month = two_digits(5);
+  fields.day = two_digits(8);
+  fields.hour = two_digits(11);
+  fields.minute = two_digits(14);
+  fields.second = two_digits(17);
+  str.remove_prefix(19);
+  __date_time_read_fraction(str, fields);
+  return __date_time_read_offset(str, fields) && str.empty();
+}
+
+// Days since 1970-01-01 of the proleptic Gregorian date (H. Hinnant's days_from_civil).
+inline long long __date_time_days_from_civil(long long year, unsigned month, unsigned day) noexcept {
+  year -= month <= 2;
+  long long era = (year >= 0 ? year : year - 399) / 400;
+  unsigned year_of_era = static_cast<unsigned>(year - era * 400);
+  unsigned day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  unsigned day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + static_cast<long long>(day_of_era) - 719468;
+}
+
+// Day of the week, from 0 (Sunday) to 6, of the date of fields.
+inline int __date_time_weekday(const __date_time_fields& fields) noexcept {
+  long long days = __date_time_days_from_civil(fields.year, static_cast<unsigned>(fields.month), static_cast<unsigned>(fields.day));
+  return static_cast<int>(days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6);
+}
+
+inline void __date_time_check_fields(const __date_time_fields& fields) {
+  static constexpr int days_in_month[] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (fields.month < 1 || fields.month > 12) throw std::out_of_range("Month out of range");
+  bool leap_year = (fields.year % 4 == 0 && fields.year % 100 != 0) || fields.year % 400 == 0;
+  if (fields.day < 1 || fields.day > days_in_month[fields.month - 1] || (fields.month == 2 && fields.day == 29 && !leap_year)) throw std::out_of_range("Day out of range");
+  if (fields.hour > 23 || fields.minute > 59 || fields.second > 60) throw std::out_of_range("Time out of range");
+  if (fields.weekday != -1 && fields.weekday != __date_time_weekday(fields)) throw std::invalid_argument("Day of week does not match the date");
+}
+
+inline std::tm __date_time_fields_to_tm(const __date_time_fields& fields) noexcept {
+  std::tm result {};
+  result.tm_year = fields.year - 1900;
+  result.tm_mon = fields.month - 1;
+  result.tm_mday = fields.day;
+  result.tm_hour = fields.hour;
+  result.tm_min = fields.minute;
+  result.tm_sec = fields.second;
+  result.tm_wday = __date_time_weekday(fields);
+  result.tm_yday = static_cast<int>(__date_time_days_from_civil(fields.year, static_cast<unsigned>(fields.month), static_cast<unsigned>(fields.day)) - __date_time_days_from_civil(fields.year, 1, 1));
+  result.tm_isdst = -1;
+  return result;
+}
+
+// Letters without fixed layout ('f', 'F', 'g', 'G' and empty) are locale dependent; they are parsed with std::get_time as the formater uses std::put_time.
+template<typename char_t>
+inline void __date_time_parse_locale(std::basic_string_view<char_t> str, char fmt, __date_time_fields& fields) {
+  if constexpr (std::is_same<char_t, char>::value || std::is_same<char_t, wchar_t>::value) {
+    std::basic_istringstream<char_t> stream {std::basic_string<char_t>(str)};
+    stream.imbue(std::locale());
+    std::tm value {};
+    stream >> std::get_time(&value, fmt == 'f' || fmt == 'g' ? std::basic_string<char_t> {'%', 'E', 'c'}.c_str() : std::basic_string<char_t> {'%', 'c'}.c_str());
+    if (stream.fail()) throw std::invalid_argument("Invalid date time format");
+    fields.year = value.tm_year + 1900;
+    fields.month = value.tm_mon + 1;
+    fields.day = value.tm_mday;
+    fields.hour = value.tm_hour;
+    fields.minute = value.tm_min;
+    fields.second = value.tm_sec;
+  } else throw std::invalid_argument("Invalid format");
+}
+
+template<typename char_t>
+inline __date_time_fields __date_time_parser(std::basic_string_view<char_t> str, std::basic_string_view<char_t> fmt) {
+  if (fmt.size() > 1) throw std::invalid_argument("Invalid format");
+  char letter = fmt.empty() ? 'G' : static_cast<char>(fmt[0]);
+  if (!fmt.empty() && static_cast<char_t>(letter) != fmt[0]) throw std::invalid_argument("Invalid format");
+
+  __date_time_fields fields;
+  if (letter == 'f' || letter == 'F' || letter == 'g' || letter == 'G') __date_time_parse_locale(str, letter, fields);
+  else if ((letter != 's' && letter != 'u') || !__date_time_parse_iso_8601(str, fields)) {
+    fields = __date_time_fields {};
+    __date_time_run_pattern(str, __date_time_get_pattern(letter), fields);
+  }
+  __date_time_check_fields(fields);
+  return fields;
+}
+
+template<typename char_t>
+inline std::tm __date_time_parse_tm(std::basic_string_view<char_t> str, std::basic_string_view<char_t> fmt) {
+  return __date_time_fields_to_tm(__date_time_parser(str, fmt));
+}
+
+template<typename char_t>
+inline std::chrono::system_clock::time_point __date_time_parse_time_point(std::basic_string_view<char_t> str, std::basic_string_view<char_t> fmt) {
+  __date_time_fields fields = __date_time_parser(str, fmt);
+  std::time_t seconds = 0;
+  if (fields.has_offset) seconds = static_cast<std::time_t>(__date_time_days_from_civil(fields.year, static_cast<unsigned>(fields.month), static_cast<unsigned>(fields.day)) * 86400 + fields.hour * 3600 + fields.minute * 60 + fields.second - fields.offset_seconds);
+  else {
+    std::tm value = __date_time_fields_to_tm(fields);
+    seconds = std::mktime(&value);
+  }
+  return std::chrono::system_clock::from_time_t(seconds) + std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(fields.nanoseconds));
+}
+/// @endcond
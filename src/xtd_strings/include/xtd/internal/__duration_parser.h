@@ -0,0 +1,104 @@
+/// @file
+/// @brief Contains __duration_parser method.
+#pragma once
+
+/// @cond
+#ifndef __XTD_STRINGS_INCLUDE__
+#error "Do not include this file yourself, use only #include <xtd/xtd.strings>"
+#endif
+/// @endcond
+
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+/// @cond
+template<typename value_t>
+struct __is_duration : std::false_type {};
+
+template<typename type_t, typename period_t>
+struct __is_duration<std::chrono::duration<type_t, period_t>> : std::true_type {};
+
+template<typename char_t>
+inline bool __duration_read_number(std::basic_string_view<char_t> str, size_t& index, size_t min_digits, size_t max_digits, long long& value) noexcept {
+  size_t count = 0;
+  value = 0;
+  while (index < str.size() && count < max_digits && str[index] >= char_t('0') && str[index] <= char_t('9')) {
+    value = value * 10 + static_cast<long long>(str[index++] - char_t('0'));
+    ++count;
+  }
+  return count >= min_digits && count != 0;
+}
+
+template<typename char_t>
+inline bool __duration_read_separator(std::basic_string_view<char_t> str, size_t& index, char separator) noexcept {
+  if (index == str.size() || str[index] != static_cast<char_t>(separator)) return false;
+  ++index;
+  return true;
+}
+
+// Single pass scanner for the layouts written by __duration_formater: "[-][d.]hh:mm:ss[:nnnnnnnnn]" for 'c' and 'G', "[-][d.]h:mm:ss[:nnnnnnnnn]" for 'g' and "[-]d:hh:mm:ss:nnnnnnnnn" for 'f' and 'F'.
+template<typename char_t>
+inline bool __duration_try_parse(std::basic_string_view<char_t> str, char fmt, std::chrono::nanoseconds& value) noexcept {
+  if (fmt != 'c' && fmt != 'f' && fmt != 'F' && fmt != 'g' && fmt != 'G') return false;
+
+  size_t index = 0;
+  bool negative = __duration_read_separator(str, index, '-');
+  long long days = 0, hours = 0, minutes = 0, seconds = 0, nanoseconds = 0;
+  bool day_first = fmt == 'f' || fmt == 'F';
+  size_t hour_digits = fmt == 'c' || fmt == 'G' || fmt == 'F' ? 2 : 1;
+
+  if (day_first) {
+    if (!__duration_read_number(str, index, 1, 8, days) || !__duration_read_separator(str, index, ':') || !__duration_read_number(str, index, 1, 2, hours)) return false;
+  } else {
+    long long first = 0;
+    size_t start = index;
+    if (!__duration_read_number(str, index, 1, 8, first)) return false;
+    if (__duration_read_separator(str, index, '.')) {
+      days = first;
+      if (!__duration_read_number(str, index, hour_digits, 2, hours)) return false;
+    } else {
+      if (index - start < hour_digits || index - start > 2) return false;
+      hours = first;
+    }
+  }
+
+  if (!__duration_read_separator(str, index, ':') || !__duration_read_number(str, index, 2, 2, minutes) || !__duration_read_separator(str, index, ':') || !__duration_read_number(str, index, 2, 2, seconds)) return false;
+  if (day_first || index != str.size()) {
+    if (!__duration_read_separator(str, index, ':') || !__duration_read_number(str, index, 1, 9, nanoseconds)) return false;
+  }
+  if (index != str.size() || days > std::chrono::duration_cast<std::chrono::hours>(std::chrono::nanoseconds::max()).count() / 24 - 1 || hours > 23 || minutes > 59 || seconds > 59) return false;
+
+  long long result = (((days * 24 + hours) * 60 + minutes) * 60 + seconds) * 1000000000LL + nanoseconds;
+  value = std::chrono::nanoseconds(negative ? -result : result);
+  return true;
+}
+
+// Gets the format letter; a non-ASCII character is mapped to '\0', which is no format, instead of being truncated to an ASCII letter.
+template<typename char_t>
+inline char __duration_format_letter(std::basic_string_view<char_t> fmt) noexcept {
+  if (fmt.empty()) return 'G';
+  return std::char_traits<char_t>::to_int_type(fmt[0]) > 0x7F ? '\0' : static_cast<char>(fmt[0]);
+}
+
+template<typename value_t, typename char_t>
+inline bool __duration_try_parse(std::basic_string_view<char_t> str, std::basic_string_view<char_t> fmt, value_t& value) noexcept {
+  if (fmt.size() > 1) return false;
+  std::chrono::nanoseconds result;
+  if (!__duration_try_parse(str, __duration_format_letter(fmt), result)) return false;
+  value = std::chrono::duration_cast<value_t>(result);
+  return true;
+}
+
+template<typename value_t, typename char_t>
+inline value_t __duration_parser(std::basic_string_view<char_t> str, std::basic_string_view<char_t> fmt) {
+  if (fmt.size() > 1) throw std::invalid_argument("Invalid format");
+  char letter = __duration_format_letter(fmt);
+  if (letter != 'c' && letter != 'f' && letter != 'F' && letter != 'g' && letter != 'G') throw std::invalid_argument("Invalid format");
+  value_t value {};
+  if (!__duration_try_parse(str, fmt, value)) throw std::invalid_argument("Invalid duration format");
+  return value;
+}
+/// @endcond
@@ -0,0 +1,139 @@
+/// @file
+/// @brief Contains __hash_string and __hash_seed methods.
+#pragma once
+
+/// @cond
+#ifndef __XTD_STRINGS_INCLUDE__
+#error "Do not include this file yourself, use only #include <xtd/xtd.strings>"
+#endif
+/// @endcond
+
+#include "__ignore_case.h"
+#include "__to_case.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string_view>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+/// @cond
+// After wyhash final version 4 by Wang Yi, released into the public domain: https://github.com/wangyi-fudan/wyhash
+inline void __wyhash_multiply(uint64_t& a, uint64_t& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+  __uint128_t result = static_cast<__uint128_t>(a) * b;
+  a = static_cast<uint64_t>(result);
+  b = static_cast<uint64_t>(result >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  a = _umul128(a, b, &b);
+#else
+  uint64_t high_a = a >> 32, high_b = b >> 32, low_a = static_cast<uint32_t>(a), low_b = static_cast<uint32_t>(b);
+  uint64_t high = high_a * high_b, middle_a = high_a * low_b, middle_b = high_b * low_a, low = low_a * low_b;
+  uint64_t sum = low + (middle_a << 32), carry = sum < low;
+  a = sum + (middle_b << 32);
+  carry += a < sum;
+  b = high + (middle_a >> 32) + (middle_b >> 32) + carry;
+#endif
+}
+
+inline uint64_t __wyhash_mix(uint64_t a, uint64_t b) noexcept {
+  __wyhash_multiply(a, b);
+  return a ^ b;
+}
+
+inline uint64_t __wyhash_read_8(const uint8_t* p) noexcept {
+  uint64_t value;
+  std::memcpy(&value, p, 8);
+  return value;
+}
+
+inline uint64_t __wyhash_read_4(const uint8_t* p) noexcept {
+  uint32_t value;
+  std::memcpy(&value, p, 4);
+  return value;
+}
+
+inline uint64_t __wyhash(const void* key, size_t length, uint64_t seed) noexcept {
+  static constexpr uint64_t secret[4] = {0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+  const uint8_t* p = static_cast<const uint8_t*>(key);
+  seed ^= __wyhash_mix(seed ^ secret[0], secret[1]);
+  uint64_t a = 0, b = 0;
+  if (length <= 16) {
+    if (length >= 4) {
+      a = (__wyhash_read_4(p) << 32) | __wyhash_read_4(p + ((length >> 3) << 2));
+      b = (__wyhash_read_4(p + length - 4) << 32) | __wyhash_read_4(p + length - 4 - ((length >> 3) << 2));
+    } else if (length > 0)
+      a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[length >> 1]) << 8) | p[length - 1];
+  } else {
+    size_t remaining = length;
+    if (remaining > 48) {
+      uint64_t seed_1 = seed, seed_2 = seed;
+      do {
+        seed = __wyhash_mix(__wyhash_read_8(p) ^ secret[1], __wyhash_read_8(p + 8) ^ seed);
+        seed_1 = __wyhash_mix(__wyhash_read_8(p + 16) ^ secret[2], __wyhash_read_8(p + 24) ^ seed_1);
+        seed_2 = __wyhash_mix(__wyhash_read_8(p + 32) ^ secret[3], __wyhash_read_8(p + 40) ^ seed_2);
+        p += 48;
+        remaining -= 48;
+      } while (remaining > 48);
+      seed ^= seed_1 ^ seed_2;
+    }
+    while (remaining > 16) {
+      seed = __wyhash_mix(__wyhash_read_8(p) ^ secret[1], __wyhash_read_8(p + 8) ^ seed);
+      p += 16;
+      remaining -= 16;
+    }
+    a = __wyhash_read_8(p + remaining - 16);
+    b = __wyhash_read_8(p + remaining - 8);
+  }
+  a ^= secret[1];
+  b ^= seed;
+  __wyhash_multiply(a, b);
+  return __wyhash_mix(a ^ secret[0] ^ length, b ^ secret[1]);
+}
+
+// The seed of the hash codes: 0, or a random value drawn once per process when XTD_STRINGS_RANDOM_HASH_SEED is defined, which makes hash flooding impractical.
+inline uint64_t __hash_seed() noexcept {
+#if defined(XTD_STRINGS_RANDOM_HASH_SEED)
+  static const uint64_t seed = [] {
+    try {
+      std::random_device device;
+      return (static_cast<uint64_t>(device()) << 32) ^ device();
+    } catch (...) {
+      return static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    }
+  }();
+  return seed;
+#else
+  return 0;
+#endif
+}
+
+// Hashes the characters of str; when case is ignored, they are folded by blocks into a buffer, so that strings that differ only by case hash the same without being copied.
+template<typename char_t>
+inline size_t __hash_string(std::basic_string_view<char_t> str, bool ignore_case, uint64_t seed) noexcept {
+  if (!ignore_case || str.empty()) return static_cast<size_t>(__wyhash(str.data(), str.size() * sizeof(char_t), seed));
+  constexpr size_t block_size = 256 / sizeof(char_t);
+  char_t block[block_size];
+  uint64_t result = seed;
+  size_t index = 0;
+  do {
+    size_t length = std::min(block_size, str.size() - index);
+    if constexpr (sizeof(char_t) == 1) {
+      std::memcpy(block, str.data() + index, length);
+      __to_lower_in_place(block, length);
+    } else {
+      for (size_t offset = 0; offset < length; ++offset)
+        block[offset] = __fold_case_char(str[index + offset]);
+    }
+    result = __wyhash(block, length * sizeof(char_t), result);
+    index += length;
+  } while (index < str.size());
+  return static_cast<size_t>(result);
+}
+/// @endcond
@@ -0,0 +1,74 @@
+/// @file
+/// @brief Contains __fold_case_char and __mismatch_ignore_case methods.
+#pragma once
+
+/// @cond
+#ifndef __XTD_STRINGS_INCLUDE__
+#error "Do not include this file yourself, use only #include <xtd/xtd.strings>"
+#endif
+/// @endcond
+
+#include "__unicode_case.h"
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define __XTD_STRINGS_SSE2__
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define __XTD_STRINGS_AVX2__
+#endif
+
+/// @cond
+// Folds a character for a comparison that ignores case, without locale: char is folded as ASCII, wider characters with the Unicode simple case folding of the code unit.
+template<typename char_t>
+inline char_t __fold_case_char(char_t c) noexcept {
+  using unsigned_char_t = typename std::make_unsigned<char_t>::type;
+  if constexpr (sizeof(char_t) == 1) return static_cast<unsigned char>(c - 'A') < 26 ? static_cast<char_t>(c | 0x20) : c;
+  else return static_cast<char_t>(__unicode_fold_case(static_cast<unsigned_char_t>(c)));
+}
+
+#if defined(__XTD_STRINGS_SSE2__)
+// Sets the 0x20 bit of the bytes that are ASCII upper case letters; the signed compares leave bytes >= 0x80 untouched.
+inline __m128i __ascii_lower_16(__m128i value) noexcept {
+  __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(value, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(value, _mm_set1_epi8('Z' + 1)));
+  return _mm_or_si128(value, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+#endif
+
+#if defined(__XTD_STRINGS_AVX2__)
+inline __m256i __ascii_lower_32(__m256i value) noexcept {
+  __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(value, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), value));
+  return _mm256_or_si256(value, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+#endif
+
+// Returns the index of the first character that differs when case is ignored, or length if the ranges are equal.
+// For char the ASCII letters are folded 16 or 32 bytes at a time; the scalar tail and any mismatch found by the vector loop are resolved with __fold_case_char.
+template<typename char_t>
+inline size_t __mismatch_ignore_case(const char_t* str_a, const char_t* str_b, size_t length) noexcept {
+  size_t index = 0;
+  if constexpr (sizeof(char_t) == 1) {
+#if defined(__XTD_STRINGS_AVX2__)
+    for (; index + 32 <= length; index += 32) {
+      __m256i a = __ascii_lower_32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str_a + index)));
+      __m256i b = __ascii_lower_32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str_b + index)));
+      if (static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))) != 0xFFFFFFFFu) break;
+    }
+#endif
+#if defined(__XTD_STRINGS_SSE2__)
+    for (; index + 16 <= length; index += 16) {
+      __m128i a = __ascii_lower_16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str_a + index)));
+      __m128i b = __ascii_lower_16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str_b + index)));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF) break;
+    }
+#endif
+  }
+  for (; index < length; ++index)
+    if (str_a[index] != str_b[index] && __fold_case_char(str_a[index]) != __fold_case_char(str_b[index])) return index;
+  return length;
+}
+/// @endcond
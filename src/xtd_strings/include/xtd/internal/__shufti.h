@@ -0,0 +1,100 @@
+/// @file
+/// @brief Contains __shufti_find_first and __shufti_find_last methods.
+#pragma once
+
+/// @cond
+#ifndef __XTD_STRINGS_INCLUDE__
+#error "Do not include this file yourself, use only #include <xtd/xtd.strings>"
+#endif
+/// @endcond
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define __XTD_STRINGS_SSSE3__
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/// @cond
+inline unsigned __shufti_lowest_bit(unsigned mask) noexcept {
+#if defined(_MSC_VER)
+  unsigned long index = 0;
+  _BitScanForward(&index, mask);
+  return static_cast<unsigned>(index);
+#else
+  return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+inline unsigned __shufti_highest_bit(unsigned mask) noexcept {
+#if defined(_MSC_VER)
+  unsigned long index = 0;
+  _BitScanReverse(&index, mask);
+  return static_cast<unsigned>(index);
+#else
+  return static_cast<unsigned>(31 - __builtin_clz(mask));
+#endif
+}
+
+// Shufti classifies 16 bytes at once: a byte is a candidate when the bucket bits found at its low nibble in low_table and at its high nibble in high_table intersect.
+// Candidates are confirmed with is_member unless the tables are exact.
+#if defined(__XTD_STRINGS_SSSE3__)
+inline unsigned __shufti_candidates(const unsigned char* data, __m128i low_table, __m128i high_table) noexcept {
+  __m128i nibble_mask = _mm_set1_epi8(0x0F);
+  __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  __m128i low = _mm_shuffle_epi8(low_table, _mm_and_si128(value, nibble_mask));
+  __m128i high = _mm_shuffle_epi8(high_table, _mm_and_si128(_mm_srli_epi16(value, 4), nibble_mask));
+  return ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(low, high), _mm_setzero_si128()))) & 0xFFFFu;
+}
+#endif
+
+// Returns the index of the first byte of [data, data + length) that belongs to the set, or length if there is none.
+template<typename is_member_t>
+inline size_t __shufti_find_first(const unsigned char* data, size_t length, const uint8_t* low_table, const uint8_t* high_table, bool exact, is_member_t is_member) noexcept {
+  size_t index = 0;
+#if defined(__XTD_STRINGS_SSSE3__)
+  __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(low_table));
+  __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(high_table));
+  for (; index + 16 <= length; index += 16) {
+    for (unsigned mask = __shufti_candidates(data + index, low, high); mask != 0; mask &= mask - 1) {
+      size_t candidate = index + __shufti_lowest_bit(mask);
+      if (exact || is_member(data[candidate])) return candidate;
+    }
+  }
+#else
+  (void)low_table;
+  (void)high_table;
+  (void)exact;
+#endif
+  for (; index < length; ++index)
+    if (is_member(data[index])) return index;
+  return length;
+}
+
+// Returns the index of the last byte of [data, data + length) that belongs to the set, or length if there is none.
+template<typename is_member_t>
+inline size_t __shufti_find_last(const unsigned char* data, size_t length, const uint8_t* low_table, const uint8_t* high_table, bool exact, is_member_t is_member) noexcept {
+  size_t end = length;
+#if defined(__XTD_STRINGS_SSSE3__)
+  __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(low_table));
+  __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(high_table));
+  for (; end >= 16; end -= 16) {
+    for (unsigned mask = __shufti_candidates(data + end - 16, low, high); mask != 0; mask &= ~(1u << __shufti_highest_bit(mask))) {
+      size_t candidate = end - 16 + __shufti_highest_bit(mask);
+      if (exact || is_member(data[candidate])) return candidate;
+    }
+  }
+#else
+  (void)low_table;
+  (void)high_table;
+  (void)exact;
+#endif
+  for (; end > 0; --end)
+    if (is_member(data[end - 1])) return end - 1;
+  return length;
+}
+/// @endcond
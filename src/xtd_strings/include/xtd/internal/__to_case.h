@@ -0,0 +1,80 @@
+/// @file
+/// @brief Contains __to_lower_in_place and __to_upper_in_place methods.
+#pragma once
+
+/// @cond
+#ifndef __XTD_STRINGS_INCLUDE__
+#error "Do not include this file yourself, use only #include <xtd/xtd.strings>"
+#endif
+/// @endcond
+
+#include "__ignore_case.h"
+#include "__unicode_case.h"
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define __XTD_STRINGS_NEON__
+#endif
+
+/// @cond
+#if defined(__XTD_STRINGS_SSE2__)
+// Toggles the 0x20 bit of the bytes in [first, first + 26): moving the range to the bottom of the signed bytes lets one compare test both bounds.
+inline __m128i __ascii_toggle_case_16(__m128i value, char first) noexcept {
+  __m128i letters = _mm_cmplt_epi8(_mm_add_epi8(value, _mm_set1_epi8(static_cast<char>(0x80 - first))), _mm_set1_epi8(static_cast<char>(0x80 + 26)));
+  return _mm_xor_si128(value, _mm_and_si128(letters, _mm_set1_epi8(0x20)));
+}
+#endif
+
+#if defined(__XTD_STRINGS_AVX2__)
+inline __m256i __ascii_toggle_case_32(__m256i value, char first) noexcept {
+  __m256i letters = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(0x80 + 26)), _mm256_add_epi8(value, _mm256_set1_epi8(static_cast<char>(0x80 - first))));
+  return _mm256_xor_si256(value, _mm256_and_si256(letters, _mm256_set1_epi8(0x20)));
+}
+#endif
+
+#if defined(__XTD_STRINGS_NEON__)
+inline uint8x16_t __ascii_toggle_case_16(uint8x16_t value, char first) noexcept {
+  uint8x16_t letters = vcltq_u8(vsubq_u8(value, vdupq_n_u8(static_cast<uint8_t>(first))), vdupq_n_u8(26));
+  return veorq_u8(value, vandq_u8(letters, vdupq_n_u8(0x20)));
+}
+#endif
+
+// Converts in place the ASCII letters in [first, first + 26) to the other case; every other character, including the non-ASCII ones, is left unchanged.
+// For char the letters are converted 16 or 32 bytes at a time, the tail one character at a time.
+template<typename char_t>
+inline void __ascii_toggle_case(char_t* str, size_t length, char first) noexcept {
+  size_t index = 0;
+  if constexpr (sizeof(char_t) == 1) {
+#if defined(__XTD_STRINGS_AVX2__)
+    for (; index + 32 <= length; index += 32)
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(str + index), __ascii_toggle_case_32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + index)), first));
+#endif
+#if defined(__XTD_STRINGS_SSE2__)
+    for (; index + 16 <= length; index += 16)
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(str + index), __ascii_toggle_case_16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + index)), first));
+#elif defined(__XTD_STRINGS_NEON__)
+    for (; index + 16 <= length; index += 16)
+      vst1q_u8(reinterpret_cast<uint8_t*>(str + index), __ascii_toggle_case_16(vld1q_u8(reinterpret_cast<const uint8_t*>(str + index)), first));
+#endif
+  }
+  using unsigned_char_t = typename std::make_unsigned<char_t>::type;
+  for (; index < length; ++index)
+    if (static_cast<unsigned_char_t>(static_cast<unsigned_char_t>(str[index]) - static_cast<unsigned_char_t>(first)) < 26) str[index] = static_cast<char_t>(str[index] ^ 0x20);
+}
+
+// char strings are converted as ASCII, wider strings as UTF-16 or UTF-32 with the Unicode simple case mappings.
+template<typename char_t>
+inline void __to_lower_in_place(char_t* str, size_t length) noexcept {
+  if constexpr (sizeof(char_t) == 1) __ascii_toggle_case(str, length, 'A');
+  else __unicode_map_case(str, length, [](char32_t code_point) {return __unicode_to_lower(code_point);});
+}
+
+template<typename char_t>
+inline void __to_upper_in_place(char_t* str, size_t length) noexcept {
+  if constexpr (sizeof(char_t) == 1) __ascii_toggle_case(str, length, 'a');
+  else __unicode_map_case(str, length, [](char32_t code_point) {return __unicode_to_upper(code_point);});
+}
+/// @endcond
@@ -0,0 +1,46 @@
+/// @file
+/// @brief Contains __unicode_to_lower, __unicode_to_upper and __unicode_fold_case methods.
+#pragma once
+
+/// @cond
+#ifndef __XTD_STRINGS_INCLUDE__
+#error "Do not include this file yourself, use only #include <xtd/xtd.strings>"
+#endif
+/// @endcond
+
+#include "__unicode_case_tables.h"
+
+#include <cstddef>
+#include <type_traits>
+
+/// @cond
+// Returns the record of the simple case mappings of a code point: two table lookups, whatever the code point.
+inline const __unicode_case_record& __unicode_case_record_of(char32_t code_point) noexcept {
+  if (code_point >= __unicode_case_limit) return __unicode_case_records[0];
+  return __unicode_case_records[__unicode_case_indexes[(static_cast<size_t>(__unicode_case_blocks[code_point >> __unicode_case_shift]) << __unicode_case_shift) + (code_point & ((1u << __unicode_case_shift) - 1))]];
+}
+
+inline char32_t __unicode_to_lower(char32_t code_point) noexcept {return static_cast<char32_t>(static_cast<int32_t>(code_point) + __unicode_case_record_of(code_point).lower);}
+inline char32_t __unicode_to_upper(char32_t code_point) noexcept {return static_cast<char32_t>(static_cast<int32_t>(code_point) + __unicode_case_record_of(code_point).upper);}
+inline char32_t __unicode_fold_case(char32_t code_point) noexcept {return static_cast<char32_t>(static_cast<int32_t>(code_point) + __unicode_case_record_of(code_point).fold);}
+
+// Applies a simple case mapping in place to a UTF-16 (2 bytes characters) or UTF-32 (4 bytes characters) string.
+// The mappings never cross the basic multilingual plane, so surrogate pairs keep their length.
+template<typename char_t, typename mapping_t>
+inline void __unicode_map_case(char_t* str, size_t length, mapping_t mapping) noexcept {
+  static_assert(sizeof(char_t) == 2 || sizeof(char_t) == 4, "__unicode_map_case requires UTF-16 or UTF-32 characters");
+  using unsigned_char_t = typename std::make_unsigned<char_t>::type;
+  for (size_t index = 0; index < length; ++index) {
+    char32_t code_point = static_cast<unsigned_char_t>(str[index]);
+    if constexpr (sizeof(char_t) == 2) {
+      if (code_point >= 0xD800 && code_point < 0xDC00 && index + 1 < length && static_cast<unsigned_char_t>(str[index + 1]) >= 0xDC00 && static_cast<unsigned_char_t>(str[index + 1]) < 0xE000) {
+        char32_t mapped = mapping(0x10000 + ((code_point - 0xD800) << 10) + (static_cast<unsigned_char_t>(str[index + 1]) - 0xDC00));
+        str[index] = static_cast<char_t>(0xD800 + ((mapped - 0x10000) >> 10));
+        str[++index] = static_cast<char_t>(0xDC00 + ((mapped - 0x10000) & 0x3FF));
+        continue;
+      }
+    }
+    str[index] = static_cast<char_t>(mapping(code_point));
+  }
+}
+/// @endcond
@@ -2,204 +2,320 @@
 /// @brief Contains xtd::immutable_basic_string class.
 #pragma once
 
+/// @cond
+#define __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include "internal/__hash.h"
+
+/// @cond
+#undef __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
   /// @brief Immutable basic_string<char_t>
+  /// @remarks The characters are stored once in a buffer shared by all the copies and reference counted atomically: a copy, a move, and substr are O(1) and never allocate, so that instances can be passed by value across threads.
+  /// @remarks substr returns a slice of the same buffer. A slice that does not end with its buffer is not null-terminated: c_str copies it once, on its first call.
+  /// @remarks The hash code of a string that covers its whole buffer is computed on the first call to get_hash_code and cached in the buffer, for all the copies.
+  /// @remarks The buffer is allocated with, and keeps a copy of, the allocator of the string. A copy with another allocator, that does not compare equal, copies the characters into a new buffer; an empty string has no buffer and returns a default-constructed allocator.
   template<class char_t, class char_traits_t = std::char_traits<char_t>, class allocator_t = std::allocator<char_t>>
-  class immutable_basic_string : public std::basic_string<char_t, char_traits_t, allocator_t> {
+  class immutable_basic_string {
+    struct buffer {
+      buffer(size_t length, const allocator_t& allocator) noexcept : length(length), allocator(allocator) {}
+      std::atomic<size_t> references {1};
+      std::atomic<size_t> hash_code {0};
+      size_t length;
+      allocator_t allocator;
+      char_t* data() noexcept {return reinterpret_cast<char_t*>(this + 1);}
+    };
+    using buffer_allocator_t = typename std::allocator_traits<allocator_t>::template rebind_alloc<buffer>;
+
   public:
     /// @cond
-    using __self = immutable_basic_string;
     using __self_view = std::basic_string_view<char_t, char_traits_t>;
     using traits_type = char_traits_t;
     using value_type = char_t;
     using allocator_type = allocator_t;
-    using __alloc_traits = std::allocator_traits<allocator_type>;
-    using size_type = typename __alloc_traits::size_type;
-    using difference_type = typename __alloc_traits::difference_type;
-    using reference = value_type&;
-    using const_reference =  const value_type&;
-    using pointer = typename __alloc_traits::pointer;
-    using const_pointer = typename __alloc_traits::const_pointer;
-    using iterator = typename std::basic_string<char_t, char_traits_t, allocator_t>::iterator;
-    using const_iterator = typename std::basic_string<char_t, char_traits_t, allocator_t>::const_iterator;
-    using reverse_iterator = typename std::basic_string<char_t, char_traits_t, allocator_t>::reverse_iterator;
-    using const_reverse_iterator = typename std::basic_string<char_t, char_traits_t, allocator_t>::reverse_iterator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+    using pointer = const value_type*;
+    using const_pointer = const value_type*;
+    using iterator = const value_type*;
+    using const_iterator = const value_type*;
+    using reverse_iterator = std::reverse_iterator<const_iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    static constexpr size_type npos = static_cast<size_type>(-1);
 
     immutable_basic_string() noexcept {}
-    explicit immutable_basic_string(const allocator_t& a) noexcept : std::basic_string<char_t, char_traits_t, allocator_t>(a) {}
+    explicit immutable_basic_string(const allocator_t&) noexcept {}
 
-    immutable_basic_string(size_t n, char_t c)  : std::basic_string<char_t, char_traits_t, allocator_t>(n, c) {}
-    immutable_basic_string(size_t n, char_t c, const allocator_t& a)  : std::basic_string<char_t, char_traits_t, allocator_t>(n, c, a) {}
+    immutable_basic_string(size_t n, char_t c, const allocator_t& a = allocator_t()) {
+      char_t* data = allocate(n, a);
+      char_traits_t::assign(data, n, c);
+    }
 
-    immutable_basic_string(const immutable_basic_string& str, size_t pos, size_t n, const allocator_t& a = allocator_t()) : std::basic_string<char_t, char_traits_t, allocator_t>(str, pos, n, a) {}
-    immutable_basic_string(const immutable_basic_string& str, size_t pos, const allocator_t& a = allocator_t()) : std::basic_string<char_t, char_traits_t, allocator_t>(str, pos, a) {}
+    immutable_basic_string(const immutable_basic_string& str, size_t pos, size_t n, const allocator_t& a = allocator_t()) : immutable_basic_string(str.substr(pos, n), a) {}
+    immutable_basic_string(const immutable_basic_string& str, size_t pos, const allocator_t& a = allocator_t()) : immutable_basic_string(str.substr(pos), a) {}
 
-    immutable_basic_string(const char_t* str, size_t n) : std::basic_string<char_t, char_traits_t, allocator_t>(str, n) {}
-    immutable_basic_string(const char_t* str, size_t n, const allocator_t& a) : std::basic_string<char_t, char_traits_t, allocator_t>(str, n, a) {}
-    
-    immutable_basic_string(const char_t* str) : std::basic_string<char_t, char_traits_t, allocator_t>(str) {}
-    immutable_basic_string(const char_t* str, const allocator_t& a) : std::basic_string<char_t, char_traits_t, allocator_t>(str, a) {}
+    immutable_basic_string(const char_t* str, size_t n, const allocator_t& a = allocator_t()) {
+      char_traits_t::copy(allocate(n, a), str, n);
+    }
+    immutable_basic_string(const char_t* str, const allocator_t& a = allocator_t()) : immutable_basic_string(str, char_traits_t::length(str), a) {}
 
-    template<class InputIterator>
-    immutable_basic_string(InputIterator first, InputIterator last) : std::basic_string<char_t, char_traits_t, allocator_t>(first, last) {}
-    template<class InputIterator>
-    immutable_basic_string(InputIterator first, InputIterator last, const allocator_t& a) : std::basic_string<char_t, char_traits_t, allocator_t>(first, last, a) {}
+    template<class InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+    immutable_basic_string(InputIterator first, InputIterator last, const allocator_t& a = allocator_t()) : immutable_basic_string(std::basic_string<char_t, char_traits_t, allocator_t>(first, last, a), a) {}
 
-    immutable_basic_string(const immutable_basic_string& str) noexcept : std::basic_string<char_t, char_traits_t, allocator_t>(str) {}
-    immutable_basic_string(const immutable_basic_string& str, const allocator_t& a) noexcept : std::basic_string<char_t, char_traits_t, allocator_t>(str, a) {}
+    immutable_basic_string(const immutable_basic_string& str) noexcept : buffer_(str.buffer_), data_(str.data_), length_(str.length_) {acquire();}
+    immutable_basic_string(const immutable_basic_string& str, const allocator_t& a) : immutable_basic_string(str.get_allocator() == a ? str : immutable_basic_string(str.data_, str.length_, a)) {}
 
-    immutable_basic_string(immutable_basic_string&& str) noexcept : std::basic_string<char_t, char_traits_t, allocator_t>(str)  {}
-    immutable_basic_string(immutable_basic_string&& str, const allocator_t& a) noexcept : std::basic_string<char_t, char_traits_t, allocator_t>(str, a) {}
+    immutable_basic_string(immutable_basic_string&& str) noexcept : buffer_(str.buffer_), data_(str.data_), length_(str.length_) {str.reset();}
+    immutable_basic_string(immutable_basic_string&& str, const allocator_t& a) : immutable_basic_string(str.get_allocator() == a ? std::move(str) : immutable_basic_string(str.data_, str.length_, a)) {}
 
-    immutable_basic_string(std::initializer_list<char_t> il) : std::basic_string<char_t, char_traits_t, allocator_t>(il) {}
-    immutable_basic_string(std::initializer_list<char_t> il, const allocator_t& a)  : std::basic_string<char_t, char_traits_t, allocator_t>(il, a) {}
+    immutable_basic_string(std::initializer_list<char_t> il, const allocator_t& a = allocator_t()) : immutable_basic_string(il.begin(), il.size(), a) {}
 
-    template<class T>
-    immutable_basic_string(const T& t, const allocator_t& a = allocator_t()) : std::basic_string<char_t, char_traits_t, allocator_t>(t, a) {}
+    template<class T, typename = typename std::enable_if<std::is_convertible<const T&, __self_view>::value && !std::is_convertible<const T&, const char_t*>::value && !std::is_same<T, immutable_basic_string>::value>::type>
+    immutable_basic_string(const T& t, const allocator_t& a = allocator_t()) : immutable_basic_string(__self_view(t).data(), __self_view(t).size(), a) {}
+
+    template<class T, typename = typename std::enable_if<std::is_convertible<const T&, __self_view>::value && !std::is_convertible<const T&, const char_t*>::value>::type>
+    immutable_basic_string(const T& t, size_t pos, size_t n, const allocator_t& a = allocator_t()) : immutable_basic_string(__self_view(t).substr(pos, n), a) {}
+
+    ~immutable_basic_string() {
+      release();
+      release(c_str_buffer_.load(std::memory_order_acquire));
+    }
+
+    const char_t& at(size_t pos) const {
+      if (pos >= length_) throw std::out_of_range("immutable_basic_string::at");
+      return data_[pos];
+    }
+    const char_t& operator[](size_t pos) const noexcept {return data_[pos];}
+    const char_t& front() const noexcept {return data_[0];}
+    const char_t& back() const noexcept {return data_[length_ - 1];}
+
+    const char_t* data() const noexcept {return data_;}
+    const char_t* c_str() const {
+      if (!buffer_ || data_ + length_ == buffer_->data() + buffer_->length) return data_;
+      buffer* copy = c_str_buffer_.load(std::memory_order_acquire);
+      if (copy) return copy->data();
+      copy = create(length_, buffer_->allocator);
+      char_traits_t::copy(copy->data(), data_, length_);
+      buffer* expected = nullptr;
+      if (c_str_buffer_.compare_exchange_strong(expected, copy, std::memory_order_acq_rel)) return copy->data();
+      release(copy);
+      return expected->data();
+    }
+
+    const_iterator begin() const noexcept {return data_;}
+    const_iterator cbegin() const noexcept {return data_;}
+    const_iterator end() const noexcept {return data_ + length_;}
+    const_iterator cend() const noexcept {return data_ + length_;}
+    const_reverse_iterator rbegin() const noexcept {return const_reverse_iterator(end());}
+    const_reverse_iterator crbegin() const noexcept {return const_reverse_iterator(end());}
+    const_reverse_iterator rend() const noexcept {return const_reverse_iterator(begin());}
+    const_reverse_iterator crend() const noexcept {return const_reverse_iterator(begin());}
+
+    bool empty() const noexcept {return length_ == 0;}
+    size_type size() const noexcept {return length_;}
+    size_type length() const noexcept {return length_;}
+    size_type max_size() const noexcept {return std::allocator_traits<allocator_t>::max_size(allocator_t()) - sizeof(buffer) / sizeof(char_t) - 1;}
+    allocator_type get_allocator() const noexcept {return buffer_ ? buffer_->allocator : allocator_t();}
 
+    immutable_basic_string& operator=(const immutable_basic_string& str) noexcept {
+      immutable_basic_string(str).swap(*this);
+      return *this;
+    }
+    immutable_basic_string& operator=(immutable_basic_string&& str) noexcept {
+      immutable_basic_string(std::move(str)).swap(*this);
+      return *this;
+    }
+    immutable_basic_string& operator=(char_t ch) {return *this = immutable_basic_string(1, ch);}
+    immutable_basic_string& operator=(const char_t* str) {return *this = immutable_basic_string(str);}
+    immutable_basic_string& operator=(const std::initializer_list<char_t>& il) {return *this = immutable_basic_string(il);}
+    template<class T, typename = typename std::enable_if<std::is_convertible<const T&, __self_view>::value && !std::is_convertible<const T&, const char_t*>::value && !std::is_same<T, immutable_basic_string>::value>::type>
+    immutable_basic_string& operator=(const T& t) {return *this = immutable_basic_string(t);}
+
+    operator __self_view() const noexcept {return __self_view(data_, length_);}
+    operator std::basic_string<char_t, char_traits_t, allocator_t>() const {return std::basic_string<char_t, char_traits_t, allocator_t>(data_, length_, get_allocator());}
+
+    int compare(const immutable_basic_string& str) const noexcept {return __self_view(*this).compare(__self_view(str));}
+    int compare(size_type pos1, size_type count1, const immutable_basic_string& str, size_type pos2, size_type count2 = npos) const {return __self_view(*this).compare(pos1, count1, __self_view(str), pos2, count2);}
+    int compare(const char_t* str) const noexcept {return __self_view(*this).compare(str);}
+    int compare(size_type pos1, size_type count1, const char_t* str) const {return __self_view(*this).compare(pos1, count1, str);}
+    int compare(size_type pos1, size_type count1, const char_t* str, size_type count2) const {return __self_view(*this).compare(pos1, count1, str, count2);}
     template<class T>
-    immutable_basic_string(const T& t, size_t pos, size_t n, const allocator_t& a = allocator_t()) : std::basic_string<char_t, char_traits_t, allocator_t>(t, pos, n, a) {}
+    int compare(const T& t) const noexcept {return __self_view(*this).compare(__self_view(t));}
+    template<class T>
+    int compare(size_type pos1, size_type count1, const T& t) const {return __self_view(*this).compare(pos1, count1, __self_view(t));}
+    template<class T>
+    int compare(size_type pos1, size_type count1, const T& t, size_type pos2, size_type count2 = npos) const {return __self_view(*this).compare(pos1, count1, __self_view(t), pos2, count2);}
+    /// @endcond
 
-    ~immutable_basic_string() {}
-    
-    const char_t& at(size_t pos) {return this->std::basic_string<char_t, char_traits_t, allocator_t>::at(pos);}
-    const char_t& at(size_t pos) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::at(pos);}
-    
-    const char_t& operator[](size_t pos) {return this->std::basic_string<char_t, char_traits_t, allocator_t>::operator[](pos);}
-    const char_t& operator[](size_t pos) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::operator[](pos);}
+    /// @brief Returns a substring of this string that shares its buffer.
+    /// @param pos The position of the first character of the substring.
+    /// @param count The length of the substring; it is truncated to the end of this string.
+    /// @return The substring, in O(1) and without allocation.
+    /// @exception std::out_of_range pos is greater than size().
+    immutable_basic_string substr(size_type pos = 0, size_type count = npos) const {
+      if (pos > length_) throw std::out_of_range("immutable_basic_string::substr");
+      immutable_basic_string result(*this);
+      result.data_ += pos;
+      result.length_ = std::min(count, length_ - pos);
+      return result;
+    }
 
-    const char_t& front() {return this->std::basic_string<char_t, char_traits_t, allocator_t>::front();}
-    const char_t& front() const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::front();}
-    
-    const char_t& back() {return this->std::basic_string<char_t, char_traits_t, allocator_t>::back();}
-    const char_t& back() const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::back();}
-    
-    const char_t* data() {return this->std::basic_string<char_t, char_traits_t, allocator_t>::data();}
-    const char_t* data() const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::data();}
-    
-    const char_t* c_str() {return this->std::basic_string<char_t, char_traits_t, allocator_t>::c_str();}
-    const char_t* c_str() const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::c_str();}
+    /// @brief Returns the hash code for this string, the same as xtd::strings::get_hash_code.
+    /// @return A hash code.
+    /// @remarks When this string covers its whole buffer, the hash code is computed once and cached in the buffer, for all the copies of this string.
+    size_t get_hash_code() const noexcept {
+      if (!buffer_ || length_ != buffer_->length) return __hash_string(__self_view(*this), false, __hash_seed());
+      size_t hash_code = buffer_->hash_code.load(std::memory_order_relaxed);
+      if (hash_code == 0) buffer_->hash_code.store(hash_code = __hash_string(__self_view(*this), false, __hash_seed()), std::memory_order_relaxed);
+      return hash_code;
+    }
 
-    const_iterator begin() {return this->std::basic_string<char_t, char_traits_t, allocator_t>::begin();}
-    const_iterator begin() const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::begin();}
-    const_iterator cbegin() const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::cbegin();}
-    
-    const_iterator end() {return this->std::basic_string<char_t, char_traits_t, allocator_t>::end();}
-    const_iterator end() const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::end();}
-    const_iterator cend() const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::cend();}
-    
-    const_iterator rbegin() {this->std::basic_string<char_t, char_traits_t, allocator_t>::rbegin();}
-    const_iterator rbegin() const {this->std::basic_string<char_t, char_traits_t, allocator_t>::rbegin();}
-    const_iterator crbegin() const {this->std::basic_string<char_t, char_traits_t, allocator_t>::crbegin();}
-    
-    const_iterator rend() {this->std::basic_string<char_t, char_traits_t, allocator_t>::rend();}
-    const_iterator rend() const {this->std::basic_string<char_t, char_traits_t, allocator_t>::rend();}
-    const_iterator crend() const {this->std::basic_string<char_t, char_traits_t, allocator_t>::crend();}
-
-    immutable_basic_string operator=(const immutable_basic_string& str) {return this->std::basic_string<char_t, char_traits_t, allocator_t>::assign(str);}
-    immutable_basic_string operator=(char_t ch) {return this->std::basic_string<char_t, char_traits_t, allocator_t>::assign(ch);}
-    immutable_basic_string operator=(const char* str) {return this->std::basic_string<char_t, char_traits_t, allocator_t>::assign(str);}
-    immutable_basic_string operator=(const std::initializer_list<char_t>& il) {return this->std::basic_string<char_t, char_traits_t, allocator_t>::assign(il);}
-    template<typename T>
-    immutable_basic_string operator=(const T& t) {return this->std::basic_string<char_t, char_traits_t, allocator_t>::assign(t);}
+    /// @cond
+    size_type copy(char_t* dest, size_type count, size_type pos = 0) const {
+      if (pos > length_) throw std::out_of_range("immutable_basic_string::copy");
+      count = std::min(count, length_ - pos);
+      char_traits_t::copy(dest, data_ + pos, count);
+      return count;
+    }
+    void swap(immutable_basic_string& other) noexcept {
+      std::swap(buffer_, other.buffer_);
+      std::swap(data_, other.data_);
+      std::swap(length_, other.length_);
+      buffer* copy = c_str_buffer_.exchange(other.c_str_buffer_.load(std::memory_order_acquire), std::memory_order_acq_rel);
+      other.c_str_buffer_.store(copy, std::memory_order_release);
+    }
 
-    /*
-    immutable_basic_string operator+(const immutable_basic_string& str) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::operator+(str);;}
-    immutable_basic_string operator+(char_t ch) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::operator+(ch);}
-    immutable_basic_string operator+(const char_t* str) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::operator+(str);}
-    immutable_basic_string operator+(const std::initializer_list<char_t>& il) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::operator+(il);}
-    template<typename T>
-    immutable_basic_string operator+(const T& t) const {this->std::basic_string<char_t, char_traits_t, allocator_t>::operator+=(t); return *this;}
+    size_type find(const immutable_basic_string& str, size_type pos = 0) const noexcept {return __self_view(*this).find(__self_view(str), pos);}
+    size_type find(const char_t* str, size_type pos, size_type count) const {return __self_view(*this).find(str, pos, count);}
+    size_type find(const char_t* str, size_type pos = 0) const {return __self_view(*this).find(str, pos);}
+    size_type find(char_t ch, size_type pos = 0) const noexcept {return __self_view(*this).find(ch, pos);}
+    template<class T>
+    size_type find(const T& t, size_type pos = 0) const noexcept {return __self_view(*this).find(__self_view(t), pos);}
 
-    immutable_basic_string& operator+=(const immutable_basic_string& str) {this->std::basic_string<char_t, char_traits_t, allocator_t>::operator+=(str); return *this;}
-    immutable_basic_string& operator+=(char_t ch) {this->std::basic_string<char_t, char_traits_t, allocator_t>::operator+=(ch); return *this;}
-    immutable_basic_string& operator+=(const char_t* str) {this->std::basic_string<char_t, char_traits_t, allocator_t>::operator+=(str); return *this;}
-    immutable_basic_string& operator+=(const std::initializer_list<char_t>& il) {this->std::basic_string<char_t, char_traits_t, allocator_t>::operator+=(il); return *this;}
-    template<typename T>
-    immutable_basic_string& operator+=(const T& t) {this->std::basic_string<char_t, char_traits_t, allocator_t>::operator+=(t); return *this;}
-     */
-    
-    int compare(const immutable_basic_string& str) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::compare(str);}
-    int compare(size_type pos1, size_type count1, const immutable_basic_string& str, size_type pos2, size_type count2 = npos) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::compare(pos1, count1, str, pos2, count2);}
-    int compare(const char_t* str) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::compare(str);}
-    int compare(size_type pos1, size_type count1, const char_t* str) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::compare(pos1, count1, str);}
-    int compare(size_type pos1, size_type count1, const char_t* str, size_type count2) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::compare(pos1, count1, str, count2);}
-    template < class T >
-    int compare(const T& t) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::compare(t);}
-    template < class T >
-    int compare(size_type pos1, size_type count1, const T& t) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::compare(pos1, count1, t);}
-    template < class T >
-    int compare(size_type pos1, size_type count1, const T& t, size_type pos2, size_type count2 = npos) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::compare(pos1, count1, t, pos2, count2);}
-
-    immutable_basic_string substr(size_type pos = 0, size_type count = npos) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::substr(pos, count);}
-    static const size_type npos = -1;
-    
-    size_type copy(char_t* dest, size_type count, size_type pos = 0) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::copy(dest, count, pos);}
-    void swap(immutable_basic_string& other) noexcept {this->std::basic_string<char_t, char_traits_t, allocator_t>::swap(other);}
-    
-    size_type find(const immutable_basic_string& str, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find(str, pos);}
-    size_type find(const char_t* str, size_type pos, size_type count) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find(str, pos, count);}
-    size_type find(const char_t* str, size_type pos = 0) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find(str, pos);}
-    size_type find(char_t ch, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find(ch, pos);}
-    template < class T >
-    size_type find(const T& t, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find(t, pos);}
-    
-    size_type rfind(const immutable_basic_string& str, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::rfind(str, pos);}
-    size_type rfind(const char_t* str, size_type pos, size_type count) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::rfind(str, pos, count);}
-    size_type rfind(const char_t* str, size_type pos = 0) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::rfind(str, pos);}
-    size_type rfind(char_t ch, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::rfind(ch, pos);}
-    template < class T >
-    size_type rfind(const T& t, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::rfind(t, pos);}
-
-    size_type find_first_of(const immutable_basic_string& str, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_first_of(str, pos);}
-    size_type find_first_of(const char_t* str, size_type pos, size_type count) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_first_of(str, pos, count);}
-    size_type find_first_of(const char_t* str, size_type pos = 0) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_first_of(str, pos);}
-    size_type find_first_of(char_t ch, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_first_of(ch, pos);}
+    size_type rfind(const immutable_basic_string& str, size_type pos = npos) const noexcept {return __self_view(*this).rfind(__self_view(str), pos);}
+    size_type rfind(const char_t* str, size_type pos, size_type count) const {return __self_view(*this).rfind(str, pos, count);}
+    size_type rfind(const char_t* str, size_type pos = npos) const {return __self_view(*this).rfind(str, pos);}
+    size_type rfind(char_t ch, size_type pos = npos) const noexcept {return __self_view(*this).rfind(ch, pos);}
+    template<class T>
+    size_type rfind(const T& t, size_type pos = npos) const noexcept {return __self_view(*this).rfind(__self_view(t), pos);}
+
+    size_type find_first_of(const immutable_basic_string& str, size_type pos = 0) const noexcept {return __self_view(*this).find_first_of(__self_view(str), pos);}
+    size_type find_first_of(const char_t* str, size_type pos, size_type count) const {return __self_view(*this).find_first_of(str, pos, count);}
+    size_type find_first_of(const char_t* str, size_type pos = 0) const {return __self_view(*this).find_first_of(str, pos);}
+    size_type find_first_of(char_t ch, size_type pos = 0) const noexcept {return __self_view(*this).find_first_of(ch, pos);}
     template<typename T>
-    size_type find_first_of(const T& t, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_first_of(t, pos);}
-    
-    size_type find_first_not_of(const immutable_basic_string& str, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_first_not_of(str, pos);}
-    size_type find_first_not_of(const char_t* str, size_type pos, size_type count) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_first_not_of(str, pos, count);}
-    size_type find_first_not_of(const char_t* str, size_type pos = 0) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_first_not_of(str, pos);}
-    size_type find_first_not_of(char_t ch, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_first_not_of(ch, pos);}
+    size_type find_first_of(const T& t, size_type pos = 0) const noexcept {return __self_view(*this).find_first_of(__self_view(t), pos);}
+
+    size_type find_first_not_of(const immutable_basic_string& str, size_type pos = 0) const noexcept {return __self_view(*this).find_first_not_of(__self_view(str), pos);}
+    size_type find_first_not_of(const char_t* str, size_type pos, size_type count) const {return __self_view(*this).find_first_not_of(str, pos, count);}
+    size_type find_first_not_of(const char_t* str, size_type pos = 0) const {return __self_view(*this).find_first_not_of(str, pos);}
+    size_type find_first_not_of(char_t ch, size_type pos = 0) const noexcept {return __self_view(*this).find_first_not_of(ch, pos);}
     template<typename T>
-    size_type find_first_not_of(const T& t, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_first_not_of(t, pos);}
+    size_type find_first_not_of(const T& t, size_type pos = 0) const noexcept {return __self_view(*this).find_first_not_of(__self_view(t), pos);}
 
-    size_type find_last_of(const immutable_basic_string& str, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_last_of(str, pos);}
-    size_type find_last_of(const char_t* str, size_type pos, size_type count) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_last_of(str, pos, count);}
-    size_type find_last_of(const char_t* str, size_type pos = 0) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_last_of(str, pos);}
-    size_type find_last_of(char_t ch, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_last_of(ch, pos);}
+    size_type find_last_of(const immutable_basic_string& str, size_type pos = npos) const noexcept {return __self_view(*this).find_last_of(__self_view(str), pos);}
+    size_type find_last_of(const char_t* str, size_type pos, size_type count) const {return __self_view(*this).find_last_of(str, pos, count);}
+    size_type find_last_of(const char_t* str, size_type pos = npos) const {return __self_view(*this).find_last_of(str, pos);}
+    size_type find_last_of(char_t ch, size_type pos = npos) const noexcept {return __self_view(*this).find_last_of(ch, pos);}
     template<typename T>
-    size_type find_last_of(const T& t, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_last_of(t, pos);}
-    
-    size_type find_last_not_of(const immutable_basic_string& str, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_last_not_of(str, pos);}
-    size_type find_last_not_of(const char_t* str, size_type pos, size_type count) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_last_not_of(str, pos, count);}
-    size_type find_last_not_of(const char_t* str, size_type pos = 0) const {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_last_not_of(str, pos);}
-    size_type find_last_not_of(char_t ch, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_last_not_of(ch, pos);}
+    size_type find_last_of(const T& t, size_type pos = npos) const noexcept {return __self_view(*this).find_last_of(__self_view(t), pos);}
+
+    size_type find_last_not_of(const immutable_basic_string& str, size_type pos = npos) const noexcept {return __self_view(*this).find_last_not_of(__self_view(str), pos);}
+    size_type find_last_not_of(const char_t* str, size_type pos, size_type count) const {return __self_view(*this).find_last_not_of(str, pos, count);}
+    size_type find_last_not_of(const char_t* str, size_type pos = npos) const {return __self_view(*this).find_last_not_of(str, pos);}
+    size_type find_last_not_of(char_t ch, size_type pos = npos) const noexcept {return __self_view(*this).find_last_not_of(ch, pos);}
     template<typename T>
-    size_type find_last_not_of(const T& t, size_type pos = 0) const noexcept {return this->std::basic_string<char_t, char_traits_t, allocator_t>::find_last_not_of(t, pos);}
+    size_type find_last_not_of(const T& t, size_type pos = npos) const noexcept {return __self_view(*this).find_last_not_of(__self_view(t), pos);}
 
-    friend std::basic_ostream<char_t, char_traits_t>& operator<<(std::basic_ostream<char_t, char_traits_t>& os, const immutable_basic_string<char_t, char_traits_t, allocator_t>& str) {return os << ((const std::basic_string<char_t, char_traits_t, allocator_t>&)str);}
-    friend std::basic_ostream<char_t, char_traits_t>& operator<<(std::basic_ostream<char_t, char_traits_t>& os, immutable_basic_string<char_t, char_traits_t, allocator_t>& str) {return os << ((std::basic_string<char_t, char_traits_t, allocator_t>&)str);}
+    friend bool operator==(const immutable_basic_string& a, const immutable_basic_string& b) noexcept {return a.length_ == b.length_ && (a.data_ == b.data_ || __self_view(a) == __self_view(b));}
+    friend bool operator==(const immutable_basic_string& a, const char_t* b) noexcept {return __self_view(a) == __self_view(b);}
+    friend bool operator==(const char_t* a, const immutable_basic_string& b) noexcept {return __self_view(a) == __self_view(b);}
+    friend bool operator==(const immutable_basic_string& a, const std::basic_string<char_t, char_traits_t, allocator_t>& b) noexcept {return __self_view(a) == __self_view(b);}
+    friend bool operator==(const std::basic_string<char_t, char_traits_t, allocator_t>& a, const immutable_basic_string& b) noexcept {return __self_view(a) == __self_view(b);}
+    friend bool operator==(const immutable_basic_string& a, __self_view b) noexcept {return __self_view(a) == b;}
+    friend bool operator==(__self_view a, const immutable_basic_string& b) noexcept {return a == __self_view(b);}
+    friend bool operator!=(const immutable_basic_string& a, const immutable_basic_string& b) noexcept {return !(a == b);}
+    friend bool operator!=(const immutable_basic_string& a, const char_t* b) noexcept {return !(a == b);}
+    friend bool operator!=(const char_t* a, const immutable_basic_string& b) noexcept {return !(a == b);}
+    friend bool operator!=(const immutable_basic_string& a, const std::basic_string<char_t, char_traits_t, allocator_t>& b) noexcept {return !(a == b);}
+    friend bool operator!=(const std::basic_string<char_t, char_traits_t, allocator_t>& a, const immutable_basic_string& b) noexcept {return !(a == b);}
+    friend bool operator!=(const immutable_basic_string& a, __self_view b) noexcept {return !(a == b);}
+    friend bool operator!=(__self_view a, const immutable_basic_string& b) noexcept {return !(a == b);}
+    friend bool operator<(const immutable_basic_string& a, const immutable_basic_string& b) noexcept {return a.compare(b) < 0;}
+    friend bool operator<=(const immutable_basic_string& a, const immutable_basic_string& b) noexcept {return a.compare(b) <= 0;}
+    friend bool operator>(const immutable_basic_string& a, const immutable_basic_string& b) noexcept {return a.compare(b) > 0;}
+    friend bool operator>=(const immutable_basic_string& a, const immutable_basic_string& b) noexcept {return a.compare(b) >= 0;}
+
+    friend std::basic_ostream<char_t, char_traits_t>& operator<<(std::basic_ostream<char_t, char_traits_t>& os, const immutable_basic_string& str) {return os << __self_view(str);}
     /// @endcond
 
   private:
-    immutable_basic_string& assign(size_t count, char_t ch );
-    void reserve(size_type new_cap);
-    void shrink_to_fit();
-    void clear();
-    immutable_basic_string& insert(size_type index, size_type count, char_t ch);
-    immutable_basic_string& erase(size_type index = 0, size_type count = npos);
-    void push_back(char_t ch);
-    void pop_back();
-    immutable_basic_string& append(size_type count, char_t ch);
-    immutable_basic_string& replace(size_type pos, size_type count, const immutable_basic_string& str);
-    void resize(size_type count);
+    // A buffer holds length characters and a null terminator after its header; it is allocated with a copy of the allocator, which frees it.
+    static buffer* create(size_t length, const allocator_t& allocator) {
+      buffer_allocator_t buffer_allocator(allocator);
+      size_t count = (sizeof(buffer) + (length + 1) * sizeof(char_t) + sizeof(buffer) - 1) / sizeof(buffer);
+      buffer* result = std::allocator_traits<buffer_allocator_t>::allocate(buffer_allocator, count);
+      new (result) buffer(length, allocator);
+      result->data()[length] = char_t();
+      return result;
+    }
+
+    static void release(buffer* value) noexcept {
+      if (!value || value->references.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+      buffer_allocator_t buffer_allocator(value->allocator);
+      size_t count = (sizeof(buffer) + (value->length + 1) * sizeof(char_t) + sizeof(buffer) - 1) / sizeof(buffer);
+      value->~buffer();
+      std::allocator_traits<buffer_allocator_t>::deallocate(buffer_allocator, value, count);
+    }
+
+    char_t* allocate(size_t length, const allocator_t& allocator) {
+      if (length == 0) return nullptr;
+      buffer_ = create(length, allocator);
+      data_ = buffer_->data();
+      length_ = length;
+      return buffer_->data();
+    }
+
+    void acquire() noexcept {
+      if (buffer_) buffer_->references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release() noexcept {release(buffer_);}
+
+    void reset() noexcept {
+      buffer_ = nullptr;
+      data_ = empty_;
+      length_ = 0;
+    }
+
+    static constexpr char_t empty_[1] {};
+    buffer* buffer_ = nullptr;
+    const char_t* data_ = empty_;
+    size_t length_ = 0;
+    mutable std::atomic<buffer*> c_str_buffer_ {nullptr};
   };
-  
+
   namespace string_literals {
     inline std::basic_string<char> operator "" _is( const char* str, size_t len ) {
       return std::basic_string<char>(str, len);
@@ -234,3 +350,10 @@ namespace xtd {
   /// @remarks It can be replaced by const std::wstring<char_t>.
   using iwstring = immutable_basic_string<wchar_t, std::char_traits<wchar_t>>;
 }
+
+/// @cond
+template<class char_t, class char_traits_t, class allocator_t>
+struct std::hash<xtd::immutable_basic_string<char_t, char_traits_t, allocator_t>> {
+  size_t operator()(const xtd::immutable_basic_string<char_t, char_traits_t, allocator_t>& str) const noexcept {return str.get_hash_code();}
+};
+/// @endcond
@@ -0,0 +1,251 @@
+/// @file
+/// @brief Contains xtd::number_reader class.
+#pragma once
+
+#include "number_styles.h"
+#include "parse.h"
+
+#include <bitset>
+#include <fstream>
+#include <iterator>
+#include <istream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Reads numbers lazily from a std::basic_istream or from a memory region, such as a memory-mapped file, without reading lines into strings.
+  /// @par Examples
+  /// @code
+  /// auto reader = xtd::number_reader<char>::from_file("values.txt");
+  /// double sum = 0;
+  /// for (auto value : reader.values<double>())
+  ///   sum += value;
+  /// @endcode
+  /// @remarks Tokens are delimited by separators; by default the white-space characters U+0009, U+000A, U+000B, U+000C, U+000D, and U+0020. Each token is converted with the same rules as xtd::parse.
+  /// @remarks The decimal point and the thousands separator are those of the locales in effect when the reader is created; they are not looked up again for each token.
+  /// @remarks Memory use is constant: a stream is read in chunks of the specified size and a token that straddles two chunks is carried to the next one.
+  template<typename char_t>
+  class number_reader {
+  public:
+    /// @brief Represents a range of values read lazily from a xtd::number_reader.
+    template<typename value_t>
+    class value_range {
+    public:
+      /// @brief Input iterator over the values of a xtd::number_reader.
+      class iterator {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = value_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_t*;
+        using reference = const value_t&;
+
+        iterator() noexcept = default;
+        explicit iterator(number_reader* reader) : reader_(reader) {++*this;}
+
+        reference operator*() const noexcept {return value_;}
+        pointer operator->() const noexcept {return &value_;}
+        iterator& operator++() {
+          if (reader_ && !reader_->read(value_)) reader_ = nullptr;
+          return *this;
+        }
+        void operator++(int) {++*this;}
+
+        bool operator==(const iterator& other) const noexcept {return reader_ == other.reader_;}
+        bool operator!=(const iterator& other) const noexcept {return !operator==(other);}
+
+      private:
+        number_reader* reader_ = nullptr;
+        value_t value_ {};
+      };
+
+      explicit value_range(number_reader& reader) noexcept : reader_(&reader) {}
+
+      iterator begin() {return iterator(reader_);}
+      iterator end() noexcept {return iterator();}
+
+    private:
+      number_reader* reader_ = nullptr;
+    };
+
+    /// @brief Initializes a new instance of the xtd::number_reader class that reads from the specified stream.
+    /// @param stream The stream to read; it must outlive the reader.
+    /// @param chunk_size The number of characters read from the stream at once.
+    explicit number_reader(std::basic_istream<char_t>& stream, size_t chunk_size = 65536) : stream_(&stream), buffer_(chunk_size == 0 ? 1 : chunk_size) {}
+
+    /// @brief Initializes a new instance of the xtd::number_reader class that reads from the specified stream with the specified number styles.
+    /// @param stream The stream to read; it must outlive the reader.
+    /// @param styles A bitwise combination of enumeration values that indicates the style elements that can be present in each token.
+    /// @param chunk_size The number of characters read from the stream at once.
+    number_reader(std::basic_istream<char_t>& stream, number_styles styles, size_t chunk_size = 65536) : number_reader(stream, chunk_size) {
+      styles_ = styles;
+      has_styles_ = true;
+    }
+
+    /// @brief Initializes a new instance of the xtd::number_reader class that reads from the specified memory region.
+    /// @param data The first character of the region; the region must outlive the reader.
+    /// @param size The number of characters of the region.
+    number_reader(const char_t* data, size_t size) noexcept : first_(data), last_(data + size) {}
+
+    /// @brief Initializes a new instance of the xtd::number_reader class that reads from the specified memory region with the specified number styles.
+    /// @param data The first character of the region; the region must outlive the reader.
+    /// @param size The number of characters of the region.
+    /// @param styles A bitwise combination of enumeration values that indicates the style elements that can be present in each token.
+    number_reader(const char_t* data, size_t size, number_styles styles) noexcept : first_(data), last_(data + size), styles_(styles), has_styles_(true) {}
+
+    /// @cond
+    number_reader(number_reader&&) = default;
+    number_reader& operator=(number_reader&&) = default;
+    number_reader(const number_reader&) = delete;
+    number_reader& operator=(const number_reader&) = delete;
+    /// @endcond
+
+    /// @brief Creates a xtd::number_reader that reads the specified file. On POSIX systems the file is memory-mapped, otherwise it is read into memory at once.
+    /// @param path The path of the file to read.
+    /// @return A new xtd::number_reader that owns the mapping or the content.
+    /// @exception std::invalid_argument The file cannot be opened, or its size is not a multiple of sizeof(char_t).
+    /// @remarks The file holds char_t code units in native byte order, without conversion by a locale: for example UTF-8 for char, or UTF-16 for char16_t on a little-endian system without byte order mark. It is read the same way on all systems.
+    static number_reader from_file(const std::string& path) {
+#if !defined(_WIN32)
+      int file = ::open(path.c_str(), O_RDONLY);
+      if (file == -1) throw std::invalid_argument("Can't open file");
+      struct stat status {};
+      if (::fstat(file, &status) == -1) {
+        ::close(file);
+        throw std::invalid_argument("Can't open file");
+      }
+      size_t size = static_cast<size_t>(status.st_size);
+      if (size % sizeof(char_t) != 0) {
+        ::close(file);
+        throw std::invalid_argument("File size is not a multiple of the character size");
+      }
+      if (size == 0) {
+        ::close(file);
+        return number_reader(static_cast<const char_t*>(nullptr), 0);
+      }
+      void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+      ::close(file);
+      if (mapping == MAP_FAILED) throw std::invalid_argument("Can't map file");
+      ::madvise(mapping, size, MADV_SEQUENTIAL);
+      number_reader reader(static_cast<const char_t*>(mapping), size / sizeof(char_t));
+      reader.mapping_ = std::shared_ptr<void>(mapping, [size](void* address) {::munmap(address, size);});
+      return reader;
+#else
+      std::ifstream stream(path, std::ios::binary | std::ios::ate);
+      if (!stream.is_open()) throw std::invalid_argument("Can't open file");
+      size_t size = static_cast<size_t>(stream.tellg());
+      if (size % sizeof(char_t) != 0) throw std::invalid_argument("File size is not a multiple of the character size");
+      auto content = std::make_shared<std::vector<char_t>>(size / sizeof(char_t));
+      stream.seekg(0);
+      if (size != 0 && !stream.read(reinterpret_cast<char*>(content->data()), static_cast<std::streamsize>(size))) throw std::invalid_argument("Can't read file");
+      number_reader reader(content->data(), content->size());
+      reader.mapping_ = std::move(content);
+      return reader;
+#endif
+    }
+
+    /// @brief Gets the separators that delimit tokens.
+    /// @return The separator characters.
+    const std::basic_string<char_t>& separators() const noexcept {return separators_;}
+    /// @brief Sets the separators that delimit tokens.
+    /// @param separators The separator characters, for example {',', '\\n'} to read comma separated values.
+    /// @return This instance.
+    number_reader& separators(const std::basic_string<char_t>& separators) {
+      separators_ = separators;
+      separator_table_ = make_separator_table(separators_);
+      return *this;
+    }
+
+    /// @brief Reads the next token without converting it.
+    /// @param token When this method returns, contains the next token; it remains valid until the next read.
+    /// @return true if a token was read; false if the end is reached.
+    bool next_token(std::basic_string_view<char_t>& token) {
+      for (;;) {
+        while (first_ != last_ && is_separator(*first_)) ++first_;
+        if (first_ != last_ || !fill()) break;
+      }
+      if (first_ == last_) return false;
+
+      const char_t* token_end = first_;
+      for (;;) {
+        while (token_end != last_ && !is_separator(*token_end)) ++token_end;
+        if (token_end != last_ || !stream_) break;
+        size_t token_size = static_cast<size_t>(token_end - first_);
+        if (!fill()) {
+          token_end = first_ + token_size;
+          break;
+        }
+        token_end = first_ + token_size;
+      }
+      token = std::basic_string_view<char_t>(first_, static_cast<size_t>(token_end - first_));
+      first_ = token_end;
+      return true;
+    }
+
+    /// @brief Reads and converts the next value.
+    /// @param value When this method returns, contains the next value, if one was read; otherwise value is unchanged.
+    /// @return true if a value was read; false if the end is reached.
+    /// @exception std::invalid_argument The token is not in the correct format.
+    /// @exception std::out_of_range The token represents a number out of the range of value_t.
+    template<typename value_t>
+    bool read(value_t& value) {
+      std::basic_string_view<char_t> token;
+      if (!next_token(token)) return false;
+      value = has_styles_ ? __parse_value<value_t>(token, styles_, punctuation_) : __parse_value<value_t>(token, punctuation_);
+      return true;
+    }
+
+    /// @brief Gets a range that reads and converts the remaining values lazily.
+    /// @return A single pass range of value_t.
+    template<typename value_t>
+    value_range<value_t> values() noexcept {return value_range<value_t>(*this);}
+
+  private:
+    static std::bitset<256> make_separator_table(const std::basic_string<char_t>& separators) noexcept {
+      std::bitset<256> table;
+      for (auto c : separators)
+        if (static_cast<size_t>(c) < table.size()) table.set(static_cast<size_t>(c));
+      return table;
+    }
+
+    bool is_separator(char_t c) const noexcept {
+      if (static_cast<size_t>(c) < separator_table_.size()) return separator_table_[static_cast<size_t>(c)];
+      return separators_.find(c) != std::basic_string<char_t>::npos;
+    }
+
+    // Moves the unread characters to the beginning of the buffer, grows it if it is full, and reads the next chunk.
+    bool fill() {
+      if (!stream_ || !stream_->good()) return false;
+      size_t remaining = static_cast<size_t>(last_ - first_);
+      if (remaining != 0 && first_ != buffer_.data()) std::char_traits<char_t>::move(buffer_.data(), first_, remaining);
+      if (remaining == buffer_.size()) buffer_.resize(buffer_.size() * 2);
+      std::streamsize count = stream_->rdbuf()->sgetn(buffer_.data() + remaining, static_cast<std::streamsize>(buffer_.size() - remaining));
+      if (count <= 0) stream_->setstate(std::ios::eofbit);
+      first_ = buffer_.data();
+      last_ = first_ + remaining + (count > 0 ? static_cast<size_t>(count) : 0);
+      return count > 0;
+    }
+
+    std::basic_istream<char_t>* stream_ = nullptr;
+    std::shared_ptr<void> mapping_;
+    std::vector<char_t> buffer_;
+    const char_t* first_ = nullptr;
+    const char_t* last_ = nullptr;
+    std::basic_string<char_t> separators_ {9, 10, 11, 12, 13, 32};
+    std::bitset<256> separator_table_ = make_separator_table(separators_);
+    number_styles styles_ = number_styles::none;
+    bool has_styles_ = false;
+    __parse_punctuation<char_t> punctuation_ = __parse_punctuation<char_t>::current();
+  };
+}
@@ -2,322 +2,525 @@
 /// @brief Contains xtd::parse methods.
 #pragma once
 
+#include "boolean_styles.h"
 #include "number_styles.h"
 #include "strings.h"
 
+/// @cond
+#define __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include "internal/__date_time_parser.h"
+#include "internal/__duration_parser.h"
+
+/// @cond
+#undef __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include <cerrno>
+#include <clocale>
+#include <cstdlib>
+#include <string_view>
+
 #undef max
 #undef min
 
 /// @cond
-template <typename char_t>
-inline std::basic_string<char_t> __parse_remove_decorations(const std::basic_string<char_t>& s, xtd::number_styles styles) {
-  std::basic_string<char_t> str(s);
-  if ((styles & xtd::number_styles::allow_leading_white) == xtd::number_styles::allow_leading_white) str = xtd::strings::trim_start(str);
-  if ((styles & xtd::number_styles::allow_trailing_white) == xtd::number_styles::allow_trailing_white) str = xtd::strings::trim_end(str);
-  if ((styles & xtd::number_styles::allow_currency_symbol) == xtd::number_styles::allow_currency_symbol && xtd::strings::starts_with(str, std::use_facet<std::moneypunct<char_t>>(std::locale()).curr_symbol())) str = xtd::strings::remove(str, 0, std::use_facet<std::moneypunct<char_t>>(std::locale()).curr_symbol().size());
-  if ((styles & xtd::number_styles::allow_currency_symbol) == xtd::number_styles::allow_currency_symbol && xtd::strings::ends_with(str, std::use_facet<std::moneypunct<char_t>>(std::locale()).curr_symbol())) str = xtd::strings::substring(str, 0, str.size() - std::use_facet<std::moneypunct<char_t>>(std::locale()).curr_symbol().size());
-  if ((styles & xtd::number_styles::allow_binary_specifier) == xtd::number_styles::allow_binary_specifier && (xtd::strings::starts_with(str, "0b") || xtd::strings::starts_with(str, "0B"))) str = xtd::strings::remove(str, 0, 2);
-  if ((styles & xtd::number_styles::allow_octal_specifier) == xtd::number_styles::allow_octal_specifier && xtd::strings::starts_with(str, '0')) str = xtd::strings::remove(str, 0, 1);
-  if ((styles & xtd::number_styles::allow_hex_specifier) == xtd::number_styles::allow_hex_specifier && (xtd::strings::starts_with(str, "0x") || xtd::strings::starts_with(str, "0X"))) str = xtd::strings::remove(str, 0, 2);
+inline bool __parse_has_style(xtd::number_styles styles, xtd::number_styles style) noexcept {return (styles & style) == style;}
+
+template<typename char_t>
+inline char_t __parse_decimal_point(const std::locale& loc) {
+  if constexpr (std::is_same<char_t, char>::value || std::is_same<char_t, wchar_t>::value) return std::use_facet<std::numpunct<char_t>>(loc).decimal_point();
+  else return static_cast<char_t>(std::use_facet<std::numpunct<wchar_t>>(loc).decimal_point());
+}
+
+template<typename char_t>
+inline char_t __parse_thousands_separator(const std::locale& loc) {
+  if constexpr (std::is_same<char_t, char>::value || std::is_same<char_t, wchar_t>::value) return std::use_facet<std::numpunct<char_t>>(loc).thousands_sep();
+  else return static_cast<char_t>(std::use_facet<std::numpunct<wchar_t>>(loc).thousands_sep());
+}
+
+// The punctuation of the current locales, resolved once per parse call, or once for all the tokens of a xtd::number_reader.
+template<typename char_t>
+struct __parse_punctuation {
+  char_t decimal_point;
+  char_t thousands_separator;
+  char c_decimal_point;
+
+  static __parse_punctuation current() {
+    std::locale loc;
+    return {__parse_decimal_point<char_t>(loc), __parse_thousands_separator<char_t>(loc), *std::localeconv()->decimal_point};
+  }
+};
+
+template<typename char_t>
+inline std::basic_string<char_t> __parse_currency_symbol(const std::locale& loc) {
+  if constexpr (std::is_same<char_t, char>::value || std::is_same<char_t, wchar_t>::value) return std::use_facet<std::moneypunct<char_t>>(loc).curr_symbol();
+  else {
+    std::wstring symbol = std::use_facet<std::moneypunct<wchar_t>>(loc).curr_symbol();
+    return std::basic_string<char_t>(symbol.begin(), symbol.end());
+  }
+}
+
+template<typename char_t>
+inline bool __parse_starts_with(std::basic_string_view<char_t> str, char a, char b = 0) noexcept {return !str.empty() && (str.front() == static_cast<char_t>(a) || (b != 0 && str.front() == static_cast<char_t>(b)));}
+
+template<typename char_t>
+inline bool __parse_ends_with(std::basic_string_view<char_t> str, char a) noexcept {return !str.empty() && str.back() == static_cast<char_t>(a);}
+
+template<typename char_t>
+inline std::basic_string_view<char_t> __parse_remove_decorations(std::basic_string_view<char_t> str, xtd::number_styles styles) {
+  if (__parse_has_style(styles, xtd::number_styles::allow_leading_white)) str = xtd::strings::trim_start_view(str);
+  if (__parse_has_style(styles, xtd::number_styles::allow_trailing_white)) str = xtd::strings::trim_end_view(str);
+  if (__parse_has_style(styles, xtd::number_styles::allow_currency_symbol)) {
+    std::basic_string<char_t> currency_symbol = __parse_currency_symbol<char_t>(std::locale());
+    if (!currency_symbol.empty() && str.substr(0, currency_symbol.size()) == currency_symbol) str.remove_prefix(currency_symbol.size());
+    if (!currency_symbol.empty() && str.size() >= currency_symbol.size() && str.substr(str.size() - currency_symbol.size()) == currency_symbol) str.remove_suffix(currency_symbol.size());
+  }
+  if (__parse_has_style(styles, xtd::number_styles::allow_binary_specifier) && __parse_starts_with(str, '0') && __parse_starts_with(str.substr(1), 'b', 'B')) str.remove_prefix(2);
+  if (__parse_has_style(styles, xtd::number_styles::allow_octal_specifier) && __parse_starts_with(str, '0')) str.remove_prefix(1);
+  if (__parse_has_style(styles, xtd::number_styles::allow_hex_specifier) && __parse_starts_with(str, '0') && __parse_starts_with(str.substr(1), 'x', 'X')) str.remove_prefix(2);
   return str;
 }
 
 template <typename char_t>
-inline int __parse_remove_signs(std::basic_string<char_t>& str, xtd::number_styles styles) {
+inline int __parse_remove_signs(std::basic_string_view<char_t>& str, xtd::number_styles styles) {
   int sign = 0;
-  
-  while ((styles & xtd::number_styles::allow_leading_sign) == xtd::number_styles::allow_leading_sign && xtd::strings::starts_with(str, "+")) {
+
+  while (__parse_has_style(styles, xtd::number_styles::allow_leading_sign) && __parse_starts_with(str, '+')) {
     if (sign != 0) throw std::invalid_argument("Format contains more than one sign");
-    str = xtd::strings::substring(str, 1, str.size()-1);
+    str.remove_prefix(1);
     sign += 1;
   }
-  
-  while ((styles & xtd::number_styles::allow_leading_sign) == xtd::number_styles::allow_leading_sign && xtd::strings::starts_with(str, "-")) {
+
+  while (__parse_has_style(styles, xtd::number_styles::allow_leading_sign) && __parse_starts_with(str, '-')) {
     if (sign != 0) throw std::invalid_argument("Format contains more than one sign");
-    str = xtd::strings::substring(str, 1, str.size()-1);
+    str.remove_prefix(1);
     sign -= 1;
   }
-  
-  while ((styles & xtd::number_styles::allow_trailing_sign) == xtd::number_styles::allow_trailing_sign && xtd::strings::ends_with(str, "+")) {
+
+  while (__parse_has_style(styles, xtd::number_styles::allow_trailing_sign) && __parse_ends_with(str, '+')) {
     if (sign != 0) throw std::invalid_argument("Format contains more than one sign");
-    str = xtd::strings::substring(str, 0, str.size()-1);
+    str.remove_suffix(1);
     sign += 1;
   }
-  
-  while ((styles & xtd::number_styles::allow_trailing_sign) == xtd::number_styles::allow_trailing_sign && xtd::strings::ends_with(str, "-")) {
+
+  while (__parse_has_style(styles, xtd::number_styles::allow_trailing_sign) && __parse_ends_with(str, '-')) {
     if (sign != 0) throw std::invalid_argument("Format contains more than one sign");
-    str = xtd::strings::substring(str, 0, str.size()-1);
+    str.remove_suffix(1);
     sign -= 1;
   }
-  
-  while ((styles & xtd::number_styles::allow_parentheses) == xtd::number_styles::allow_parentheses && xtd::strings::starts_with(str, "(") && xtd::strings::ends_with(str, ")")) {
-    str = xtd::strings::substring(str, 1, str.size()-2);
+
+  while (__parse_has_style(styles, xtd::number_styles::allow_parentheses) && __parse_starts_with(str, '(') && __parse_ends_with(str, ')')) {
+    str.remove_prefix(1);
+    str.remove_suffix(1);
     if (sign != 0) throw std::invalid_argument("Format contains more than one sign");
     sign -= 1;
   }
   return sign;
 }
 
-template <typename char_t>
-inline void __parse_check_valid_characters(const std::basic_string<char_t>& str, xtd::number_styles styles) {
-  std::basic_string<char_t> valid_characters = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
-  if ((styles & xtd::number_styles::allow_binary_specifier) == xtd::number_styles::allow_binary_specifier) valid_characters = xtd::strings::remove(valid_characters, 2);
-  if ((styles & xtd::number_styles::allow_octal_specifier) == xtd::number_styles::allow_octal_specifier) valid_characters = xtd::strings::remove(valid_characters, 7);
-  if ((styles & xtd::number_styles::allow_hex_specifier) == xtd::number_styles::allow_hex_specifier) valid_characters += std::basic_string<char_t> {'A', 'B', 'C', 'D', 'E', 'F', 'a', 'b', 'c', 'd', 'e', 'f'};
-  if ((styles & xtd::number_styles::allow_decimal_point) == xtd::number_styles::allow_decimal_point) valid_characters += std::use_facet<std::numpunct<char_t>>(std::locale()).decimal_point();
-  if ((styles & xtd::number_styles::allow_thousands) == xtd::number_styles::allow_thousands) valid_characters += std::use_facet<std::numpunct<char_t>>(std::locale()).thousands_sep();
-  if ((styles & xtd::number_styles::allow_exponent) == xtd::number_styles::allow_exponent) valid_characters += std::basic_string<char_t> {'E', 'e', '+', '-'};
-
-  for (auto c : str) {
-    if (xtd::strings::index_of(valid_characters, c) == std::basic_string<char_t>::npos)
-      throw std::invalid_argument("invalid character found");
-  }
-  
-  if ((styles & xtd::number_styles::allow_decimal_point) == xtd::number_styles::allow_decimal_point) {
-    size_t index = xtd::strings::index_of(str, std::use_facet<std::numpunct<char_t>>(std::locale()).decimal_point());
-    if (index != std::basic_string<char_t>::npos && xtd::strings::index_of(str, std::use_facet<std::numpunct<char_t>>(std::locale()).decimal_point(), index + 1) != std::basic_string<char_t>::npos)
-      throw std::invalid_argument("invalid character found");
-  }
+template<typename char_t>
+inline int __parse_digit_value(char_t c) noexcept {
+  if (c >= char_t('0') && c <= char_t('9')) return static_cast<int>(c - char_t('0'));
+  if (c >= char_t('a') && c <= char_t('f')) return static_cast<int>(c - char_t('a')) + 10;
+  if (c >= char_t('A') && c <= char_t('F')) return static_cast<int>(c - char_t('A')) + 10;
+  return -1;
+}
 
-  if ((styles & xtd::number_styles::allow_thousands) == xtd::number_styles::allow_thousands) {
-    size_t index = 1;
-    while((index = xtd::strings::index_of(str, std::use_facet<std::numpunct<char_t>>(std::locale()).thousands_sep(), index)) != std::basic_string<char_t>::npos) {
-      if (str[index - 1] == std::use_facet<std::numpunct<char_t>>(std::locale()).thousands_sep())
-        throw std::invalid_argument("invalid character found");
-      ++index;
+template <typename char_t>
+inline void __parse_check_valid_characters(std::basic_string_view<char_t> str, xtd::number_styles styles, const __parse_punctuation<char_t>& punctuation) {
+  int base = 10;
+  if (__parse_has_style(styles, xtd::number_styles::allow_binary_specifier)) base = 2;
+  if (__parse_has_style(styles, xtd::number_styles::allow_octal_specifier)) base = 8;
+  if (__parse_has_style(styles, xtd::number_styles::allow_hex_specifier)) base = 16;
+  bool allow_decimal_point = __parse_has_style(styles, xtd::number_styles::allow_decimal_point);
+  bool allow_thousands = __parse_has_style(styles, xtd::number_styles::allow_thousands);
+  bool allow_exponent = __parse_has_style(styles, xtd::number_styles::allow_exponent);
+  char_t decimal_point = punctuation.decimal_point;
+  char_t thousands_separator = punctuation.thousands_separator;
+
+  size_t decimal_point_count = 0;
+  bool sign_found = false;
+  for (size_t index = 0; index < str.size(); ++index) {
+    char_t c = str[index];
+    int digit = __parse_digit_value(c);
+    if (digit >= 0 && digit < base) continue;
+    if (allow_exponent && (c == char_t('E') || c == char_t('e'))) continue;
+    if (allow_decimal_point && c == decimal_point) {
+      if (++decimal_point_count > 1) throw std::invalid_argument("invalid character found");
+      continue;
+    }
+    if (allow_thousands && c == thousands_separator) {
+      if (index != 0 && str[index - 1] == thousands_separator) throw std::invalid_argument("invalid character found");
+      continue;
+    }
+    if (allow_exponent && (c == char_t('+') || c == char_t('-'))) {
+      if (!sign_found && (index == 0 || (str[index - 1] != char_t('e') && str[index - 1] != char_t('E')))) throw std::invalid_argument("invalid character found");
+      sign_found = true;
+      continue;
     }
+    throw std::invalid_argument("invalid character found");
   }
+}
 
-  if ((styles & xtd::number_styles::allow_exponent) == xtd::number_styles::allow_exponent) {
-    size_t index = xtd::strings::index_of_any(str, std::vector<char_t> {'+', '-'});
-    if (index != std::basic_string<char_t>::npos && str[index - 1] != 'e' && str[index - 1] != 'E')
-      throw std::invalid_argument("invalid character found");
+template <typename char_t>
+inline unsigned long long __parse_integer_digits(std::basic_string_view<char_t> str, int base, xtd::number_styles styles, const __parse_punctuation<char_t>& punctuation) {
+  char_t thousands_separator = __parse_has_style(styles, xtd::number_styles::allow_thousands) ? punctuation.thousands_separator : char_t(0);
+  unsigned long long result = 0;
+  size_t digit_count = 0;
+  for (auto c : str) {
+    if (thousands_separator != char_t(0) && c == thousands_separator && digit_count != 0) continue;
+    int digit = __parse_digit_value(c);
+    if (digit < 0 || digit >= base) break;
+    if (result > (std::numeric_limits<unsigned long long>::max() - static_cast<unsigned long long>(digit)) / static_cast<unsigned long long>(base)) throw std::out_of_range("Out of range");
+    result = result * static_cast<unsigned long long>(base) + static_cast<unsigned long long>(digit);
+    ++digit_count;
   }
+  if (digit_count == 0) throw std::invalid_argument("invalid character found");
+  return result;
 }
 
 template <typename value_t, typename char_t>
-inline value_t __parse_floating_point(const std::basic_string<char_t>& str, int sign, xtd::number_styles styles) {
-  long double result;
-  if ((styles & xtd::number_styles::allow_thousands) != xtd::number_styles::allow_thousands)
-    result = std::stold(str, nullptr);
-  else {
-    std::stringstream ss(str);
-    ss.imbue(std::locale());
-    ss >> result;
+inline value_t __parse_floating_point(std::basic_string_view<char_t> str, int sign, xtd::number_styles styles, const __parse_punctuation<char_t>& punctuation) {
+  char_t decimal_point = punctuation.decimal_point;
+  char_t thousands_separator = __parse_has_style(styles, xtd::number_styles::allow_thousands) ? punctuation.thousands_separator : char_t(0);
+  char c_decimal_point = punctuation.c_decimal_point;
+
+  char buffer[128];
+  std::string large_buffer;
+  char* first = buffer;
+  if (str.size() >= sizeof(buffer)) {
+    large_buffer.resize(str.size() + 1);
+    first = &large_buffer[0];
+  }
+  char* last = first;
+  for (auto c : str) {
+    if (thousands_separator != char_t(0) && c == thousands_separator) continue;
+    *last++ = c == decimal_point ? c_decimal_point : static_cast<char>(c);
   }
-  
+  *last = 0;
+
+  char* end = nullptr;
+  errno = 0;
+  long double result = std::strtold(first, &end);
+  if (end == first || end != last) throw std::invalid_argument("invalid character found");
+  if (errno == ERANGE) throw std::out_of_range("Out of range");
+
   result = sign < 0 ? -result : result;
-  if (result < std::numeric_limits<value_t>::min() || result > std::numeric_limits<value_t>::max()) throw std::out_of_range("Out of range");
+  if (result < std::numeric_limits<value_t>::lowest() || result > std::numeric_limits<value_t>::max()) throw std::out_of_range("Out of range");
   return static_cast<value_t>(result);
 }
 
 template <typename value_t, typename char_t>
-inline value_t __parse_signed(const std::basic_string<char_t>& str, int base, int sign, xtd::number_styles styles) {
-  long long result;
-  if ((styles & xtd::number_styles::allow_thousands) != xtd::number_styles::allow_thousands)
-    result = std::stoll(str, nullptr, base);
-  else {
-    std::stringstream ss(str);
-    ss.imbue(std::locale());
-    ss >> result;
-  }
-  
-  result = sign < 0 ? -result : result;
+inline value_t __parse_signed(std::basic_string_view<char_t> str, int base, int sign, xtd::number_styles styles, const __parse_punctuation<char_t>& punctuation) {
+  unsigned long long magnitude = __parse_integer_digits(str, base, styles, punctuation);
+  if (sign < 0 ? magnitude > static_cast<unsigned long long>(std::numeric_limits<long long>::max()) + 1ULL : magnitude > static_cast<unsigned long long>(std::numeric_limits<long long>::max())) throw std::out_of_range("Out of range");
+  long long result = sign < 0 ? static_cast<long long>(0ULL - magnitude) : static_cast<long long>(magnitude);
   if (result < std::numeric_limits<value_t>::min() || result > std::numeric_limits<value_t>::max()) throw std::out_of_range("Out of range");
   return static_cast<value_t>(result);
 }
 
 template <typename value_t, typename char_t>
-inline value_t __parse_unsigned(const std::basic_string<char_t>& str, int base, xtd::number_styles styles) {
-  unsigned long long result = 0;
-  if ((styles & xtd::number_styles::allow_thousands) != xtd::number_styles::allow_thousands)
-    result = std::stoull(str, nullptr, base);
-  else{
-    std::stringstream ss(str);
-    ss.imbue(std::locale());
-    ss >> result;
-  }
-  
+inline value_t __parse_unsigned(std::basic_string_view<char_t> str, int base, xtd::number_styles styles, const __parse_punctuation<char_t>& punctuation) {
+  unsigned long long result = __parse_integer_digits(str, base, styles, punctuation);
   if (result > std::numeric_limits<value_t>::max()) throw std::out_of_range("Out of range");
   return static_cast<value_t>(result);
 }
 
 template <typename value_t, typename char_t>
-inline value_t __parse_floating_point_number(const std::basic_string<char_t>& s, xtd::number_styles styles) {
-  if ((styles & xtd::number_styles::binary_number) == xtd::number_styles::binary_number) throw std::invalid_argument("xtd::number_styles::binary_number not supported by floating point");
-  if ((styles & xtd::number_styles::octal_number) == xtd::number_styles::octal_number) throw std::invalid_argument("xtd::number_styles::octal_number not supported by floating point");
-  if ((styles & xtd::number_styles::hex_number) == xtd::number_styles::hex_number) throw std::invalid_argument("xtd::number_styles::hex_number not supported by floating point");
+inline value_t __parse_floating_point_number(std::basic_string_view<char_t> s, xtd::number_styles styles, const __parse_punctuation<char_t>& punctuation) {
+  if (__parse_has_style(styles, xtd::number_styles::binary_number)) throw std::invalid_argument("xtd::number_styles::binary_number not supported by floating point");
+  if (__parse_has_style(styles, xtd::number_styles::octal_number)) throw std::invalid_argument("xtd::number_styles::octal_number not supported by floating point");
+  if (__parse_has_style(styles, xtd::number_styles::hex_number)) throw std::invalid_argument("xtd::number_styles::hex_number not supported by floating point");
 
-  std::basic_string<char_t> str = __parse_remove_decorations(s, styles);
+  std::basic_string_view<char_t> str = __parse_remove_decorations(s, styles);
   int sign = __parse_remove_signs(str, styles);
-  
-  __parse_check_valid_characters(str, styles);
-  
-  return __parse_floating_point<value_t>(str, sign, styles);
+
+  __parse_check_valid_characters(str, styles, punctuation);
+
+  return __parse_floating_point<value_t>(str, sign, styles, punctuation);
+}
+
+inline int __parse_base(xtd::number_styles styles) {
+  if (__parse_has_style(styles, xtd::number_styles::allow_binary_specifier) && (styles - xtd::number_styles::binary_number) != xtd::number_styles::none) throw std::invalid_argument("Invalid xtd::number_styles flags");
+  if (__parse_has_style(styles, xtd::number_styles::allow_octal_specifier) && (styles - xtd::number_styles::octal_number) != xtd::number_styles::none) throw std::invalid_argument("Invalid xtd::number_styles flags");
+  if (__parse_has_style(styles, xtd::number_styles::allow_hex_specifier) && (styles - xtd::number_styles::hex_number) != xtd::number_styles::none) throw std::invalid_argument("Invalid xtd::number_styles flags");
+
+  if (__parse_has_style(styles, xtd::number_styles::binary_number)) return 2;
+  if (__parse_has_style(styles, xtd::number_styles::octal_number)) return 8;
+  if (__parse_has_style(styles, xtd::number_styles::hex_number)) return 16;
+  return 10;
 }
 
 template <typename value_t, typename char_t>
-inline value_t __parse_number(const std::basic_string<char_t>& s, xtd::number_styles styles) {
-  if ((styles & xtd::number_styles::allow_binary_specifier) == xtd::number_styles::allow_binary_specifier && (styles - xtd::number_styles::binary_number) != xtd::number_styles::none) throw std::invalid_argument("Invalid xtd::number_styles flags");
-  if ((styles & xtd::number_styles::allow_octal_specifier) == xtd::number_styles::allow_octal_specifier && (styles - xtd::number_styles::octal_number) != xtd::number_styles::none) throw std::invalid_argument("Invalid xtd::number_styles flags");
-  if ((styles & xtd::number_styles::allow_hex_specifier) == xtd::number_styles::allow_hex_specifier && (styles - xtd::number_styles::hex_number) != xtd::number_styles::none) throw std::invalid_argument("Invalid xtd::number_styles flags");
-  
-  int base = 10;
-  if ((styles & xtd::number_styles::binary_number) == xtd::number_styles::binary_number) base = 2;
-  if ((styles & xtd::number_styles::octal_number) == xtd::number_styles::octal_number) base = 8;
-  if ((styles & xtd::number_styles::hex_number) == xtd::number_styles::hex_number) base = 16;
-  
-  std::basic_string<char_t> str = __parse_remove_decorations(s, styles);
+inline value_t __parse_number(std::basic_string_view<char_t> s, xtd::number_styles styles, const __parse_punctuation<char_t>& punctuation) {
+  int base = __parse_base(styles);
+
+  std::basic_string_view<char_t> str = __parse_remove_decorations(s, styles);
   int sign = __parse_remove_signs(str, styles);
-  
-  __parse_check_valid_characters(str, styles);
-  
-  if (std::is_floating_point<value_t>::value || (styles & xtd::number_styles::allow_exponent) == xtd::number_styles::allow_exponent) return __parse_floating_point<value_t>(str, sign, styles);
-  return __parse_signed<value_t>(str, base, sign, styles);
+
+  __parse_check_valid_characters(str, styles, punctuation);
+
+  if (std::is_floating_point<value_t>::value || __parse_has_style(styles, xtd::number_styles::allow_exponent)) return __parse_floating_point<value_t>(str, sign, styles, punctuation);
+  return __parse_signed<value_t>(str, base, sign, styles, punctuation);
 }
 
 template <typename value_t, typename char_t>
-inline value_t __parse_unsigned_number(const std::basic_string<char_t>& s, xtd::number_styles styles) {
-  if ((styles & xtd::number_styles::allow_binary_specifier) == xtd::number_styles::allow_binary_specifier && (styles - xtd::number_styles::binary_number) != xtd::number_styles::none) throw std::invalid_argument("Invalid xtd::number_styles flags");
-  if ((styles & xtd::number_styles::allow_octal_specifier) == xtd::number_styles::allow_octal_specifier && (styles - xtd::number_styles::octal_number) != xtd::number_styles::none) throw std::invalid_argument("Invalid xtd::number_styles flags");
-  if ((styles & xtd::number_styles::allow_hex_specifier) == xtd::number_styles::allow_hex_specifier && (styles - xtd::number_styles::hex_number) != xtd::number_styles::none) throw std::invalid_argument("Invalid xtd::number_styles flags");
-  
-  int base = 10;
-  if ((styles & xtd::number_styles::binary_number) == xtd::number_styles::binary_number) base = 2;
-  if ((styles & xtd::number_styles::octal_number) == xtd::number_styles::octal_number) base = 8;
-  if ((styles & xtd::number_styles::hex_number) == xtd::number_styles::hex_number) base = 16;
-  
-  std::basic_string<char_t> str = __parse_remove_decorations(s, styles);
+inline value_t __parse_unsigned_number(std::basic_string_view<char_t> s, xtd::number_styles styles, const __parse_punctuation<char_t>& punctuation) {
+  int base = __parse_base(styles);
+
+  std::basic_string_view<char_t> str = __parse_remove_decorations(s, styles);
   if (__parse_remove_signs(str, styles) < 0) throw std::invalid_argument("unsigned type can't have minus sign");
-  
-  __parse_check_valid_characters(str, styles);
-  
-  if ((styles & xtd::number_styles::allow_exponent) == xtd::number_styles::allow_exponent) return __parse_floating_point<value_t>(str, 0, styles);
-  return __parse_unsigned<value_t>(str, base, styles);
+
+  __parse_check_valid_characters(str, styles, punctuation);
+
+  if (__parse_has_style(styles, xtd::number_styles::allow_exponent)) return __parse_floating_point<value_t>(str, 0, styles, punctuation);
+  return __parse_unsigned<value_t>(str, base, styles, punctuation);
+}
+
+template <typename char_t>
+inline bool __parse_equals_ignore_case(std::basic_string_view<char_t> str, const char* value) noexcept {
+  size_t index = 0;
+  for (; value[index] != 0; ++index) {
+    if (index == str.size()) return false;
+    char_t c = str[index];
+    if (c >= char_t('A') && c <= char_t('Z')) c = static_cast<char_t>(c - char_t('A') + char_t('a'));
+    if (c != static_cast<char_t>(value[index])) return false;
+  }
+  return index == str.size();
+}
+
+template <typename char_t>
+inline bool __try_parse_boolean(std::basic_string_view<char_t> str, bool& value, xtd::boolean_styles styles) noexcept {
+  if ((styles & xtd::boolean_styles::allow_leading_white) == xtd::boolean_styles::allow_leading_white) str = xtd::strings::trim_start_view(str);
+  if ((styles & xtd::boolean_styles::allow_trailing_white) == xtd::boolean_styles::allow_trailing_white) str = xtd::strings::trim_end_view(str);
+
+  if (__parse_equals_ignore_case(str, "true")) value = true;
+  else if (__parse_equals_ignore_case(str, "false")) value = false;
+  else if ((styles & xtd::boolean_styles::allow_numeric) == xtd::boolean_styles::allow_numeric && str.size() == 1 && (str[0] == char_t('1') || str[0] == char_t('0'))) value = str[0] == char_t('1');
+  else if ((styles & xtd::boolean_styles::allow_yes_no) == xtd::boolean_styles::allow_yes_no && (__parse_equals_ignore_case(str, "yes") || __parse_equals_ignore_case(str, "no"))) value = str.size() == 3;
+  else if ((styles & xtd::boolean_styles::allow_on_off) == xtd::boolean_styles::allow_on_off && (__parse_equals_ignore_case(str, "on") || __parse_equals_ignore_case(str, "off"))) value = str.size() == 2;
+  else return false;
+  return true;
+}
+
+template <typename char_t>
+inline bool __parse_boolean(std::basic_string_view<char_t> str, xtd::boolean_styles styles) {
+  bool value = false;
+  if (!__try_parse_boolean(str, value, styles)) throw std::invalid_argument("Invalid string format");
+  return value;
+}
+
+template<typename value_t>
+struct __is_parse_number : std::integral_constant<bool, std::is_arithmetic<value_t>::value && !std::is_same<value_t, bool>::value && !std::is_same<value_t, wchar_t>::value && !std::is_same<value_t, char16_t>::value && !std::is_same<value_t, char32_t>::value> {};
+
+template<typename value_t, typename char_t>
+inline value_t __parse_value(std::basic_string_view<char_t> str, xtd::number_styles styles, const __parse_punctuation<char_t>& punctuation) {
+  if constexpr (!__is_parse_number<value_t>::value) throw std::invalid_argument("Parse speciailisation not found");
+  else if constexpr (std::is_floating_point<value_t>::value) return __parse_floating_point_number<value_t>(str, styles, punctuation);
+  else if constexpr (std::is_unsigned<value_t>::value) return __parse_unsigned_number<value_t>(str, styles, punctuation);
+  else return __parse_number<value_t>(str, styles, punctuation);
+}
+
+template<typename value_t, typename char_t>
+inline value_t __parse_value(std::basic_string_view<char_t> str, xtd::number_styles styles) {return __parse_value<value_t>(str, styles, __parse_punctuation<char_t>::current());}
+
+template<typename value_t, typename char_t>
+inline value_t __parse_value(std::basic_string_view<char_t> str) {
+  if constexpr (std::is_same<value_t, bool>::value) return __parse_boolean(str, xtd::boolean_styles::boolean);
+  else if constexpr (std::is_same<value_t, std::basic_string<char_t>>::value) return value_t(str);
+  else if constexpr (__is_duration<value_t>::value) return __duration_parser<value_t>(str, std::basic_string_view<char_t>());
+  else if constexpr (std::is_floating_point<value_t>::value) return __parse_value<value_t>(str, xtd::number_styles::fixed_point);
+  else if constexpr (__is_parse_number<value_t>::value) return __parse_value<value_t>(str, xtd::number_styles::integer);
+  else throw std::invalid_argument("Parse speciailisation not found");
+}
+
+template<typename value_t, typename char_t>
+inline value_t __parse_value(std::basic_string_view<char_t> str, const __parse_punctuation<char_t>& punctuation) {
+  if constexpr (std::is_floating_point<value_t>::value) return __parse_value<value_t>(str, xtd::number_styles::fixed_point, punctuation);
+  else if constexpr (__is_parse_number<value_t>::value) return __parse_value<value_t>(str, xtd::number_styles::integer, punctuation);
+  else return __parse_value<value_t>(str);
+}
+
+template<typename value_t, typename char_t>
+inline value_t __parse_value(std::basic_string_view<char_t> str, std::basic_string_view<char_t> fmt) {
+  if constexpr (std::is_same<value_t, std::chrono::system_clock::time_point>::value) return __date_time_parse_time_point(str, fmt);
+  else if constexpr (std::is_same<value_t, std::tm>::value) return __date_time_parse_tm(str, fmt);
+  else if constexpr (__is_duration<value_t>::value) return __duration_parser<value_t>(str, fmt);
+  else throw std::invalid_argument("Parse speciailisation not found");
+}
+
+template<typename value_t, typename char_t>
+inline value_t __parse_value(std::basic_string_view<char_t> str, xtd::boolean_styles styles) {
+  if constexpr (std::is_same<value_t, bool>::value) return __parse_boolean(str, styles);
+  else throw std::invalid_argument("Parse speciailisation not found");
 }
 /// @endcond
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
+  /// @brief Converts the string to its value_t equivalent.
+  /// @param str A string that contains a value to convert.
+  /// @return The value_t equivalent of the value contained in str.
+  /// @exception std::invalid_argument str is not in the correct format or value_t is not supported.
+  /// @exception std::out_of_range str represents a number out of the range of value_t.
+  /// @remarks Integral types use xtd::number_styles::integer, floating point types use xtd::number_styles::fixed_point.
+  template<typename value_t>
+  inline value_t parse(const std::string& str) {return __parse_value<value_t>(std::string_view(str));}
+
+  /// @brief Converts the string to its value_t equivalent using the specified format.
+  /// @param str A string that contains a value to convert.
+  /// @param fmt A format letter as used by xtd::to_string and xtd::strings::format for the same value_t.
+  /// @return The value_t equivalent of the value contained in str.
+  /// @exception std::invalid_argument str does not match fmt, fmt is not valid or value_t is not supported.
+  /// @exception std::out_of_range a field of str is out of its range.
+  /// @remarks std::chrono::system_clock::time_point and std::tm support the date time letters 'd', 'D', 'f', 'F', 'g', 'G', 'n', 'N', 'o', 'O', 's', 't', 'T', 'u', 'U', 'v' and 'V'. Month and weekday names are the English full or abbreviated names; a weekday name must be the day of the week of the parsed date.
+  /// @remarks std::chrono::duration supports the letters 'c', 'f', 'F', 'g' and 'G'; without format, 'G' is used.
+  /// @remarks 's' and 'u' accept ISO-8601 fractional seconds and 'Z' or "+hh:mm" offsets; 'N' and 'U' accept a trailing offset or "GMT", which makes them accept RFC-1123. A time without offset is a local time.
+  template<typename value_t>
+  inline value_t parse(const std::string& str, const std::string& fmt) {return __parse_value<value_t>(std::string_view(str), std::string_view(fmt));}
+
   template<typename value_t>
-  inline value_t parse(const std::string& str) {throw std::invalid_argument("Parse speciailisation not found");}
+  inline value_t parse(const std::wstring& str, const std::wstring& fmt) {return __parse_value<value_t>(std::wstring_view(str), std::wstring_view(fmt));}
 
   template<typename value_t>
-  inline value_t parse(const std::string& str, const std::string& fmt) {throw std::invalid_argument("Parse speciailisation not found");}
+  inline value_t parse(const std::u16string& str, const std::u16string& fmt) {return __parse_value<value_t>(std::u16string_view(str), std::u16string_view(fmt));}
 
-  template<>
-  inline std::string parse<std::string>(const std::string& str) {return str;}
+  template<typename value_t>
+  inline value_t parse(const std::u32string& str, const std::u32string& fmt) {return __parse_value<value_t>(std::u32string_view(str), std::u32string_view(fmt));}
+
+  /// @brief Converts the string to its value_t equivalent using the specified number styles.
+  /// @param str A string that contains a value to convert.
+  /// @param styles A bitwise combination of enumeration values that indicates the style elements that can be present in str.
+  /// @return The value_t equivalent of the value contained in str.
+  /// @exception std::invalid_argument str is not in a format compliant with styles or value_t is not supported.
+  /// @exception std::out_of_range str represents a number out of the range of value_t.
+  template<typename value_t>
+  inline value_t parse(const std::string& str, number_styles styles) {return __parse_value<value_t>(std::string_view(str), styles);}
+
+  /// @brief Converts the string to its bool equivalent using the specified boolean styles.
+  /// @param str A string that contains a value to convert.
+  /// @param styles A bitwise combination of enumeration values that indicates the spellings and white spaces that can be present in str.
+  /// @return The bool equivalent of the value contained in str.
+  /// @exception std::invalid_argument str is not in a format compliant with styles or value_t is not bool.
+  /// @remarks The comparison is case insensitive and does not allocate.
+  template<typename value_t>
+  inline value_t parse(const std::string& str, boolean_styles styles) {return __parse_value<value_t>(std::string_view(str), styles);}
 
   template<typename value_t>
-  inline value_t parse(const std::string& str, number_styles) {throw std::invalid_argument("Parse speciailisation not found");}
-  
-  template<>
-  inline int8_t parse<int8_t>(const std::string& str, number_styles styles) {return __parse_number<int8_t>(str, styles);}
-  
-  template<>
-  inline char parse<char>(const std::string& str, number_styles styles) {return __parse_number<char>(str, styles);}
-  
-  template<>
-  inline unsigned char parse<unsigned char>(const std::string& str, number_styles styles) {return __parse_unsigned_number<unsigned char>(str, styles);}
-  
-  template<>
-  inline short parse<short>(const std::string& str, number_styles styles) {return __parse_number<short>(str, styles);}
-  
-  template<>
-  inline unsigned short parse<unsigned short>(const std::string& str, number_styles styles) {return __parse_unsigned_number<unsigned short>(str, styles);}
-
-  template<>
-  inline int parse<int>(const std::string& str, number_styles styles) {return __parse_number<int>(str, styles);}
-  
-  template<>
-  inline unsigned int parse<unsigned int>(const std::string& str, number_styles styles) {return __parse_unsigned_number<unsigned int>(str, styles);}
-
-  template<>
-  inline long parse<long>(const std::string& str, number_styles styles) {return __parse_number<long>(str, styles);}
-  
-  template<>
-  inline unsigned long parse<unsigned long>(const std::string& str, number_styles styles) {return __parse_unsigned_number<unsigned long>(str, styles);}
-
-  template<>
-  inline long long parse<long long>(const std::string& str, number_styles styles) {return __parse_number<long long>(str, styles);}
-  
-  template<>
-  inline unsigned long long parse<unsigned long long>(const std::string& str, number_styles styles) {return __parse_unsigned_number<unsigned long long>(str, styles);}
-
-  template<>
-  inline float parse<float>(const std::string& str, number_styles styles) {return __parse_floating_point_number<float>(str, styles);}
-
-  template<>
-  inline double parse<double>(const std::string& str, number_styles styles) {return __parse_floating_point_number<double>(str, styles);}
-
-  template<>
-  inline long double parse<long double>(const std::string& str, number_styles styles) {return __parse_floating_point_number<long double>(str, styles);}
-
-  template<>
-  inline int8_t parse<int8_t>(const std::string& str) {return parse<int8_t>(str, number_styles::integer);}
-  
-  template<>
-  inline char parse<char>(const std::string& str) {return parse<char>(str, number_styles::integer);}
-  
-  template<>
-  inline unsigned char parse<unsigned char>(const std::string& str) {return parse<unsigned char>(str, number_styles::integer);}
-
-  template<>
-  inline short parse<short>(const std::string& str) {return parse<short>(str, number_styles::integer);}
-  
-  template<>
-  inline unsigned short parse<unsigned short>(const std::string& str) {return parse<unsigned short>(str, number_styles::integer);}
-
-  template<>
-  inline int parse<int>(const std::string& str) {return parse<int>(str, number_styles::integer);}
-  
-  template<>
-  inline unsigned int parse<unsigned int>(const std::string& str) {return parse<unsigned int>(str, number_styles::integer);}
-
-  template<>
-  inline long parse<long>(const std::string& str) {return parse<long>(str, number_styles::integer);}
-  
-  template<>
-  inline unsigned long parse<unsigned long>(const std::string& str) {return parse<unsigned long>(str, number_styles::integer);}
-
-  template<>
-  inline long long parse<long long>(const std::string& str) {return parse<long long>(str, number_styles::integer);}
-
-  template<>
-  inline unsigned long long parse<unsigned long long>(const std::string& str) {return parse<unsigned long long>(str, number_styles::integer);}
-
-  template<>
-  inline float parse<float>(const std::string& str) {return parse<float>(str, number_styles::fixed_point);}
-
-  template<>
-  inline double parse<double>(const std::string& str) {return parse<double>(str, number_styles::fixed_point);}
-
-  template<>
-  inline long double parse<long double>(const std::string& str) {return parse<long double>(str, number_styles::fixed_point);}
-
-  template<>
-  inline bool parse<bool>(const std::string& str) {
-    if (xtd::strings::trim(xtd::strings::to_lower(str)) != "true" && xtd::strings::trim(xtd::strings::to_lower(str)) != "1" && xtd::strings::trim(xtd::strings::to_lower(str)) != "false" && xtd::strings::trim(xtd::strings::to_lower(str)) != "0")  throw std::invalid_argument("Invalid string format");
-    return xtd::strings::trim(xtd::strings::to_lower(str)) == "true" || xtd::strings::trim(xtd::strings::to_lower(str)) == "1";
-  }
+  inline value_t parse(const std::wstring& str) {return __parse_value<value_t>(std::wstring_view(str));}
+
+  template<typename value_t>
+  inline value_t parse(const std::wstring& str, number_styles styles) {return __parse_value<value_t>(std::wstring_view(str), styles);}
+
+  template<typename value_t>
+  inline value_t parse(const std::wstring& str, boolean_styles styles) {return __parse_value<value_t>(std::wstring_view(str), styles);}
 
   template<typename value_t>
-  inline value_t parse(const std::wstring& str) {throw std::invalid_argument("Parse speciailisation not found");}
+  inline value_t parse(const std::u16string& str) {return __parse_value<value_t>(std::u16string_view(str));}
 
   template<typename value_t>
-  inline value_t parse(const std::u16string& str) {throw std::invalid_argument("Parse speciailisation not found");}
+  inline value_t parse(const std::u16string& str, number_styles styles) {return __parse_value<value_t>(std::u16string_view(str), styles);}
 
   template<typename value_t>
-  inline value_t parse(const std::u32string& str) {throw std::invalid_argument("Parse speciailisation not found");}
+  inline value_t parse(const std::u16string& str, boolean_styles styles) {return __parse_value<value_t>(std::u16string_view(str), styles);}
+
+  template<typename value_t>
+  inline value_t parse(const std::u32string& str) {return __parse_value<value_t>(std::u32string_view(str));}
+
+  template<typename value_t>
+  inline value_t parse(const std::u32string& str, number_styles styles) {return __parse_value<value_t>(std::u32string_view(str), styles);}
+
+  template<typename value_t>
+  inline value_t parse(const std::u32string& str, boolean_styles styles) {return __parse_value<value_t>(std::u32string_view(str), styles);}
+
+  /// @cond
+  template<typename value_t, typename char_t>
+  inline value_t parse(std::basic_string_view<char_t> str) {return __parse_value<value_t>(str);}
+
+  template<typename value_t, typename char_t>
+  inline value_t parse(std::basic_string_view<char_t> str, number_styles styles) {return __parse_value<value_t>(str, styles);}
+
+  template<typename value_t, typename char_t>
+  inline value_t parse(std::basic_string_view<char_t> str, boolean_styles styles) {return __parse_value<value_t>(str, styles);}
+
+  template<typename value_t, typename char_t>
+  inline value_t parse(std::basic_string_view<char_t> str, std::basic_string_view<char_t> fmt) {return __parse_value<value_t>(str, fmt);}
+
+  template<typename value_t, typename char_t>
+  inline value_t parse(const char_t* str, const char_t* fmt) {return __parse_value<value_t>(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(fmt));}
+
+  template<typename value_t, typename char_t>
+  inline value_t parse(const char_t* str) {return __parse_value<value_t>(std::basic_string_view<char_t>(str));}
 
   template<typename value_t, typename char_t>
-  inline bool try_parse(const std::basic_string<char_t>& str, value_t& value) {
+  inline value_t parse(const char_t* str, number_styles styles) {return __parse_value<value_t>(std::basic_string_view<char_t>(str), styles);}
+
+  template<typename value_t, typename char_t>
+  inline value_t parse(const char_t* str, boolean_styles styles) {return __parse_value<value_t>(std::basic_string_view<char_t>(str), styles);}
+  /// @endcond
+
+  /// @cond
+  template<typename value_t, typename char_t>
+  inline bool try_parse(std::basic_string_view<char_t> str, value_t& value) {
+    if constexpr (std::is_same<value_t, bool>::value) return __try_parse_boolean(str, value, boolean_styles::boolean);
+    if constexpr (__is_duration<value_t>::value) return __duration_try_parse(str, std::basic_string_view<char_t>(), value);
     try {
-      value = parse<value_t>(str);
+      value = __parse_value<value_t>(str);
       return true;
     } catch(...) {
       return false;
     }
   }
-}
 
+  template<typename value_t, typename char_t>
+  inline bool try_parse(std::basic_string_view<char_t> str, value_t& value, number_styles styles) {
+    try {
+      value = __parse_value<value_t>(str, styles);
+      return true;
+    } catch(...) {
+      return false;
+    }
+  }
+
+  template<typename value_t, typename char_t>
+  inline bool try_parse(std::basic_string_view<char_t> str, value_t& value, boolean_styles styles) {
+    static_assert(std::is_same<value_t, bool>::value, "xtd::boolean_styles can only be used to parse bool");
+    return __try_parse_boolean(str, value, styles);
+  }
+
+  template<typename value_t, typename char_t>
+  inline bool try_parse(const char_t* str, value_t& value) {return try_parse(std::basic_string_view<char_t>(str), value);}
+
+  template<typename value_t, typename char_t>
+  inline bool try_parse(const char_t* str, value_t& value, number_styles styles) {return try_parse(std::basic_string_view<char_t>(str), value, styles);}
+
+  template<typename value_t, typename char_t>
+  inline bool try_parse(const char_t* str, value_t& value, boolean_styles styles) {return try_parse(std::basic_string_view<char_t>(str), value, styles);}
+  /// @endcond
+
+  /// @brief Converts the string to its value_t equivalent. A return value indicates whether the conversion succeeded or failed.
+  /// @param str A string that contains a value to convert.
+  /// @param value When this method returns, contains the value_t equivalent of the value contained in str, if the conversion succeeded; otherwise value is unchanged.
+  /// @return true if str was converted successfully; otherwise, false.
+  template<typename value_t, typename char_t>
+  inline bool try_parse(const std::basic_string<char_t>& str, value_t& value) {return try_parse(std::basic_string_view<char_t>(str), value);}
+
+  /// @brief Converts the string to its value_t equivalent using the specified number styles. A return value indicates whether the conversion succeeded or failed.
+  /// @param str A string that contains a value to convert.
+  /// @param value When this method returns, contains the value_t equivalent of the value contained in str, if the conversion succeeded; otherwise value is unchanged.
+  /// @param styles A bitwise combination of enumeration values that indicates the style elements that can be present in str.
+  /// @return true if str was converted successfully; otherwise, false.
+  template<typename value_t, typename char_t>
+  inline bool try_parse(const std::basic_string<char_t>& str, value_t& value, number_styles styles) {return try_parse(std::basic_string_view<char_t>(str), value, styles);}
+
+  /// @brief Converts the string to its bool equivalent using the specified boolean styles. A return value indicates whether the conversion succeeded or failed.
+  /// @param str A string that contains a value to convert.
+  /// @param value When this method returns, contains the bool equivalent of the value contained in str, if the conversion succeeded; otherwise value is unchanged.
+  /// @param styles A bitwise combination of enumeration values that indicates the spellings and white spaces that can be present in str.
+  /// @return true if str was converted successfully; otherwise, false.
+  /// @remarks Neither allocates nor throws.
+  template<typename value_t, typename char_t>
+  inline bool try_parse(const std::basic_string<char_t>& str, value_t& value, boolean_styles styles) {return try_parse(std::basic_string_view<char_t>(str), value, styles);}
+}
@@ -0,0 +1,199 @@
+/// @file
+/// @brief Contains xtd::pattern_set class.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Represents a set of patterns compiled into an Aho-Corasick automaton, so that a string is searched for all of them in a single pass.
+  /// @par Examples
+  /// @code
+  /// static const xtd::pattern_set<char> keywords {{"timeout", "refused", "segfault"}, true};
+  /// for (const auto& line : lines)
+  ///   if (keywords.contains_any(line)) alerts.push_back(line);
+  /// @endcode
+  /// @remarks The cost of a search depends on the length of the searched string and on the number of matches, not on the number of patterns.
+  /// @remarks Characters are first mapped to the classes of the characters that appear in the patterns, so that the transition table is dense: one row of classes per state.
+  /// @remarks When case is ignored, only the ASCII letters are folded. Empty patterns are ignored.
+  template<typename char_t>
+  class pattern_set {
+  public:
+    /// @brief Represents the value used when no pattern is found.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /// @brief Represents an occurrence of a pattern.
+    struct match {
+      /// @brief The index of the first character of the occurrence; or xtd::pattern_set::npos if there is no occurrence.
+      size_t index = npos;
+      /// @brief The length of the occurrence.
+      size_t length = 0;
+      /// @brief The index of the pattern in patterns(); or xtd::pattern_set::npos if there is no occurrence.
+      size_t pattern = npos;
+    };
+
+    /// @brief Initializes a new empty instance of the xtd::pattern_set class.
+    pattern_set() = default;
+
+    /// @brief Initializes a new instance of the xtd::pattern_set class with the specified patterns.
+    /// @param patterns The patterns to seek.
+    /// @param ignore_case true to ignore the case of the ASCII letters; otherwise, false.
+    explicit pattern_set(const std::vector<std::basic_string<char_t>>& patterns, bool ignore_case = false) : patterns_(patterns), ignore_case_(ignore_case) {compile();}
+
+    /// @brief Gets the patterns of this instance, in the order they were specified.
+    /// @return The patterns.
+    const std::vector<std::basic_string<char_t>>& patterns() const noexcept {return patterns_;}
+
+    /// @brief Gets a value indicating whether the case of the ASCII letters is ignored.
+    /// @return true if the case of the ASCII letters is ignored; otherwise, false.
+    bool ignore_case() const noexcept {return ignore_case_;}
+
+    /// @brief Determines whether any pattern occurs within the specified string.
+    /// @param str The string to search.
+    /// @return true if at least one pattern occurs within str; otherwise, false.
+    bool contains_any(std::basic_string_view<char_t> str) const noexcept {
+      uint32_t state = 0;
+      for (auto c : str)
+        if (first_outputs_[state = transitions_[state * class_count_ + class_of(c)]] != 0) return true;
+      return false;
+    }
+
+    /// @brief Reports the leftmost occurrence of any pattern in the specified string.
+    /// @param str The string to search.
+    /// @param start_index The search starting position.
+    /// @return The leftmost occurrence, the longest one if several patterns start at the same index; or a match whose index is xtd::pattern_set::npos if there is none.
+    match index_of_any(std::basic_string_view<char_t> str, size_t start_index = 0) const noexcept {
+      match result;
+      uint32_t state = 0;
+      for (size_t index = start_index; index < str.size(); ++index) {
+        state = transitions_[state * class_count_ + class_of(str[index])];
+        for (uint32_t output = first_outputs_[state]; output != 0; output = next_outputs_[output]) {
+          size_t length = lengths_[patterns_of_state_[output]];
+          size_t first = index + 1 - length;
+          if (first < result.index || (first == result.index && length > result.length)) result = {first, length, patterns_of_state_[output]};
+        }
+        // No occurrence that ends further can start before the one found.
+        if (result.index != npos && index + 1 >= result.index + max_length_) break;
+      }
+      return result;
+    }
+
+    /// @brief Calls the specified function for each occurrence of any pattern in the specified string, in the order the occurrences end.
+    /// @param str The string to search.
+    /// @param on_match The function to call with each xtd::pattern_set::match. If it returns a bool, false stops the search.
+    /// @remarks Overlapping occurrences are all reported; occurrences that end at the same index are reported from the longest to the shortest.
+    template<typename function_t>
+    void for_each_match(std::basic_string_view<char_t> str, function_t&& on_match) const {
+      uint32_t state = 0;
+      for (size_t index = 0; index < str.size(); ++index) {
+        state = transitions_[state * class_count_ + class_of(str[index])];
+        for (uint32_t output = first_outputs_[state]; output != 0; output = next_outputs_[output]) {
+          size_t length = lengths_[patterns_of_state_[output]];
+          match occurrence {index + 1 - length, length, patterns_of_state_[output]};
+          if constexpr (std::is_same<decltype(on_match(occurrence)), bool>::value) {
+            if (!on_match(occurrence)) return;
+          } else on_match(occurrence);
+        }
+      }
+    }
+
+  private:
+    using unsigned_char_t = typename std::make_unsigned<char_t>::type;
+
+    char_t fold(char_t c) const noexcept {return ignore_case_ && c >= char_t('A') && c <= char_t('Z') ? static_cast<char_t>(c + ('a' - 'A')) : c;}
+
+    uint32_t class_of(char_t c) const noexcept {
+      auto code = static_cast<unsigned_char_t>(c);
+      if (code < 256) return byte_classes_[code];
+      auto iterator = std::lower_bound(wide_values_.begin(), wide_values_.end(), c);
+      return iterator != wide_values_.end() && *iterator == c ? wide_classes_[static_cast<size_t>(iterator - wide_values_.begin())] : 0;
+    }
+
+    void compile() {
+      // Characters of the patterns get classes from 1; every other character is class 0.
+      for (const auto& pattern : patterns_) {
+        for (auto c : pattern) {
+          c = fold(c);
+          auto code = static_cast<unsigned_char_t>(c);
+          if (code < 256) {
+            if (byte_classes_[code] == 0) byte_classes_[code] = class_count_++;
+          } else if (!std::binary_search(wide_values_.begin(), wide_values_.end(), c)) {
+            auto position = std::lower_bound(wide_values_.begin(), wide_values_.end(), c) - wide_values_.begin();
+            wide_values_.insert(wide_values_.begin() + position, c);
+            wide_classes_.insert(wide_classes_.begin() + position, class_count_++);
+          }
+        }
+      }
+      if (ignore_case_)
+        for (unsigned code = 'A'; code <= 'Z'; ++code)
+          byte_classes_[code] = byte_classes_[code + ('a' - 'A')];
+
+      std::vector<std::map<uint32_t, uint32_t>> tree(1);
+      patterns_of_state_.assign(1, npos);
+      for (size_t pattern = 0; pattern < patterns_.size(); ++pattern) {
+        lengths_.push_back(patterns_[pattern].size());
+        if (patterns_[pattern].empty()) continue;
+        max_length_ = std::max(max_length_, patterns_[pattern].size());
+        uint32_t state = 0;
+        for (auto c : patterns_[pattern]) {
+          auto iterator = tree[state].find(class_of(fold(c)));
+          if (iterator == tree[state].end()) {
+            iterator = tree[state].emplace(class_of(fold(c)), static_cast<uint32_t>(tree.size())).first;
+            tree.emplace_back();
+            patterns_of_state_.push_back(npos);
+          }
+          state = iterator->second;
+        }
+        if (patterns_of_state_[state] == npos) patterns_of_state_[state] = pattern;
+      }
+
+      // Breadth-first completion of the goto function with the failure links gives a deterministic automaton.
+      size_t state_count = tree.size();
+      transitions_.assign(state_count * class_count_, 0);
+      first_outputs_.assign(state_count, 0);
+      next_outputs_.assign(state_count, 0);
+      std::vector<uint32_t> failures(state_count, 0);
+      std::queue<uint32_t> states;
+      for (auto& edge : tree[0]) {
+        transitions_[edge.first] = edge.second;
+        states.push(edge.second);
+      }
+      while (!states.empty()) {
+        uint32_t state = states.front();
+        states.pop();
+        uint32_t failure = failures[state];
+        next_outputs_[state] = first_outputs_[failure];
+        first_outputs_[state] = patterns_of_state_[state] != npos ? state : next_outputs_[state];
+        for (uint32_t character_class = 0; character_class < class_count_; ++character_class)
+          transitions_[state * class_count_ + character_class] = transitions_[failure * class_count_ + character_class];
+        for (auto& edge : tree[state]) {
+          failures[edge.second] = transitions_[failure * class_count_ + edge.first];
+          transitions_[state * class_count_ + edge.first] = edge.second;
+          states.push(edge.second);
+        }
+      }
+    }
+
+    std::vector<std::basic_string<char_t>> patterns_;
+    bool ignore_case_ = false;
+    std::array<uint32_t, 256> byte_classes_ {};
+    std::vector<char_t> wide_values_;
+    std::vector<uint32_t> wide_classes_;
+    uint32_t class_count_ = 1;
+    std::vector<uint32_t> transitions_ = std::vector<uint32_t>(1, 0);
+    std::vector<uint32_t> first_outputs_ = std::vector<uint32_t>(1, 0);
+    std::vector<uint32_t> next_outputs_ = std::vector<uint32_t>(1, 0);
+    std::vector<size_t> patterns_of_state_ = std::vector<size_t>(1, npos);
+    std::vector<size_t> lengths_;
+    size_t max_length_ = 0;
+  };
+}
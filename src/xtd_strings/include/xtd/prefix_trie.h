@@ -0,0 +1,176 @@
+/// @file
+/// @brief Contains xtd::prefix_trie and xtd::suffix_trie classes.
+#pragma once
+
+/// @cond
+#define __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include "internal/__ignore_case.h"
+
+/// @cond
+#undef __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  template<typename char_t>
+  class suffix_trie;
+
+  /// @brief Represents a precompiled set of prefixes that can be matched against the beginning of a string in a single pass, whatever the number of prefixes.
+  /// @par Examples
+  /// @code
+  /// xtd::prefix_trie<char> routes {{"/api/", "/api/v2/", "/static/"}};
+  /// size_t index = routes.match("/api/v2/users"); // index == 1, the longest matching prefix.
+  /// @endcode
+  /// @remarks Each character of the string is read at most once and the walk stops as soon as no prefix can match, so the cost depends on the length of the longest prefix and not on the number of prefixes.
+  /// @remarks The trie is compiled into flat arrays at construction; it is immutable and can be shared between threads.
+  template<typename char_t>
+  class prefix_trie {
+  public:
+    /// @brief Represents the value returned when no prefix matches.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /// @brief Initializes a new empty instance of the xtd::prefix_trie class.
+    prefix_trie() = default;
+
+    /// @brief Initializes a new instance of the xtd::prefix_trie class with the specified prefixes.
+    /// @param values The prefixes to match.
+    /// @param ignore_case true to ignore case when matching; otherwise, false.
+    explicit prefix_trie(const std::vector<std::basic_string<char_t>>& values, bool ignore_case = false) : values_(values), ignore_case_(ignore_case) {compile(false);}
+
+    /// @brief Gets a value indicating whether matches ignore case.
+    /// @return true if matches ignore case; otherwise, false.
+    bool ignore_case() const noexcept {return ignore_case_;}
+
+    /// @brief Gets the prefixes of this instance, in the order they were specified.
+    /// @return The prefixes.
+    const std::vector<std::basic_string<char_t>>& values() const noexcept {return values_;}
+
+    /// @brief Searches the longest prefix of the specified string.
+    /// @param str The string to match.
+    /// @return The index in values() of the longest prefix that str starts with; or xtd::prefix_trie::npos if none.
+    /// @remarks If the same prefix was specified several times, the index of the first one is returned.
+    size_t match(std::basic_string_view<char_t> str) const noexcept {return match(str.begin(), str.end());}
+
+    /// @brief Determines whether the specified string starts with any of the prefixes.
+    /// @param str The string to match.
+    /// @return true if str starts with at least one prefix; otherwise, false.
+    bool matches(std::basic_string_view<char_t> str) const noexcept {return match(str) != npos;}
+
+  private:
+    friend class suffix_trie<char_t>;
+
+    void compile(bool reversed) {
+      // Builds an ordered tree first, then flattens it so that the edges of each node are contiguous and sorted by label.
+      std::vector<std::map<char_t, uint32_t>> tree(1);
+      std::vector<size_t> tree_values(1, npos);
+      for (size_t index = 0; index < values_.size(); ++index) {
+        uint32_t node = 0;
+        auto insert = [&](char_t c) {
+          if (ignore_case_) c = __fold_case_char(c);
+          auto iterator = tree[node].find(c);
+          if (iterator == tree[node].end()) {
+            iterator = tree[node].emplace(c, static_cast<uint32_t>(tree.size())).first;
+            tree.emplace_back();
+            tree_values.push_back(npos);
+          }
+          node = iterator->second;
+        };
+        if (reversed) std::for_each(values_[index].rbegin(), values_[index].rend(), insert);
+        else std::for_each(values_[index].begin(), values_[index].end(), insert);
+        if (tree_values[node] == npos) tree_values[node] = index;
+      }
+
+      first_edges_.assign(1, 0);
+      for (auto& edges : tree) {
+        for (auto& edge : edges) {
+          labels_.push_back(edge.first);
+          targets_.push_back(edge.second);
+        }
+        first_edges_.push_back(static_cast<uint32_t>(labels_.size()));
+      }
+      node_values_ = std::move(tree_values);
+    }
+
+    template<typename iterator_t>
+    size_t match(iterator_t first, iterator_t last) const noexcept {
+      if (node_values_.empty()) return npos;
+      uint32_t node = 0;
+      size_t result = node_values_[0];
+      for (; first != last; ++first) {
+        char_t c = ignore_case_ ? __fold_case_char(*first) : *first;
+        const char_t* edges_first = labels_.data() + first_edges_[node];
+        const char_t* edges_last = labels_.data() + first_edges_[node + 1];
+        const char_t* edge = edges_last - edges_first <= 8 ? std::find(edges_first, edges_last, c) : std::lower_bound(edges_first, edges_last, c);
+        if (edge == edges_last || *edge != c) break;
+        node = targets_[static_cast<size_t>(edge - labels_.data())];
+        if (node_values_[node] != npos) result = node_values_[node];
+      }
+      return result;
+    }
+
+    std::vector<std::basic_string<char_t>> values_;
+    bool ignore_case_ = false;
+    std::vector<uint32_t> first_edges_;
+    std::vector<char_t> labels_;
+    std::vector<uint32_t> targets_;
+    std::vector<size_t> node_values_;
+  };
+
+  /// @brief Represents a precompiled set of suffixes that can be matched against the end of a string in a single pass, whatever the number of suffixes.
+  /// @par Examples
+  /// @code
+  /// xtd::suffix_trie<char> extensions {{".h", ".hpp", ".cpp"}, true};
+  /// bool is_source = extensions.matches("main.CPP"); // is_source == true
+  /// @endcode
+  /// @remarks The string is read backwards from its last character; see xtd::prefix_trie for the complexity.
+  template<typename char_t>
+  class suffix_trie {
+  public:
+    /// @brief Represents the value returned when no suffix matches.
+    static constexpr size_t npos = prefix_trie<char_t>::npos;
+
+    /// @brief Initializes a new empty instance of the xtd::suffix_trie class.
+    suffix_trie() = default;
+
+    /// @brief Initializes a new instance of the xtd::suffix_trie class with the specified suffixes.
+    /// @param values The suffixes to match.
+    /// @param ignore_case true to ignore case when matching; otherwise, false.
+    explicit suffix_trie(const std::vector<std::basic_string<char_t>>& values, bool ignore_case = false) {
+      trie_.values_ = values;
+      trie_.ignore_case_ = ignore_case;
+      trie_.compile(true);
+    }
+
+    /// @brief Gets a value indicating whether matches ignore case.
+    /// @return true if matches ignore case; otherwise, false.
+    bool ignore_case() const noexcept {return trie_.ignore_case();}
+
+    /// @brief Gets the suffixes of this instance, in the order they were specified.
+    /// @return The suffixes.
+    const std::vector<std::basic_string<char_t>>& values() const noexcept {return trie_.values();}
+
+    /// @brief Searches the longest suffix of the specified string.
+    /// @param str The string to match.
+    /// @return The index in values() of the longest suffix that str ends with; or xtd::suffix_trie::npos if none.
+    /// @remarks If the same suffix was specified several times, the index of the first one is returned.
+    size_t match(std::basic_string_view<char_t> str) const noexcept {return trie_.match(str.rbegin(), str.rend());}
+
+    /// @brief Determines whether the specified string ends with any of the suffixes.
+    /// @param str The string to match.
+    /// @return true if str ends with at least one suffix; otherwise, false.
+    bool matches(std::basic_string_view<char_t> str) const noexcept {return match(str) != npos;}
+
+  private:
+    prefix_trie<char_t> trie_;
+  };
+}
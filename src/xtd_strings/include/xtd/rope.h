@@ -0,0 +1,481 @@
+/// @file
+/// @brief Contains xtd::rope class.
+#pragma once
+
+#include "istring.h"
+#include "string_split_options.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Represents a string stored as a balanced tree of immutable pieces, so that a large string can be edited in O(log n) instead of being copied.
+  /// @par Examples
+  /// @code
+  /// xtd::rope<char> document {xtd::istring(read_file("config.yaml"))};
+  /// for (auto index = document.index_of("${HOST}"); index != document.npos; index = document.index_of("${HOST}", index))
+  ///   document.replace(index, 7, host);
+  /// document.write_to(std::cout);
+  /// @endcode
+  /// @remarks The leaves of the tree are xtd::immutable_basic_string slices: splitting a leaf shares its buffer. The tree is an AVL tree whose nodes are shared and never modified, so that a copy of a rope is O(1) and is not affected by the edits of the original.
+  /// @remarks insert, remove, replace with an index, append and substr are O(log n). Two adjacent leaves shorter than leaf_capacity characters together are merged into one, so that character by character edits do not produce a leaf per character.
+  /// @remarks The pieces of a rope are enumerated by pieces(), as std::basic_string_view. view() flattens the rope into a single piece, so that it can be passed to the xtd::strings methods.
+  template<typename char_t>
+  class rope {
+    struct node;
+    using node_ptr = std::shared_ptr<const node>;
+    struct node {
+      node_ptr left;
+      node_ptr right;
+      xtd::immutable_basic_string<char_t> leaf;
+      size_t length = 0;
+      size_t height = 0;
+    };
+
+  public:
+    /// @cond
+    using value_type = char_t;
+    using size_type = size_t;
+    /// @endcond
+
+    /// @brief Represents the value used when no string is found.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /// @brief Represents the maximum length of a leaf obtained by merging two adjacent leaves.
+    static constexpr size_t leaf_capacity = 256;
+
+    /// @brief Represents an iterator over the pieces of a rope, as std::basic_string_view, from left to right.
+    class piece_iterator {
+    public:
+      /// @cond
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = std::basic_string_view<char_t>;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const value_type*;
+      using reference = const value_type&;
+
+      piece_iterator() noexcept = default;
+
+      const std::basic_string_view<char_t>& operator*() const noexcept {return piece_;}
+      const std::basic_string_view<char_t>* operator->() const noexcept {return &piece_;}
+      piece_iterator& operator++() {
+        position_ += piece_.size();
+        piece_ = std::basic_string_view<char_t>();
+        if (stack_.empty()) return *this;
+        const node* next = stack_.back();
+        stack_.pop_back();
+        descend(next, 0);
+        return *this;
+      }
+      piece_iterator operator++(int) {
+        piece_iterator result = *this;
+        ++*this;
+        return result;
+      }
+      size_t position() const noexcept {return position_;}
+      friend bool operator==(const piece_iterator& a, const piece_iterator& b) noexcept {return a.position_ == b.position_;}
+      friend bool operator!=(const piece_iterator& a, const piece_iterator& b) noexcept {return a.position_ != b.position_;}
+      /// @endcond
+
+    private:
+      friend class rope;
+      piece_iterator(const node* root, size_t index) {
+        if (!root || index >= root->length) position_ = root ? root->length : 0;
+        else {
+          position_ = index;
+          descend(root, index);
+        }
+      }
+
+      // Goes down to the leaf that holds the character at index, pushing the right subtrees left for later; the piece starts at that character.
+      void descend(const node* current, size_t index) {
+        while (current->height != 0) {
+          if (index < current->left->length) {
+            stack_.push_back(current->right.get());
+            current = current->left.get();
+          } else {
+            index -= current->left->length;
+            current = current->right.get();
+          }
+        }
+        piece_ = std::basic_string_view<char_t>(current->leaf).substr(index);
+      }
+
+      std::vector<const node*> stack_;
+      std::basic_string_view<char_t> piece_;
+      size_t position_ = 0;
+    };
+
+    /// @brief Represents the range of the pieces of a rope, as returned by xtd::rope::pieces.
+    class piece_range {
+    public:
+      /// @cond
+      piece_iterator begin() const {return piece_iterator(root_.get(), 0);}
+      piece_iterator end() const {return piece_iterator(root_.get(), npos);}
+      /// @endcond
+
+    private:
+      friend class rope;
+      explicit piece_range(node_ptr root) noexcept : root_(std::move(root)) {}
+      node_ptr root_;
+    };
+
+    /// @brief Represents an iterator over the characters of a rope.
+    class const_iterator {
+    public:
+      /// @cond
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = char_t;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const char_t*;
+      using reference = const char_t&;
+
+      const_iterator() noexcept = default;
+
+      const char_t& operator*() const noexcept {return (*piece_)[offset_];}
+      const_iterator& operator++() {
+        if (++offset_ == piece_->size()) {
+          ++piece_;
+          offset_ = 0;
+        }
+        return *this;
+      }
+      const_iterator operator++(int) {
+        const_iterator result = *this;
+        ++*this;
+        return result;
+      }
+      size_t position() const noexcept {return piece_.position() + offset_;}
+      friend bool operator==(const const_iterator& a, const const_iterator& b) noexcept {return a.position() == b.position();}
+      friend bool operator!=(const const_iterator& a, const const_iterator& b) noexcept {return a.position() != b.position();}
+      /// @endcond
+
+    private:
+      friend class rope;
+      explicit const_iterator(piece_iterator piece) noexcept : piece_(std::move(piece)) {}
+      piece_iterator piece_;
+      size_t offset_ = 0;
+    };
+
+    /// @brief Initializes a new empty instance of the xtd::rope class.
+    rope() noexcept = default;
+
+    /// @brief Initializes a new instance of the xtd::rope class with the specified string, whose buffer is shared.
+    /// @param str The string.
+    rope(const xtd::immutable_basic_string<char_t>& str) : root_(make_leaf(str)) {}
+
+    /// @cond
+    rope(std::basic_string_view<char_t> str) : root_(make_leaf(xtd::immutable_basic_string<char_t>(str))) {}
+    rope(const std::basic_string<char_t>& str) : rope(std::basic_string_view<char_t>(str)) {}
+    rope(const char_t* str) : rope(std::basic_string_view<char_t>(str)) {}
+    /// @endcond
+
+    /// @brief Gets the number of characters of this rope.
+    /// @return The number of characters.
+    size_t size() const noexcept {return root_ ? root_->length : 0;}
+    /// @cond
+    size_t length() const noexcept {return size();}
+    /// @endcond
+
+    /// @brief Gets a value indicating whether this rope is empty.
+    /// @return true if this rope is empty; otherwise, false.
+    bool empty() const noexcept {return !root_;}
+
+    /// @brief Gets the height of the tree of this rope, for diagnostics: 0 for a rope of one piece.
+    /// @return The height of the tree.
+    size_t depth() const noexcept {return root_ ? root_->height : 0;}
+
+    /// @brief Gets the character at the specified index, in O(log n).
+    /// @param index The index of the character.
+    /// @return The character.
+    /// @exception std::out_of_range index is greater than or equal to size().
+    char_t at(size_t index) const {
+      if (index >= size()) throw std::out_of_range("index out of range");
+      const node* current = root_.get();
+      while (current->height != 0) {
+        if (index < current->left->length) current = current->left.get();
+        else {
+          index -= current->left->length;
+          current = current->right.get();
+        }
+      }
+      return current->leaf[index];
+    }
+    /// @cond
+    char_t operator[](size_t index) const {return at(index);}
+
+    const_iterator begin() const {return const_iterator(piece_iterator(root_.get(), 0));}
+    const_iterator end() const {return const_iterator(piece_iterator(root_.get(), npos));}
+    /// @endcond
+
+    /// @brief Gets the pieces of this rope, from left to right.
+    /// @return The range of the pieces, as std::basic_string_view.
+    /// @remarks The range shares the tree of this rope: it remains valid when this rope is edited or destroyed.
+    piece_range pieces() const noexcept {return piece_range(root_);}
+
+    /// @brief Appends the specified rope to this rope, in O(log n).
+    /// @param value The rope to append; its tree is shared.
+    /// @return This rope.
+    rope& append(const rope& value) {
+      root_ = join(root_, value.root_);
+      return *this;
+    }
+
+    /// @brief Inserts the specified rope at the specified index of this rope, in O(log n).
+    /// @param index The index of the insertion.
+    /// @param value The rope to insert; its tree is shared.
+    /// @return This rope.
+    /// @exception std::out_of_range index is greater than size().
+    rope& insert(size_t index, const rope& value) {
+      if (index > size()) throw std::out_of_range("index out of range");
+      auto [left, right] = split_at(root_, index);
+      root_ = join(join(left, value.root_), right);
+      return *this;
+    }
+
+    /// @brief Removes the specified number of characters from this rope, starting at the specified index, in O(log n).
+    /// @param index The index of the first character to remove.
+    /// @param count The number of characters to remove; it is truncated to the end of this rope.
+    /// @return This rope.
+    /// @exception std::out_of_range index is greater than size().
+    rope& remove(size_t index, size_t count = npos) {
+      if (index > size()) throw std::out_of_range("index out of range");
+      auto [left, rest] = split_at(root_, index);
+      root_ = join(left, split_at(rest, std::min(count, size() - index)).second);
+      return *this;
+    }
+
+    /// @brief Replaces the specified number of characters of this rope, starting at the specified index, with the specified rope, in O(log n).
+    /// @param index The index of the first character to replace.
+    /// @param count The number of characters to replace; it is truncated to the end of this rope.
+    /// @param value The rope that replaces the characters.
+    /// @return This rope.
+    /// @exception std::out_of_range index is greater than size().
+    rope& replace(size_t index, size_t count, const rope& value) {
+      if (index > size()) throw std::out_of_range("index out of range");
+      auto [left, rest] = split_at(root_, index);
+      root_ = join(join(left, value.root_), split_at(rest, std::min(count, size() - index)).second);
+      return *this;
+    }
+
+    /// @brief Replaces all occurrences of a specified string with a specified rope, in O(k log n) for k occurrences once they are found.
+    /// @param old_value The string to be replaced.
+    /// @param new_value The rope to replace all occurrences of old_value.
+    /// @return This rope.
+    /// @exception std::invalid_argument old_value is empty.
+    rope& replace(std::basic_string_view<char_t> old_value, const rope& new_value) {
+      if (old_value.empty()) throw std::invalid_argument("old_value cannot be empty");
+      node_ptr result;
+      size_t position = 0;
+      for (size_t index = index_of(old_value); index != npos; index = index_of(old_value, position)) {
+        result = join(join(result, substr(position, index - position).root_), new_value.root_);
+        position = index + old_value.size();
+      }
+      if (position == 0) return *this;
+      root_ = join(result, substr(position).root_);
+      return *this;
+    }
+
+    /// @brief Returns a rope that holds the specified characters of this rope, in O(log n); the pieces are shared.
+    /// @param index The index of the first character.
+    /// @param count The number of characters; it is truncated to the end of this rope.
+    /// @return The sub-rope.
+    /// @exception std::out_of_range index is greater than size().
+    rope substr(size_t index, size_t count = npos) const {
+      if (index > size()) throw std::out_of_range("index out of range");
+      rope result;
+      result.root_ = split_at(split_at(root_, index).second, std::min(count, size() - index)).first;
+      return result;
+    }
+
+    /// @brief Reports the index of the first occurrence of the specified character in this rope.
+    /// @param value The character to seek.
+    /// @param start_index The search starting position.
+    /// @return The index of value if that character is found, or xtd::rope::npos if it is not.
+    size_t index_of(char_t value, size_t start_index = 0) const {
+      for (piece_iterator piece(root_.get(), start_index); piece.position() < size(); ++piece) {
+        const char_t* found = std::char_traits<char_t>::find(piece->data(), piece->size(), value);
+        if (found) return piece.position() + (found - piece->data());
+      }
+      return npos;
+    }
+
+    /// @brief Reports the index of the first occurrence of the specified string in this rope; the occurrence can span several pieces.
+    /// @param value The string to seek.
+    /// @param start_index The search starting position.
+    /// @return The index of value if that string is found, or xtd::rope::npos if it is not.
+    size_t index_of(std::basic_string_view<char_t> value, size_t start_index = 0) const {
+      if (start_index > size()) return npos;
+      if (value.empty()) return start_index;
+      for (piece_iterator piece(root_.get(), start_index); piece.position() < size(); ++piece) {
+        for (size_t offset = 0; offset < piece->size(); ++offset) {
+          const char_t* found = std::char_traits<char_t>::find(piece->data() + offset, piece->size() - offset, value[0]);
+          if (!found) break;
+          offset = found - piece->data();
+          if (matches(piece, offset, value)) return piece.position() + offset;
+        }
+      }
+      return npos;
+    }
+
+    /// @brief Splits this rope into sub-ropes that are based on the characters in an array; the pieces are shared.
+    /// @param separators A character array that delimits the sub-ropes in this rope.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty sub-ropes from the array returned; or xtd::string_split_options::none to include them.
+    /// @return An array whose elements contain the sub-ropes of this rope that are delimited by one or more characters in separators.
+    std::vector<rope> split(const std::vector<char_t>& separators = std::vector<char_t> {9, 10, 11, 12, 13, 32}, xtd::string_split_options options = xtd::string_split_options::none) const {
+      std::vector<rope> result;
+      size_t start = 0;
+      auto add = [&](size_t end) {
+        if (end != start || options != xtd::string_split_options::remove_empty_entries) result.push_back(substr(start, end - start));
+        start = end + 1;
+      };
+      for (piece_iterator piece(root_.get(), 0); piece.position() < size(); ++piece)
+        for (size_t offset = 0; offset < piece->size(); ++offset)
+          if (std::find(separators.begin(), separators.end(), (*piece)[offset]) != separators.end()) add(piece.position() + offset);
+      add(size());
+      return result;
+    }
+
+    /// @brief Returns the characters of this rope as a single immutable string; in O(1) when this rope has a single piece.
+    /// @return An xtd::immutable_basic_string.
+    xtd::immutable_basic_string<char_t> to_istring() const {
+      if (!root_) return xtd::immutable_basic_string<char_t>();
+      if (root_->height == 0) return root_->leaf;
+      return xtd::immutable_basic_string<char_t>(to_string());
+    }
+
+    /// @brief Copies the characters of this rope into a new string, allocated once.
+    /// @return A new string.
+    std::basic_string<char_t> to_string() const {
+      std::basic_string<char_t> result;
+      result.reserve(size());
+      for (auto piece : pieces())
+        result.append(piece);
+      return result;
+    }
+
+    /// @brief Flattens this rope into a single piece, if it is not already, and returns it; for the xtd::strings methods.
+    /// @return The characters of this rope, valid until this rope is edited or destroyed.
+    /// @par Examples
+    /// @code
+    /// if (xtd::strings::contains(document.view(), "TODO")) ...
+    /// @endcode
+    std::basic_string_view<char_t> view() {
+      if (root_ && root_->height != 0) root_ = make_leaf(to_istring());
+      return root_ ? std::basic_string_view<char_t>(root_->leaf) : std::basic_string_view<char_t>();
+    }
+
+    /// @brief Writes the characters of this rope to the specified stream, piece by piece.
+    /// @param os The output stream.
+    void write_to(std::basic_ostream<char_t>& os) const {
+      for (auto piece : pieces())
+        os.write(piece.data(), static_cast<std::streamsize>(piece.size()));
+    }
+
+    /// @cond
+    friend bool operator==(const rope& a, const rope& b) {return a.size() == b.size() && (a.root_ == b.root_ || std::equal(a.begin(), a.end(), b.begin()));}
+    friend bool operator!=(const rope& a, const rope& b) {return !(a == b);}
+    friend bool operator==(const rope& a, std::basic_string_view<char_t> b) {return a.size() == b.size() && a.starts_with(b);}
+    friend bool operator==(std::basic_string_view<char_t> a, const rope& b) {return b == a;}
+    friend bool operator!=(const rope& a, std::basic_string_view<char_t> b) {return !(a == b);}
+    friend bool operator!=(std::basic_string_view<char_t> a, const rope& b) {return !(b == a);}
+    friend bool operator==(const rope& a, const std::basic_string<char_t>& b) {return a == std::basic_string_view<char_t>(b);}
+    friend bool operator!=(const rope& a, const std::basic_string<char_t>& b) {return !(a == std::basic_string_view<char_t>(b));}
+    friend bool operator==(const rope& a, const char_t* b) {return a == std::basic_string_view<char_t>(b);}
+    friend bool operator!=(const rope& a, const char_t* b) {return !(a == std::basic_string_view<char_t>(b));}
+    friend std::basic_ostream<char_t>& operator<<(std::basic_ostream<char_t>& os, const rope& value) {
+      value.write_to(os);
+      return os;
+    }
+    /// @endcond
+
+  private:
+    static size_t height(const node_ptr& value) noexcept {return value ? value->height : 0;}
+
+    static node_ptr make_leaf(const xtd::immutable_basic_string<char_t>& str) {
+      if (str.empty()) return nullptr;
+      auto result = std::make_shared<node>();
+      result->leaf = str;
+      result->length = str.size();
+      return result;
+    }
+
+    static node_ptr make_node(node_ptr left, node_ptr right) {
+      auto result = std::make_shared<node>();
+      result->length = left->length + right->length;
+      result->height = std::max(left->height, right->height) + 1;
+      result->left = std::move(left);
+      result->right = std::move(right);
+      return result;
+    }
+
+    // Returns a node of left and right, whose heights differ by 2 at most, with one or two rotations when they differ by 2.
+    static node_ptr balance(node_ptr left, node_ptr right) {
+      if (height(left) > height(right) + 1) {
+        if (height(left->left) < height(left->right)) left = make_node(make_node(left->left, left->right->left), left->right->right);
+        return make_node(left->left, make_node(left->right, right));
+      }
+      if (height(right) > height(left) + 1) {
+        if (height(right->right) < height(right->left)) right = make_node(right->left->left, make_node(right->left->right, right->right));
+        return make_node(make_node(left, right->left), right->right);
+      }
+      return make_node(left, right);
+    }
+
+    // Concatenates two trees in O(|height(left) - height(right)|): the shorter one is joined along the edge of the taller one.
+    static node_ptr join(const node_ptr& left, const node_ptr& right) {
+      if (!left) return right;
+      if (!right) return left;
+      if (left->height == 0 && right->height == 0 && left->length + right->length <= leaf_capacity) {
+        std::basic_string<char_t> merged(std::basic_string_view<char_t>(left->leaf));
+        merged.append(std::basic_string_view<char_t>(right->leaf));
+        return make_leaf(xtd::immutable_basic_string<char_t>(merged));
+      }
+      if (left->height > right->height + 1) return balance(left->left, join(left->right, right));
+      if (right->height > left->height + 1) return balance(join(left, right->left), right->right);
+      return make_node(left, right);
+    }
+
+    // Splits a tree into the trees of the characters before index and from index, in O(log n).
+    static std::pair<node_ptr, node_ptr> split_at(const node_ptr& value, size_t index) {
+      if (!value || index == 0) return {nullptr, value};
+      if (index >= value->length) return {value, nullptr};
+      if (value->height == 0) return {make_leaf(value->leaf.substr(0, index)), make_leaf(value->leaf.substr(index))};
+      if (index < value->left->length) {
+        auto [left, right] = split_at(value->left, index);
+        return {left, join(right, value->right)};
+      }
+      auto [left, right] = split_at(value->right, index - value->left->length);
+      return {join(value->left, left), right};
+    }
+
+    bool starts_with(std::basic_string_view<char_t> value) const {
+      return value.empty() || (size() >= value.size() && matches(piece_iterator(root_.get(), 0), 0, value));
+    }
+
+    // Compares value with the characters from offset in piece, and then with the next pieces if value goes beyond piece.
+    bool matches(const piece_iterator& piece, size_t offset, std::basic_string_view<char_t> value) const {
+      size_t count = std::min(value.size(), piece->size() - offset);
+      if (std::char_traits<char_t>::compare(piece->data() + offset, value.data(), count) != 0) return false;
+      if (count == value.size()) return true;
+      piece_iterator next = piece;
+      for (size_t index = count; index < value.size(); index += count) {
+        if ((++next).position() >= size()) return false;
+        count = std::min(value.size() - index, next->size());
+        if (std::char_traits<char_t>::compare(next->data(), value.data() + index, count) != 0) return false;
+      }
+      return true;
+    }
+
+    node_ptr root_;
+  };
+}
@@ -0,0 +1,273 @@
+/// @file
+/// @brief Contains xtd::searcher class.
+#pragma once
+
+#include "string_comparison.h"
+
+/// @cond
+#define __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include "internal/__ignore_case.h"
+#include "internal/__shufti.h"
+
+/// @cond
+#undef __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Represents a substring to seek, preprocessed once so that it can be searched for in many strings.
+  /// @par Examples
+  /// @code
+  /// static const xtd::searcher<char> error {"error", xtd::string_comparison::ordinal_ignore_case};
+  /// for (const auto& line : lines)
+  ///   if (xtd::strings::contains(line, error)) ++errors;
+  /// @endcode
+  /// @remarks The algorithm is chosen from the length of the substring:
+  /// * one character is sought with std::char_traits::find;
+  /// * for char, up to 32 characters, 16 positions are tested at once by comparing the first and the last character of the substring (SSE2), and candidates are then compared entirely;
+  /// * up to 63 characters, the Boyer-Moore-Horspool algorithm is used;
+  /// * longer substrings use the Two-Way algorithm, which is linear in the worst case.
+  /// @remarks When case is ignored, the substring is lowered once and each character of the searched string is lowered when it is read; the searched string is never copied.
+  template<typename char_t>
+  class searcher {
+  public:
+    /// @brief Represents the value returned when the substring is not found.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /// @brief Initializes a new instance of the xtd::searcher class that seeks the empty string.
+    searcher() = default;
+
+    /// @brief Initializes a new instance of the xtd::searcher class with the specified substring.
+    /// @param value The substring to seek.
+    /// @param comparison_type One of the enumeration values that specifies the rules for the search.
+    explicit searcher(std::basic_string_view<char_t> value, xtd::string_comparison comparison_type = xtd::string_comparison::ordinal) : value_(value), comparison_type_(comparison_type) {
+      if (ignore_case())
+        for (auto& c : value_) c = __fold_case_char(c);
+      size_t length = value_.size();
+      if (length <= 1) algorithm_ = algorithm::character;
+#if defined(__XTD_STRINGS_SSE2__)
+      else if (sizeof(char_t) == 1 && length <= 32 && (!ignore_case() || (is_ascii(value_.front()) && is_ascii(value_.back())))) algorithm_ = algorithm::vector_filter;
+#endif
+      else if (length < 64) algorithm_ = algorithm::horspool;
+      else algorithm_ = algorithm::two_way;
+      if (length > 1) compute_shifts();
+      if (algorithm_ == algorithm::two_way) compute_critical_factorization();
+    }
+
+    /// @brief Gets the substring to seek; if case is ignored, it is lowered.
+    /// @return The substring to seek.
+    const std::basic_string<char_t>& value() const noexcept {return value_;}
+
+    /// @brief Gets the rules used for the search.
+    /// @return One of the enumeration values that specifies the rules for the search.
+    xtd::string_comparison comparison_type() const noexcept {return comparison_type_;}
+
+    /// @brief Reports the index of the first occurrence of the substring in the specified string.
+    /// @param str The string to search.
+    /// @param start_index The search starting position.
+    /// @return The index of the first occurrence found at or after start_index; or xtd::searcher::npos if there is none.
+    size_t find(std::basic_string_view<char_t> str, size_t start_index = 0) const noexcept {return ignore_case() ? find<true>(str, start_index) : find<false>(str, start_index);}
+
+    /// @brief Reports the index of the last occurrence of the substring in the specified string.
+    /// @param str The string to search.
+    /// @param position The greatest index at which the occurrence can start.
+    /// @return The index of the last occurrence found at or before position; or xtd::searcher::npos if there is none.
+    size_t find_last(std::basic_string_view<char_t> str, size_t position = npos) const noexcept {return ignore_case() ? find_last<true>(str, position) : find_last<false>(str, position);}
+
+  private:
+    enum class algorithm {character, vector_filter, horspool, two_way};
+    using unsigned_char_t = typename std::make_unsigned<char_t>::type;
+
+    bool ignore_case() const noexcept {return comparison_type_ == xtd::string_comparison::ordinal_ignore_case;}
+    static bool is_ascii(char_t c) noexcept {return static_cast<unsigned_char_t>(c) < 0x80;}
+    static size_t shift_index(char_t c) noexcept {return static_cast<unsigned_char_t>(c) & 0xFF;}
+
+    template<bool ignore_case>
+    static char_t fold(char_t c) noexcept {
+      if constexpr (ignore_case) return __fold_case_char(c);
+      else return c;
+    }
+
+    template<bool ignore_case>
+    bool equals_at(const char_t* str, size_t first, size_t last) const noexcept {
+      if constexpr (ignore_case) return __mismatch_ignore_case(value_.data() + first, str + first, last - first) == last - first;
+      else return std::char_traits<char_t>::compare(value_.data() + first, str + first, last - first) == 0;
+    }
+
+    // Wide characters share the shift of their low byte, which keeps the shifts safe with a 256 entries table.
+    void compute_shifts() noexcept {
+      size_t length = value_.size();
+      shifts_.fill(length);
+      reverse_shifts_.fill(length);
+      for (size_t index = 0; index + 1 < length; ++index)
+        shifts_[shift_index(value_[index])] = length - 1 - index;
+      for (size_t index = length - 1; index > 0; --index)
+        reverse_shifts_[shift_index(value_[index])] = index;
+    }
+
+    // Crochemore-Perrin critical factorization: the maximal suffixes of the substring for both orders, the longest one gives the critical position.
+    void compute_critical_factorization() noexcept {
+      size_t length = value_.size();
+      auto maximal_suffix = [&](bool reversed, size_t& period) {
+        size_t suffix = npos, index = 0, offset = 1;
+        period = 1;
+        while (index + offset < length) {
+          unsigned_char_t a = static_cast<unsigned_char_t>(value_[index + offset]);
+          unsigned_char_t b = static_cast<unsigned_char_t>(value_[suffix + offset]);
+          if (reversed ? b < a : a < b) {
+            index += offset;
+            offset = 1;
+            period = index - suffix;
+          } else if (a == b) {
+            if (offset != period) ++offset;
+            else {
+              index += period;
+              offset = 1;
+            }
+          } else {
+            suffix = index++;
+            offset = period = 1;
+          }
+        }
+        return suffix + 1;
+      };
+      size_t period = 0, reverse_period = 0;
+      size_t suffix = maximal_suffix(false, period);
+      size_t reverse_suffix = maximal_suffix(true, reverse_period);
+      if (reverse_suffix >= suffix) {
+        suffix = reverse_suffix;
+        period = reverse_period;
+      }
+      critical_position_ = suffix;
+      periodic_ = std::char_traits<char_t>::compare(value_.data(), value_.data() + period, suffix) == 0;
+      period_ = periodic_ ? period : std::max(suffix, length - suffix) + 1;
+    }
+
+    template<bool ignore_case>
+    size_t find(std::basic_string_view<char_t> str, size_t start_index) const noexcept {
+      size_t length = value_.size();
+      if (start_index > str.size() || length > str.size() - start_index) return npos;
+      if (length == 0) return start_index;
+      switch (algorithm_) {
+        case algorithm::character: return find_character<ignore_case>(str, start_index);
+        case algorithm::vector_filter: return find_vector_filter<ignore_case>(str, start_index);
+        case algorithm::horspool: return find_horspool<ignore_case>(str, start_index);
+        default: return find_two_way<ignore_case>(str, start_index);
+      }
+    }
+
+    template<bool ignore_case>
+    size_t find_character(std::basic_string_view<char_t> str, size_t start_index) const noexcept {
+      if constexpr (!ignore_case) {
+        const char_t* result = std::char_traits<char_t>::find(str.data() + start_index, str.size() - start_index, value_[0]);
+        return result ? static_cast<size_t>(result - str.data()) : npos;
+      } else {
+        for (size_t index = start_index; index < str.size(); ++index)
+          if (__fold_case_char(str[index]) == value_[0]) return index;
+        return npos;
+      }
+    }
+
+    template<bool ignore_case>
+    size_t find_vector_filter(std::basic_string_view<char_t> str, size_t start_index) const noexcept {
+      size_t length = value_.size();
+      size_t index = start_index;
+#if defined(__XTD_STRINGS_SSE2__)
+      if constexpr (sizeof(char_t) == 1) {
+        __m128i first = _mm_set1_epi8(static_cast<char>(value_.front()));
+        __m128i last = _mm_set1_epi8(static_cast<char>(value_.back()));
+        for (; index + length - 1 + 16 <= str.size(); index += 16) {
+          __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + index));
+          __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + index + length - 1));
+          if constexpr (ignore_case) {
+            block_first = __ascii_lower_16(block_first);
+            block_last = __ascii_lower_16(block_last);
+          }
+          for (unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)))); mask != 0; mask &= mask - 1) {
+            size_t candidate = index + __shufti_lowest_bit(mask);
+            if (equals_at<ignore_case>(str.data() + candidate, 1, length - 1)) return candidate;
+          }
+        }
+      }
+#endif
+      for (; index + length <= str.size(); ++index)
+        if (fold<ignore_case>(str[index]) == value_.front() && fold<ignore_case>(str[index + length - 1]) == value_.back() && equals_at<ignore_case>(str.data() + index, 1, length - 1)) return index;
+      return npos;
+    }
+
+    template<bool ignore_case>
+    size_t find_horspool(std::basic_string_view<char_t> str, size_t start_index) const noexcept {
+      size_t length = value_.size();
+      for (size_t index = start_index; index + length <= str.size();) {
+        char_t c = fold<ignore_case>(str[index + length - 1]);
+        if (c == value_.back() && equals_at<ignore_case>(str.data() + index, 0, length - 1)) return index;
+        index += shifts_[shift_index(c)];
+      }
+      return npos;
+    }
+
+    template<bool ignore_case>
+    size_t find_two_way(std::basic_string_view<char_t> str, size_t start_index) const noexcept {
+      size_t length = value_.size();
+      const char_t* data = str.data();
+      size_t memory = 0;
+      for (size_t index = start_index; index + length <= str.size();) {
+        // The last character is checked first and a mismatch shifts with the Horspool table.
+        char_t last = fold<ignore_case>(data[index + length - 1]);
+        if (last != value_.back()) {
+          size_t shift = shifts_[shift_index(last)];
+          if (memory != 0 && shift < period_) shift = length - period_;
+          index += shift;
+          memory = 0;
+          continue;
+        }
+        size_t right = std::max(critical_position_, periodic_ ? memory : 0);
+        while (right < length - 1 && value_[right] == fold<ignore_case>(data[index + right])) ++right;
+        if (right >= length - 1) {
+          size_t left = critical_position_;
+          size_t low = periodic_ ? memory : 0;
+          while (left > low && value_[left - 1] == fold<ignore_case>(data[index + left - 1])) --left;
+          if (left <= low) return index;
+          index += period_;
+          memory = periodic_ ? length - period_ : 0;
+        } else {
+          index += right - critical_position_ + 1;
+          memory = 0;
+        }
+      }
+      return npos;
+    }
+
+    template<bool ignore_case>
+    size_t find_last(std::basic_string_view<char_t> str, size_t position) const noexcept {
+      size_t length = value_.size();
+      if (length > str.size()) return npos;
+      size_t index = std::min(position, str.size() - length);
+      if (length == 0) return index;
+      for (;;) {
+        char_t c = fold<ignore_case>(str[index]);
+        if (c == value_.front() && equals_at<ignore_case>(str.data() + index, 1, length)) return index;
+        size_t shift = length == 1 ? 1 : reverse_shifts_[shift_index(c)];
+        if (index < shift) return npos;
+        index -= shift;
+      }
+    }
+
+    std::basic_string<char_t> value_;
+    xtd::string_comparison comparison_type_ = xtd::string_comparison::ordinal;
+    algorithm algorithm_ = algorithm::character;
+    std::array<size_t, 256> shifts_ {};
+    std::array<size_t, 256> reverse_shifts_ {};
+    size_t critical_position_ = 0;
+    size_t period_ = 0;
+    bool periodic_ = false;
+  };
+}
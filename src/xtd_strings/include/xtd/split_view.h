@@ -0,0 +1,168 @@
+/// @file
+/// @brief Contains xtd::split_view class.
+#pragma once
+
+#include "char_set.h"
+#include "searcher.h"
+#include "string_split_options.h"
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+/// @cond
+// Maps the separator types accepted by xtd::strings::split_view to the separator type of xtd::split_view: characters to char_t, strings to std::basic_string_view<char_t>.
+template<typename char_t, typename separator_t>
+struct __split_view_separator {
+  using type = typename std::conditional<std::is_integral<separator_t>::value, char_t, typename std::conditional<std::is_convertible<const separator_t&, std::basic_string_view<char_t>>::value, std::basic_string_view<char_t>, separator_t>::type>::type;
+};
+/// @endcond
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Represents the lazy range of the substrings of a string that are delimited by a separator, as returned by xtd::strings::split_view.
+  /// @par Examples
+  /// @code
+  /// static const xtd::char_set<char> delimiters {' ', '\t'};
+  /// for (std::string_view field : xtd::split_view<char, xtd::char_set<char>>(line, delimiters, xtd::string_split_options::remove_empty_entries))
+  ///   on_field(field);
+  /// @endcode
+  /// @remarks Tokens are std::basic_string_view that refer to the split string: the range never allocates. The split string, and the separator when it is an xtd::char_set or an xtd::searcher, must outlive the range.
+  /// @remarks The tokens are the same as the elements of the array returned by the corresponding xtd::strings::split overload.
+  /// @remarks separator_t is char_t for a single character, std::basic_string_view<char_t> for a substring, xtd::char_set<char_t> for any character of a set, or xtd::searcher<char_t> for a preprocessed substring.
+  template<typename char_t, typename separator_t>
+  class split_view {
+    static constexpr bool is_stored_by_value = std::is_same<separator_t, char_t>::value || std::is_same<separator_t, std::basic_string_view<char_t>>::value;
+    using separator_storage_t = typename std::conditional<is_stored_by_value, separator_t, const separator_t*>::type;
+
+    struct state {
+      size_t position = 0;
+      size_t produced = 0;
+      bool finished = false;
+    };
+
+  public:
+    /// @brief Represents an iterator over the tokens of an xtd::split_view.
+    class iterator {
+    public:
+      /// @cond
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = std::basic_string_view<char_t>;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const value_type*;
+      using reference = const value_type&;
+
+      iterator() noexcept = default;
+
+      reference operator*() const noexcept {return token_;}
+      pointer operator->() const noexcept {return &token_;}
+
+      iterator& operator++() noexcept {
+        at_end_ = !view_->next(state_, token_);
+        return *this;
+      }
+      iterator operator++(int) noexcept {
+        iterator result = *this;
+        ++*this;
+        return result;
+      }
+
+      friend bool operator==(const iterator& a, const iterator& b) noexcept {return a.at_end_ == b.at_end_ && (a.at_end_ || (a.state_.position == b.state_.position && a.state_.produced == b.state_.produced && a.state_.finished == b.state_.finished));}
+      friend bool operator!=(const iterator& a, const iterator& b) noexcept {return !(a == b);}
+      /// @endcond
+
+    private:
+      friend class split_view;
+      iterator(const split_view* view, bool at_end) noexcept : view_(view), at_end_(at_end) {
+        if (!at_end_) ++*this;
+      }
+
+      const split_view* view_ = nullptr;
+      state state_;
+      value_type token_;
+      bool at_end_ = true;
+    };
+
+    /// @cond
+    using const_iterator = iterator;
+    /// @endcond
+
+    /// @brief Initializes a new instance of the xtd::split_view class.
+    /// @param str The string to split.
+    /// @param separator The separator that delimits the substrings in str.
+    /// @param count The maximum number of substrings to return.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty substrings; or xtd::string_split_options::none to include them.
+    /// @remarks If there are more than count substrings, the last one returned contains the remaining characters of str.
+    split_view(std::basic_string_view<char_t> str, const separator_t& separator, size_t count = std::numeric_limits<size_t>::max(), xtd::string_split_options options = xtd::string_split_options::none) noexcept : str_(str), separator_(store(separator)), count_(count), options_(options) {}
+
+    /// @brief Initializes a new instance of the xtd::split_view class.
+    /// @param str The string to split.
+    /// @param separator The separator that delimits the substrings in str.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty substrings; or xtd::string_split_options::none to include them.
+    split_view(std::basic_string_view<char_t> str, const separator_t& separator, xtd::string_split_options options) noexcept : split_view(str, separator, std::numeric_limits<size_t>::max(), options) {}
+
+    /// @brief Returns an iterator to the first token.
+    /// @return An iterator to the first token.
+    iterator begin() const noexcept {return iterator(this, false);}
+
+    /// @brief Returns an iterator past the last token.
+    /// @return An iterator past the last token.
+    iterator end() const noexcept {return iterator(this, true);}
+
+  private:
+    static separator_storage_t store(const separator_t& separator) noexcept {
+      if constexpr (is_stored_by_value) return separator;
+      else return &separator;
+    }
+
+    size_t separator_length() const noexcept {
+      if constexpr (std::is_same<separator_t, char_t>::value || std::is_same<separator_t, xtd::char_set<char_t>>::value) return 1;
+      else if constexpr (std::is_same<separator_t, std::basic_string_view<char_t>>::value) return separator_.size();
+      else return separator_->value().size();
+    }
+
+    size_t find_separator(size_t start_index) const noexcept {
+      if constexpr (std::is_same<separator_t, char_t>::value || std::is_same<separator_t, std::basic_string_view<char_t>>::value) {
+        size_t index = str_.find(separator_, start_index);
+        return index == str_.npos ? npos : index;
+      } else if constexpr (std::is_same<separator_t, xtd::char_set<char_t>>::value) return separator_->find_first(str_, start_index);
+      else return separator_->find(str_, start_index);
+    }
+
+    // Mirrors xtd::strings::split: no trailing empty token, and the token past count - 1 keeps the rest of the string.
+    bool next(state& current, std::basic_string_view<char_t>& token) const noexcept {
+      if (current.finished || count_ == 0) return false;
+      size_t length = separator_length();
+      if (count_ == 1 || length == 0) {
+        current.finished = true;
+        token = str_;
+        return true;
+      }
+      for (size_t index = find_separator(current.position); index != npos; index = find_separator(current.position)) {
+        if (index != current.position || options_ != xtd::string_split_options::remove_empty_entries) {
+          if (++current.produced == count_) {
+            current.finished = true;
+            token = str_.substr(current.position);
+            return true;
+          }
+          token = str_.substr(current.position, index - current.position);
+          current.position = index + length;
+          return true;
+        }
+        current.position = index + length;
+      }
+      current.finished = true;
+      if (current.position >= str_.size()) return false;
+      token = str_.substr(current.position);
+      return true;
+    }
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    std::basic_string_view<char_t> str_;
+    separator_storage_t separator_;
+    size_t count_;
+    xtd::string_split_options options_;
+  };
+}
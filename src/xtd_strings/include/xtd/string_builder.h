@@ -0,0 +1,486 @@
+/// @file
+/// @brief Contains xtd::string_builder class.
+#pragma once
+
+#include "strings.h"
+
+/// @cond
+#define __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include "internal/__concat.h"
+
+/// @cond
+#undef __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Represents a mutable string built by pieces: the characters are appended into a chain of chunks, which are never moved, and copied into a std::basic_string once, by to_string.
+  /// @par Examples
+  /// @code
+  /// xtd::string_builder<char> builder;
+  /// builder.append("<ul>");
+  /// for (const auto& [name, value] : headers)
+  ///   builder.append_format("<li>{0}: {1}</li>", name, value);
+  /// builder.append("</ul>");
+  /// builder.write_to(fd);
+  /// @endcode
+  /// @remarks The first chunk, of inline_capacity characters, is stored in the builder itself, so that a builder on the stack allocates nothing for short strings. The next chunks hold chunk_capacity characters, or more for a longer appended string.
+  /// @remarks Appending never moves the characters already appended. Inserting or removing moves the characters of one chunk only: a chunk that is too small to insert into is split.
+  /// @remarks write_to writes the chunks one after the other to a stream, or with a single writev call to a file descriptor, without copying them into a single string.
+  template<typename char_t, size_t inline_capacity = 256>
+  class string_builder {
+  public:
+    /// @cond
+    using value_type = char_t;
+    using size_type = size_t;
+    /// @endcond
+
+    /// @brief Represents the value used when no string is found.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /// @brief Represents the capacity of the chunks allocated after the first one.
+    static constexpr size_t chunk_capacity = 8192;
+
+    /// @brief Initializes a new empty instance of the xtd::string_builder class.
+    string_builder() noexcept {}
+
+    /// @brief Initializes a new instance of the xtd::string_builder class with the specified string.
+    /// @param str The initial string.
+    explicit string_builder(std::basic_string_view<char_t> str) {append(str);}
+
+    /// @cond
+    string_builder(const string_builder& other) {append(other);}
+    string_builder(string_builder&& other) noexcept {take(other);}
+    ~string_builder() {release();}
+
+    string_builder& operator=(const string_builder& other) {
+      if (this != &other) {
+        clear();
+        append(other);
+      }
+      return *this;
+    }
+    string_builder& operator=(string_builder&& other) noexcept {
+      if (this != &other) {
+        release();
+        take(other);
+      }
+      return *this;
+    }
+    /// @endcond
+
+    /// @brief Gets the number of characters of this instance.
+    /// @return The number of characters.
+    size_t size() const noexcept {return length_;}
+    /// @cond
+    size_t length() const noexcept {return length_;}
+    /// @endcond
+
+    /// @brief Gets a value indicating whether this instance is empty.
+    /// @return true if this instance is empty; otherwise, false.
+    bool empty() const noexcept {return length_ == 0;}
+
+    /// @brief Gets the number of chunks of this instance, including the first one.
+    /// @return The number of chunks.
+    size_t chunk_count() const noexcept {return chunks_.size() + 1;}
+
+    /// @brief Gets the character at the specified index; the chunks are walked to find it.
+    /// @param index The index of the character.
+    /// @return The character.
+    /// @exception std::out_of_range index is greater than or equal to size().
+    char_t operator[](size_t index) const {
+      if (index >= length_) throw std::out_of_range("index out of range");
+      auto [chunk_index, offset] = locate(index);
+      return get_chunk(chunk_index).data[offset];
+    }
+
+    /// @brief Removes all the characters of this instance and releases the chunks allocated after the first one.
+    void clear() noexcept {
+      release();
+      first_ = {inline_, 0, inline_capacity};
+      length_ = 0;
+    }
+
+    /// @brief Appends the specified string to this instance.
+    /// @param str The string to append.
+    /// @return This instance.
+    string_builder& append(std::basic_string_view<char_t> str) {
+      size_t index = 0;
+      while (index < str.size()) {
+        chunk& last = get_chunk(chunk_count() - 1);
+        if (last.length == last.capacity) {
+          add_chunk(chunks_.size(), std::max(chunk_capacity, str.size() - index));
+          continue;
+        }
+        size_t count = std::min(str.size() - index, last.capacity - last.length);
+        std::char_traits<char_t>::copy(last.data + last.length, str.data() + index, count);
+        last.length += count;
+        index += count;
+      }
+      length_ += str.size();
+      return *this;
+    }
+
+    /// @cond
+    string_builder& append(const std::basic_string<char_t>& str) {return append(std::basic_string_view<char_t>(str));}
+    string_builder& append(const char_t* str) {return append(std::basic_string_view<char_t>(str));}
+    string_builder& append(char_t c) {
+      push_back(c);
+      return *this;
+    }
+    string_builder& append(const string_builder& other) {
+      other.for_each_piece(0, other.length_, [&](const char_t* data, size_t count) {append(std::basic_string_view<char_t>(data, count));});
+      return *this;
+    }
+    /// @endcond
+
+    /// @brief Appends a character repeated the specified number of times to this instance.
+    /// @param count The number of characters to append.
+    /// @param c The character to append.
+    /// @return This instance.
+    string_builder& append(size_t count, char_t c) {
+      for (; count; --count)
+        push_back(c);
+      return *this;
+    }
+
+    /// @brief Appends the text representation of the specified value to this instance, as xtd::strings::concat does.
+    /// @param value The value to append.
+    /// @return This instance.
+    template<typename value_t>
+    string_builder& append(const value_t& value) {
+      __concat_append(*this, value);
+      return *this;
+    }
+
+    /// @cond
+    void push_back(char_t c) {
+      chunk* last = &get_chunk(chunk_count() - 1);
+      if (last->length == last->capacity) last = &add_chunk(chunks_.size(), chunk_capacity);
+      last->data[last->length++] = c;
+      ++length_;
+    }
+    /// @endcond
+
+    /// @brief Appends the string returned by xtd::strings::format for the specified composite format string and arguments to this instance.
+    /// @param fmt A composite format string.
+    /// @param args The arguments to format.
+    /// @return This instance.
+    /// @remarks for more information about format see @ref FormatPage "Format".
+    template<typename ...args_t>
+    string_builder& append_format(const std::basic_string<char_t>& fmt, args_t&&... args) {return append(xtd::strings::format(fmt, std::forward<args_t>(args)...));}
+
+    /// @cond
+    template<typename ...args_t>
+    string_builder& append_format(const char_t* fmt, args_t&&... args) {return append(xtd::strings::format(fmt, std::forward<args_t>(args)...));}
+    /// @endcond
+
+    /// @brief Appends the elements of the specified collection, separated by the specified separator, to this instance, as xtd::strings::join does.
+    /// @param separator The separator.
+    /// @param values The collection of values to append.
+    /// @return This instance.
+    template<typename collection_t>
+    string_builder& append_join(std::basic_string_view<char_t> separator, const collection_t& values) {
+      bool first = true;
+      for (const auto& value : values) {
+        if (!first) append(separator);
+        __concat_append(*this, value);
+        first = false;
+      }
+      return *this;
+    }
+
+    /// @cond
+    template<typename value_t>
+    string_builder& append_join(std::basic_string_view<char_t> separator, const std::initializer_list<value_t>& values) {return append_join<std::initializer_list<value_t>>(separator, values);}
+    /// @endcond
+
+    /// @brief Inserts the specified string at the specified index of this instance.
+    /// @param index The index of the insertion.
+    /// @param str The string to insert.
+    /// @return This instance.
+    /// @exception std::out_of_range index is greater than size().
+    /// @remarks Only the characters that follow index in its chunk are moved; when the chunk is too small, they are moved into a new chunk inserted after it.
+    string_builder& insert(size_t index, std::basic_string_view<char_t> str) {
+      if (index > length_) throw std::out_of_range("index out of range");
+      if (index == length_) return append(str);
+      if (str.empty()) return *this;
+      if (contains_pointer(str.data())) return insert(index, std::basic_string<char_t>(str));
+      auto [chunk_index, offset] = locate(index);
+      chunk& target = get_chunk(chunk_index);
+      size_t tail = target.length - offset;
+      if (target.capacity - target.length >= str.size()) {
+        std::char_traits<char_t>::move(target.data + offset + str.size(), target.data + offset, tail);
+        std::char_traits<char_t>::copy(target.data + offset, str.data(), str.size());
+        target.length += str.size();
+      } else {
+        char_t* target_data = target.data;
+        chunk& added = add_chunk(chunk_index, std::max(chunk_capacity, str.size() + tail));
+        std::char_traits<char_t>::copy(added.data, str.data(), str.size());
+        std::char_traits<char_t>::copy(added.data + str.size(), target_data + offset, tail);
+        added.length = str.size() + tail;
+        get_chunk(chunk_index).length = offset;
+      }
+      length_ += str.size();
+      return *this;
+    }
+
+    /// @brief Removes the specified number of characters from this instance, starting at the specified index.
+    /// @param index The index of the first character to remove.
+    /// @param count The number of characters to remove; it is truncated to the end of this instance.
+    /// @return This instance.
+    /// @exception std::out_of_range index is greater than size().
+    string_builder& remove(size_t index, size_t count = npos) {
+      if (index > length_) throw std::out_of_range("index out of range");
+      count = std::min(count, length_ - index);
+      auto [chunk_index, offset] = locate(index);
+      for (size_t remaining = count; remaining; offset = 0) {
+        chunk& target = get_chunk(chunk_index);
+        size_t removed = std::min(remaining, target.length - offset);
+        std::char_traits<char_t>::move(target.data + offset, target.data + offset + removed, target.length - offset - removed);
+        target.length -= removed;
+        remaining -= removed;
+        if (target.length == 0 && chunk_index != 0) {
+          delete[] target.data;
+          chunks_.erase(chunks_.begin() + (chunk_index - 1));
+        } else
+          ++chunk_index;
+      }
+      length_ -= count;
+      return *this;
+    }
+
+    /// @brief Replaces all occurrences of a specified character with another one.
+    /// @param old_char The character to be replaced.
+    /// @param new_char The character to replace all occurrences of old_char.
+    /// @return This instance.
+    string_builder& replace(char_t old_char, char_t new_char) noexcept {
+      for (size_t index = 0; index < chunk_count(); ++index) {
+        chunk& current = get_chunk(index);
+        std::replace(current.data, current.data + current.length, old_char, new_char);
+      }
+      return *this;
+    }
+
+    /// @brief Replaces all occurrences of a specified string with another one; the occurrences can span several chunks.
+    /// @param old_value The string to be replaced.
+    /// @param new_value The string to replace all occurrences of old_value.
+    /// @return This instance.
+    /// @exception std::invalid_argument old_value is empty.
+    string_builder& replace(std::basic_string_view<char_t> old_value, std::basic_string_view<char_t> new_value) {
+      if (old_value.empty()) throw std::invalid_argument("old_value cannot be empty");
+      size_t index = index_of(old_value);
+      if (index == npos) return *this;
+      string_builder result;
+      size_t position = 0;
+      for (; index != npos; index = index_of(old_value, position)) {
+        for_each_piece(position, index - position, [&](const char_t* data, size_t count) {result.append(std::basic_string_view<char_t>(data, count));});
+        result.append(new_value);
+        position = index + old_value.size();
+      }
+      for_each_piece(position, length_ - position, [&](const char_t* data, size_t count) {result.append(std::basic_string_view<char_t>(data, count));});
+      return *this = std::move(result);
+    }
+
+    /// @brief Replaces the specified number of characters of this instance, starting at the specified index, with the specified string.
+    /// @param index The index of the first character to replace.
+    /// @param count The number of characters to replace; it is truncated to the end of this instance.
+    /// @param str The string that replaces the characters.
+    /// @return This instance.
+    /// @exception std::out_of_range index is greater than size().
+    string_builder& replace(size_t index, size_t count, std::basic_string_view<char_t> str) {
+      if (contains_pointer(str.data())) return replace(index, count, std::basic_string<char_t>(str));
+      return remove(index, count).insert(index, str);
+    }
+
+    /// @brief Reports the index of the first occurrence of the specified string in this instance; the occurrence can span several chunks.
+    /// @param value The string to seek.
+    /// @param start_index The search starting position.
+    /// @return The index of value if that string is found, or xtd::string_builder::npos if it is not.
+    size_t index_of(std::basic_string_view<char_t> value, size_t start_index = 0) const noexcept {
+      if (start_index > length_) return npos;
+      if (value.empty()) return start_index;
+      size_t base = 0;
+      for (size_t index = 0; index < chunk_count(); base += get_chunk(index++).length) {
+        const chunk& current = get_chunk(index);
+        if (base + current.length <= start_index) continue;
+        for (size_t offset = start_index > base ? start_index - base : 0; offset < current.length; ++offset) {
+          const char_t* found = std::char_traits<char_t>::find(current.data + offset, current.length - offset, value[0]);
+          if (!found) break;
+          offset = found - current.data;
+          if (matches(index, offset, value)) return base + offset;
+        }
+      }
+      return npos;
+    }
+
+    /// @brief Copies the characters of this instance into a new string, allocated once.
+    /// @return A new string.
+    std::basic_string<char_t> to_string() const {
+      std::basic_string<char_t> result;
+      result.reserve(length_);
+      for_each_piece(0, length_, [&](const char_t* data, size_t count) {result.append(data, count);});
+      return result;
+    }
+
+    /// @brief Writes the characters of this instance to the specified stream, chunk by chunk.
+    /// @param os The output stream.
+    void write_to(std::basic_ostream<char_t>& os) const {
+      for_each_piece(0, length_, [&](const char_t* data, size_t count) {os.write(data, static_cast<std::streamsize>(count));});
+    }
+
+    /// @brief Writes the characters of this instance to the specified file descriptor, with as few writev calls as possible.
+    /// @param fd The file descriptor.
+    /// @exception std::system_error The write failed.
+    /// @remarks The characters are written as they are stored in memory, sizeof(char_t) bytes each. On Windows, where writev does not exist, the chunks are written one after the other.
+    void write_to(int fd) const {
+#if defined(_WIN32)
+      for_each_piece(0, length_, [&](const char_t* data, size_t count) {
+        const char* bytes = reinterpret_cast<const char*>(data);
+        for (size_t remaining = count * sizeof(char_t); remaining;) {
+          int written = _write(fd, bytes, static_cast<unsigned>(std::min(remaining, size_t(1) << 30)));
+          if (written < 0) throw std::system_error(errno, std::generic_category(), "write");
+          bytes += written;
+          remaining -= written;
+        }
+      });
+#else
+      constexpr size_t max_vectors = 64;
+      iovec vectors[max_vectors];
+      size_t chunk_index = 0, byte_offset = 0;
+      while (chunk_index < chunk_count()) {
+        size_t vector_count = 0;
+        for (size_t index = chunk_index, offset = byte_offset; index < chunk_count() && vector_count < max_vectors; ++index, offset = 0) {
+          const chunk& current = get_chunk(index);
+          if (current.length * sizeof(char_t) == offset) continue;
+          vectors[vector_count].iov_base = const_cast<char*>(reinterpret_cast<const char*>(current.data) + offset);
+          vectors[vector_count++].iov_len = current.length * sizeof(char_t) - offset;
+        }
+        if (vector_count == 0) break;
+        ssize_t written = ::writev(fd, vectors, static_cast<int>(vector_count));
+        if (written < 0) {
+          if (errno == EINTR) continue;
+          throw std::system_error(errno, std::generic_category(), "writev");
+        }
+        for (size_t remaining = static_cast<size_t>(written); chunk_index < chunk_count(); ++chunk_index, byte_offset = 0) {
+          size_t available = get_chunk(chunk_index).length * sizeof(char_t) - byte_offset;
+          if (remaining < available) {
+            byte_offset += remaining;
+            break;
+          }
+          remaining -= available;
+        }
+      }
+#endif
+    }
+
+    /// @cond
+    friend std::basic_ostream<char_t>& operator<<(std::basic_ostream<char_t>& os, const string_builder& builder) {
+      builder.write_to(os);
+      return os;
+    }
+    /// @endcond
+
+  private:
+    struct chunk {
+      char_t* data;
+      size_t length;
+      size_t capacity;
+    };
+
+    chunk& get_chunk(size_t index) noexcept {return index == 0 ? first_ : chunks_[index - 1];}
+    const chunk& get_chunk(size_t index) const noexcept {return index == 0 ? first_ : chunks_[index - 1];}
+
+    // Inserts a new empty chunk after the chunk at index, and returns it.
+    chunk& add_chunk(size_t index, size_t capacity) {
+      std::unique_ptr<char_t[]> data(new char_t[capacity]);
+      chunks_.insert(chunks_.begin() + index, chunk {data.get(), 0, capacity});
+      data.release();
+      return chunks_[index];
+    }
+
+    // Returns the chunk that holds the character at index and the offset of the character in it; the end of the last chunk for length_.
+    std::pair<size_t, size_t> locate(size_t index) const noexcept {
+      for (size_t chunk_index = 0; chunk_index < chunk_count(); ++chunk_index) {
+        if (index < get_chunk(chunk_index).length) return {chunk_index, index};
+        index -= get_chunk(chunk_index).length;
+      }
+      return {chunk_count() - 1, get_chunk(chunk_count() - 1).length};
+    }
+
+    // Calls function with the pieces of the chunks that hold the count characters from index.
+    template<typename function_t>
+    void for_each_piece(size_t index, size_t count, function_t function) const {
+      if (count == 0) return;
+      auto [chunk_index, offset] = locate(index);
+      for (; count && chunk_index < chunk_count(); ++chunk_index, offset = 0) {
+        const chunk& current = get_chunk(chunk_index);
+        size_t piece = std::min(count, current.length - offset);
+        if (piece) function(current.data + offset, piece);
+        count -= piece;
+      }
+    }
+
+    bool matches(size_t chunk_index, size_t offset, std::basic_string_view<char_t> value) const noexcept {
+      for (size_t index = 0; index < value.size(); ++chunk_index, offset = 0) {
+        if (chunk_index >= chunk_count()) return false;
+        const chunk& current = get_chunk(chunk_index);
+        size_t count = std::min(value.size() - index, current.length - offset);
+        if (std::char_traits<char_t>::compare(current.data + offset, value.data() + index, count) != 0) return false;
+        index += count;
+      }
+      return true;
+    }
+
+    bool contains_pointer(const char_t* pointer) const noexcept {
+      for (size_t index = 0; index < chunk_count(); ++index) {
+        const chunk& current = get_chunk(index);
+        if (!std::less<const char_t*>()(pointer, current.data) && std::less<const char_t*>()(pointer, current.data + current.capacity)) return true;
+      }
+      return false;
+    }
+
+    void take(string_builder& other) noexcept {
+      std::char_traits<char_t>::copy(inline_, other.inline_, other.first_.length);
+      first_ = {inline_, other.first_.length, inline_capacity};
+      chunks_ = std::move(other.chunks_);
+      length_ = other.length_;
+      other.chunks_.clear();
+      other.clear();
+    }
+
+    void release() noexcept {
+      for (auto& current : chunks_)
+        delete[] current.data;
+      chunks_.clear();
+    }
+
+    char_t inline_[inline_capacity];
+    chunk first_ {inline_, 0, inline_capacity};
+    std::vector<chunk> chunks_;
+    size_t length_ = 0;
+  };
+}
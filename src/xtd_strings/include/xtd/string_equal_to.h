@@ -0,0 +1,52 @@
+/// @file
+/// @brief Contains xtd::string_equal_to class.
+#pragma once
+
+#include "string_comparison.h"
+
+/// @cond
+#define __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include "internal/__ignore_case.h"
+
+/// @cond
+#undef __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include <string_view>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Represents an equality predicate for strings that follows the rules of an xtd::string_comparison, to be used with xtd::string_hasher in unordered containers.
+  /// @remarks Two strings are equal if xtd::strings::equals returns true for them with the same xtd::string_comparison.
+  /// @remarks The predicate is transparent: std::basic_string, std::basic_string_view and null-terminated strings are compared alike.
+  template<typename char_t>
+  class string_equal_to {
+  public:
+    /// @cond
+    using is_transparent = void;
+    /// @endcond
+
+    /// @brief Initializes a new instance of the xtd::string_equal_to class.
+    /// @param comparison_type One of the enumeration values that specifies the rules for the comparison.
+    explicit string_equal_to(xtd::string_comparison comparison_type = xtd::string_comparison::ordinal) noexcept : comparison_type_(comparison_type) {}
+
+    /// @brief Gets the rules used for the comparison.
+    /// @return One of the enumeration values that specifies the rules for the comparison.
+    xtd::string_comparison comparison_type() const noexcept {return comparison_type_;}
+
+    /// @brief Determines whether the specified strings are equal.
+    /// @param str_a The first string to compare.
+    /// @param str_b The second string to compare.
+    /// @return true if str_a and str_b are equal; otherwise, false.
+    bool operator()(std::basic_string_view<char_t> str_a, std::basic_string_view<char_t> str_b) const noexcept {
+      if (str_a.size() != str_b.size()) return false;
+      if (comparison_type_ == xtd::string_comparison::ordinal_ignore_case) return __mismatch_ignore_case(str_a.data(), str_b.data(), str_a.size()) == str_a.size();
+      return str_a == str_b;
+    }
+
+  private:
+    xtd::string_comparison comparison_type_;
+  };
+}
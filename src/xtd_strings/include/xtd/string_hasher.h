@@ -0,0 +1,62 @@
+/// @file
+/// @brief Contains xtd::string_hasher class.
+#pragma once
+
+#include "string_comparison.h"
+
+/// @cond
+#define __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include "internal/__hash.h"
+
+/// @cond
+#undef __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Represents a hash function for strings that follows the rules of an xtd::string_comparison, to be used with xtd::string_equal_to in unordered containers.
+  /// @par Examples
+  /// @code
+  /// std::unordered_map<std::string, int, xtd::string_hasher<char>, xtd::string_equal_to<char>> headers {0, xtd::string_hasher<char> {xtd::string_comparison::ordinal_ignore_case}, xtd::string_equal_to<char> {xtd::string_comparison::ordinal_ignore_case}};
+  /// headers["Content-Length"] = 42;
+  /// auto length = headers.find("content-length");
+  /// @endcode
+  /// @remarks The hash codes are the ones of xtd::strings::get_hash_code: wyhash over the characters, folded by blocks when case is ignored, so that the keys are never copied.
+  /// @remarks The seed is 0 unless XTD_STRINGS_RANDOM_HASH_SEED is defined, in which case it is drawn at random once per process to resist hash flooding. Define it for the whole program, not for some translation units only.
+  /// @remarks The hasher is transparent: std::basic_string, std::basic_string_view and null-terminated strings are hashed alike.
+  template<typename char_t>
+  class string_hasher {
+  public:
+    /// @cond
+    using is_transparent = void;
+    /// @endcond
+
+    /// @brief Initializes a new instance of the xtd::string_hasher class.
+    /// @param comparison_type One of the enumeration values that specifies the rules for the hash.
+    explicit string_hasher(xtd::string_comparison comparison_type = xtd::string_comparison::ordinal) noexcept : comparison_type_(comparison_type), seed_(__hash_seed()) {}
+
+    /// @brief Initializes a new instance of the xtd::string_hasher class with the specified seed.
+    /// @param comparison_type One of the enumeration values that specifies the rules for the hash.
+    /// @param seed The seed of the hash function.
+    string_hasher(xtd::string_comparison comparison_type, uint64_t seed) noexcept : comparison_type_(comparison_type), seed_(seed) {}
+
+    /// @brief Gets the rules used for the hash.
+    /// @return One of the enumeration values that specifies the rules for the hash.
+    xtd::string_comparison comparison_type() const noexcept {return comparison_type_;}
+
+    /// @brief Returns the hash code of the specified string.
+    /// @param str The string to hash.
+    /// @return A hash code.
+    size_t operator()(std::basic_string_view<char_t> str) const noexcept {return __hash_string(str, comparison_type_ == xtd::string_comparison::ordinal_ignore_case, seed_);}
+
+  private:
+    xtd::string_comparison comparison_type_;
+    uint64_t seed_;
+  };
+}
@@ -0,0 +1,240 @@
+/// @file
+/// @brief Contains xtd::string_pool and xtd::interned_basic_string classes.
+#pragma once
+
+#include "istring.h"
+
+/// @cond
+#define __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include "internal/__hash.h"
+
+/// @cond
+#undef __XTD_STRINGS_INCLUDE__
+/// @endcond
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  template<typename char_t>
+  class string_pool;
+
+  /// @brief Represents a string interned in an xtd::string_pool: a single pointer to the characters, which are stored once in the pool.
+  /// @remarks Two interned strings of the same pool are equal if and only if they point to the same characters, so that equality and hash code are O(1). Interned strings of different pools are never equal, except when they are both empty.
+  /// @remarks An interned string is valid as long as its pool; the pool returned by xtd::string_pool::shared lives until the end of the program.
+  template<typename char_t>
+  class interned_basic_string {
+  public:
+    /// @cond
+    using value_type = char_t;
+    using size_type = size_t;
+    using const_iterator = const char_t*;
+    /// @endcond
+
+    /// @brief Initializes a new empty instance of the xtd::interned_basic_string class.
+    interned_basic_string() noexcept = default;
+
+    /// @brief Gets the characters of this string, terminated by a null character.
+    /// @return The characters of this string.
+    const char_t* c_str() const noexcept {return entry_ ? entry_->data() : empty_;}
+    /// @cond
+    const char_t* data() const noexcept {return c_str();}
+    const char_t* begin() const noexcept {return c_str();}
+    const char_t* end() const noexcept {return c_str() + size();}
+    const char_t& operator[](size_t index) const noexcept {return c_str()[index];}
+    size_t length() const noexcept {return size();}
+    /// @endcond
+
+    /// @brief Gets the number of characters of this string.
+    /// @return The number of characters.
+    size_t size() const noexcept {return entry_ ? entry_->length : 0;}
+
+    /// @brief Gets a value indicating whether this string is empty.
+    /// @return true if this string is empty; otherwise, false.
+    bool empty() const noexcept {return !entry_;}
+
+    /// @brief Returns the hash code for this string, the same as xtd::strings::get_hash_code; it is computed when the string is interned.
+    /// @return A hash code.
+    size_t get_hash_code() const noexcept {return entry_ ? entry_->hash_code : __hash_string(std::basic_string_view<char_t>(), false, __hash_seed());}
+
+    /// @brief Returns an xtd::immutable_basic_string with the characters of this string.
+    /// @return A new xtd::immutable_basic_string.
+    xtd::immutable_basic_string<char_t> to_istring() const {return xtd::immutable_basic_string<char_t>(c_str(), size());}
+
+    /// @cond
+    operator std::basic_string_view<char_t>() const noexcept {return std::basic_string_view<char_t>(c_str(), size());}
+    explicit operator std::basic_string<char_t>() const {return std::basic_string<char_t>(c_str(), size());}
+
+    friend bool operator==(interned_basic_string a, interned_basic_string b) noexcept {return a.entry_ == b.entry_;}
+    friend bool operator!=(interned_basic_string a, interned_basic_string b) noexcept {return a.entry_ != b.entry_;}
+    friend std::basic_ostream<char_t>& operator<<(std::basic_ostream<char_t>& os, interned_basic_string str) {return os << std::basic_string_view<char_t>(str);}
+    /// @endcond
+
+  private:
+    friend class xtd::string_pool<char_t>;
+    struct entry {
+      size_t hash_code;
+      size_t length;
+      const char_t* data() const noexcept {return reinterpret_cast<const char_t*>(this + 1);}
+    };
+
+    explicit interned_basic_string(const entry* value) noexcept : entry_(value) {}
+
+    static constexpr char_t empty_[1] {};
+    const entry* entry_ = nullptr;
+  };
+
+  /// @brief Represents a pool of interned strings: each distinct string is stored once, and interning it again returns the same xtd::interned_basic_string.
+  /// @par Examples
+  /// @code
+  /// auto& pool = xtd::string_pool<char>::shared();
+  /// std::unordered_map<xtd::interned_istring, double> metrics;
+  /// metrics[pool.intern("http.requests")] += 1;
+  /// @endcode
+  /// @remarks The pool can be used from several threads at once. It is split into shards, selected by the hash code of the strings, each one locked by its own mutex; a shard is an open-addressing hash table of pointers to its strings.
+  /// @remarks The strings are stored one after the other, with their hash code and their length, in blocks owned by their shard. They are released with the pool only.
+  template<typename char_t>
+  class string_pool {
+  public:
+    /// @brief Initializes a new empty instance of the xtd::string_pool class.
+    string_pool() = default;
+    /// @cond
+    string_pool(const string_pool&) = delete;
+    string_pool& operator=(const string_pool&) = delete;
+    /// @endcond
+
+    /// @brief Gets a pool that lives until the end of the program.
+    /// @return The shared pool.
+    static string_pool& shared() {
+      static string_pool* pool = new string_pool();
+      return *pool;
+    }
+
+    /// @brief Interns the specified string.
+    /// @param str The string to intern.
+    /// @return The interned string, whose characters are stored once in this pool.
+    interned_basic_string<char_t> intern(std::basic_string_view<char_t> str) {
+      if (str.empty()) return interned_basic_string<char_t>();
+      return intern(str, __hash_string(str, false, __hash_seed()));
+    }
+
+    /// @brief Interns the specified string.
+    /// @param str The string to intern.
+    /// @return The interned string, whose characters are stored once in this pool.
+    /// @remarks The hash code cached by str is used, if any.
+    interned_basic_string<char_t> intern(const xtd::immutable_basic_string<char_t>& str) {
+      if (str.empty()) return interned_basic_string<char_t>();
+      return intern(std::basic_string_view<char_t>(str), str.get_hash_code());
+    }
+
+    /// @cond
+    interned_basic_string<char_t> intern(const std::basic_string<char_t>& str) {return intern(std::basic_string_view<char_t>(str));}
+    interned_basic_string<char_t> intern(const char_t* str) {return intern(std::basic_string_view<char_t>(str));}
+    /// @endcond
+
+    /// @brief Gets the number of distinct non-empty strings in this pool.
+    /// @return The number of strings.
+    size_t size() const {
+      size_t result = 0;
+      for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        result += shard.count;
+      }
+      return result;
+    }
+
+  private:
+    using entry = typename interned_basic_string<char_t>::entry;
+    static constexpr size_t shard_count = 16;
+    static constexpr size_t block_size = 16384;
+
+    struct shard {
+      mutable std::mutex mutex;
+      std::vector<const entry*> table;
+      size_t count = 0;
+      std::vector<std::unique_ptr<unsigned char[]>> blocks;
+      unsigned char* block_position = nullptr;
+      size_t block_remaining = 0;
+    };
+
+    interned_basic_string<char_t> intern(std::basic_string_view<char_t> str, size_t hash_code) {
+      shard& current = shards_[hash_code % shard_count];
+      std::lock_guard<std::mutex> lock(current.mutex);
+      if ((current.count + 1) * 4 > current.table.size() * 3) grow(current);
+      size_t mask = current.table.size() - 1;
+      for (size_t index = (hash_code / shard_count) & mask;; index = (index + 1) & mask) {
+        const entry* value = current.table[index];
+        if (!value) break;
+        if (value->hash_code == hash_code && std::basic_string_view<char_t>(value->data(), value->length) == str) return interned_basic_string<char_t>(value);
+      }
+      const entry* value = create(current, str, hash_code);
+      insert(current.table, value);
+      ++current.count;
+      return interned_basic_string<char_t>(value);
+    }
+
+    static void insert(std::vector<const entry*>& table, const entry* value) noexcept {
+      size_t mask = table.size() - 1;
+      size_t index = (value->hash_code / shard_count) & mask;
+      while (table[index]) index = (index + 1) & mask;
+      table[index] = value;
+    }
+
+    static void grow(shard& target) {
+      std::vector<const entry*> table(std::max(size_t(64), target.table.size() * 2), nullptr);
+      for (const entry* value : target.table)
+        if (value) insert(table, value);
+      target.table.swap(table);
+    }
+
+    static const entry* create(shard& target, std::basic_string_view<char_t> str, size_t hash_code) {
+      size_t size = (sizeof(entry) + (str.size() + 1) * sizeof(char_t) + alignof(entry) - 1) / alignof(entry) * alignof(entry);
+      if (size > target.block_remaining) {
+        size_t new_block_size = std::max(size, block_size);
+        target.blocks.emplace_back(new unsigned char[new_block_size]);
+        target.block_position = target.blocks.back().get();
+        target.block_remaining = new_block_size;
+      }
+      entry* value = new (target.block_position) entry {hash_code, str.size()};
+      char_t* data = const_cast<char_t*>(value->data());
+      std::char_traits<char_t>::copy(data, str.data(), str.size());
+      data[str.size()] = char_t();
+      target.block_position += size;
+      target.block_remaining -= size;
+      return value;
+    }
+
+    std::array<shard, shard_count> shards_;
+  };
+
+  /// @brief Represents a string interned in an xtd::string_pool<char>.
+  using interned_istring = interned_basic_string<char>;
+
+  /// @brief Represents a string interned in an xtd::string_pool<char16_t>.
+  using interned_iu16string = interned_basic_string<char16_t>;
+
+  /// @brief Represents a string interned in an xtd::string_pool<char32_t>.
+  using interned_iu32string = interned_basic_string<char32_t>;
+
+  /// @brief Represents a string interned in an xtd::string_pool<wchar_t>.
+  using interned_iwstring = interned_basic_string<wchar_t>;
+}
+
+/// @cond
+template<typename char_t>
+struct std::hash<xtd::interned_basic_string<char_t>> {
+  size_t operator()(xtd::interned_basic_string<char_t> str) const noexcept {return str.get_hash_code();}
+};
+/// @endcond
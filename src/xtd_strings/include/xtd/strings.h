@@ -6,16 +6,32 @@
 #define __XTD_STRINGS_INCLUDE__
 /// @endcond
 
+#include "internal/__concat.h"
 #include "internal/__format.h"
 #include "internal/__format_information.h"
 #include "internal/__format_stringer.h"
+#include "internal/__hash.h"
+#include "internal/__ignore_case.h"
+#include "internal/__to_case.h"
+#include "char_set.h"
+#include "fixed_string.h"
 #include "istring.h"
+#include "pattern_set.h"
+#include "prefix_trie.h"
+#include "searcher.h"
+#include "split_view.h"
 #include "string_comparison.h"
+#include "string_equal_to.h"
+#include "string_hasher.h"
 #include "string_split_options.h"
 
 #include <algorithm>
 #include <bitset>
 #include <cctype>
+#include <locale>
+#include <memory>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #if !defined(_WIN32)
@@ -26,8 +42,29 @@
 #undef min
 
 /// @cond
-template<typename char_t, typename ...args_t>
-void __extract_format_arg(std::basic_string<char_t>& fmt, std::vector<__format_information<char_t>>& format, args_t&&... args);
+template<typename char_t, typename allocator_t>
+using __string_vector = std::vector<std::basic_string<char_t, std::char_traits<char_t>, allocator_t>, typename std::allocator_traits<allocator_t>::template rebind_alloc<std::basic_string<char_t, std::char_traits<char_t>, allocator_t>>>;
+
+template<typename char_t, typename allocator_t, typename ...args_t>
+void __extract_format_arg(std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& fmt, std::vector<__format_information<char_t>>& format, args_t&&... args);
+
+template<typename char_t, size_t capacity, typename arg_t>
+bool __format_to_arg(xtd::fixed_string<char_t, capacity>& result, arg_t&& arg, std::basic_string_view<char_t> format, int alignment, xtd::fixed_string_overflow overflow);
+
+// Parses an alignment as std::stoi does: leading white-spaces, an optional sign and digits, then anything. As with xtd::strings::format, an empty alignment is no alignment.
+template<typename char_t>
+inline int __parse_format_alignment(std::basic_string_view<char_t> alignment) {
+  if (alignment.empty()) return 0;
+  size_t index = 0;
+  while (index < alignment.size() && (alignment[index] == char_t(' ') || (alignment[index] >= char_t('\t') && alignment[index] <= char_t('\r')))) ++index;
+  bool negative = index < alignment.size() && alignment[index] == char_t('-');
+  if (index < alignment.size() && (alignment[index] == char_t('-') || alignment[index] == char_t('+'))) ++index;
+  if (index == alignment.size() || alignment[index] < char_t('0') || alignment[index] > char_t('9')) throw std::invalid_argument("Invalid format expression");
+  int result = 0;
+  for (; index < alignment.size() && alignment[index] >= char_t('0') && alignment[index] <= char_t('9'); ++index)
+    result = result * 10 + (alignment[index] - char_t('0'));
+  return negative ? -result : result;
+}
 /// @endcond
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
@@ -44,12 +81,33 @@ namespace xtd {
   /// @endcond
   
   /// @brief The strings Caintains string operation methods.
+  /// @remarks concat, format, join, pad_left, pad_right, replace, split, to_lower, to_upper, trim, trim_end and trim_start accept strings with any allocator, such as std::pmr::string, and return strings with the allocator of their string parameter. concat and format also take an allocator after std::allocator_arg.
   class strings {
   public:
     /// @cond
     strings() = delete;
     /// @endcond
     
+    /// @brief Represents a substring to seek, preprocessed once so that it can be searched for in many strings with contains, index_of, last_index_of, replace and split.
+    /// @remarks See xtd::searcher.
+    template<typename char_t>
+    using searcher = xtd::searcher<char_t>;
+    
+    /// @brief Represents a set of substrings compiled once so that a string is searched for all of them in a single pass with contains_any and index_of_any.
+    /// @remarks See xtd::pattern_set.
+    template<typename char_t>
+    using pattern_set = xtd::pattern_set<char_t>;
+    
+    /// @brief Represents a hash function for strings that follows the rules of an xtd::string_comparison, to key unordered containers with equal_to.
+    /// @remarks See xtd::string_hasher.
+    template<typename char_t>
+    using hasher = xtd::string_hasher<char_t>;
+    
+    /// @brief Represents an equality predicate for strings that follows the rules of an xtd::string_comparison, to key unordered containers with hasher.
+    /// @remarks See xtd::string_equal_to.
+    template<typename char_t>
+    using equal_to = xtd::string_equal_to<char_t>;
+    
     /// @brief Gets the fully qualified class name of the objec_t, including the namespace of the objec_t.
     /// @return The fully qualified class name of the objec_t, including the namespace of the objec_t.
     /// @remarks For example, the fully qualified name of the strings type is xtd::strings.
@@ -88,15 +146,15 @@ namespace xtd {
     /// | Zero              | str_a occurs in the same position as str_b in the sort order. |
     /// | Greater than zero | str_a follows str_b in the sort order.                        |
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b) noexcept {return compare(str_a, str_b, false);}
+    static int compare(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), false);}
     
     /// @cond
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, const char_t* str_b) noexcept {return compare(str_a, str_b, false);}
+    static int compare(const std::basic_string<char_t>& str_a, const char_t* str_b) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), false);}
     template<typename char_t>
-    static int compare(const char_t* str_a, const std::basic_string<char_t>& str_b) noexcept {return compare(str_a, str_b, false);}
+    static int compare(const char_t* str_a, const std::basic_string<char_t>& str_b) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), false);}
     template<typename char_t>
-    static int compare(const char_t* str_a, const char_t* str_b) noexcept {return compare(str_a, str_b, false);}
+    static int compare(const char_t* str_a, const char_t* str_b) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), false);}
     /// @endcond
     
     
@@ -111,15 +169,15 @@ namespace xtd {
     /// | Zero              | str_a occurs in the same position as str_b in the sort order. |
     /// | Greater than zero | str_a follows str_b in the sort order.                        |
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b, bool ignore_case) noexcept {return compare(str_a, str_b, ignore_case ? xtd::string_comparison::ordinal_ignore_case : xtd::string_comparison::ordinal);}
+    static int compare(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b, bool ignore_case) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), ignore_case ? xtd::string_comparison::ordinal_ignore_case : xtd::string_comparison::ordinal);}
     
     /// @cond
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, const char_t* str_b, bool ignore_case) noexcept {return compare(str_a, std::basic_string<char_t>(str_b), ignore_case);}
+    static int compare(const std::basic_string<char_t>& str_a, const char_t* str_b, bool ignore_case) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), ignore_case);}
     template<typename char_t>
-    static int compare(const char_t* str_a, const std::basic_string<char_t>& str_b, bool ignore_case) noexcept {return compare(std::basic_string<char_t>(str_a), str_b, ignore_case);}
+    static int compare(const char_t* str_a, const std::basic_string<char_t>& str_b, bool ignore_case) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), ignore_case);}
     template<typename char_t>
-    static int compare(const char_t* str_a, const char_t* str_b, bool ignore_case) noexcept {return compare(std::basic_string<char_t>(str_a), std::basic_string<char_t>(str_b), ignore_case);}
+    static int compare(const char_t* str_a, const char_t* str_b, bool ignore_case) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), ignore_case);}
     /// @endcond
     
     /// @brief Compares two specified String objects using the specified rules, and returns an integer that indicates their relative position in the sort order.
@@ -133,19 +191,15 @@ namespace xtd {
     /// | Zero              | str_a occurs in the same position as str_b in the sort order. |
     /// | Greater than zero | str_a follows str_b in the sort order.                        |
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b, xtd::string_comparison comparison_type) noexcept {
-      if (comparison_type == xtd::string_comparison::ordinal_ignore_case)
-        return to_lower(str_a).compare(to_lower(str_b));
-      return str_a.compare(str_b);
-    }
+    static int compare(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), comparison_type);}
     
     /// @cond
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, const char_t* str_b, xtd::string_comparison comparison_type) noexcept {return compare(str_a, std::basic_string<char_t>(str_b), comparison_type);}
+    static int compare(const std::basic_string<char_t>& str_a, const char_t* str_b, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), comparison_type);}
     template<typename char_t>
-    static int compare(const char_t* str_a, const std::basic_string<char_t>& str_b, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string<char_t>(str_a), str_b, comparison_type);}
+    static int compare(const char_t* str_a, const std::basic_string<char_t>& str_b, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), comparison_type);}
     template<typename char_t>
-    static int compare(const char_t* str_a, const char_t* str_b, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string<char_t>(str_a), std::basic_string<char_t>(str_b), comparison_type);}
+    static int compare(const char_t* str_a, const char_t* str_b, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), comparison_type);}
     /// @endcond
     
     /// @brief Compares substrings of two specified String objects and returns an integer that indicates their relative position in the sort order.
@@ -161,15 +215,15 @@ namespace xtd {
     /// | Zero              | str_a occurs in the same position as str_b in the sort order. |
     /// | Greater than zero | str_a follows str_b in the sort order.                        |
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length) noexcept {return compare(str_a, index_a, str_b, index_b, length, false);}
+    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, false);}
     
     /// @cond
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length) noexcept {return compare(str_a, index_a, str_b, index_b, length, false);}
+    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, false);}
     template<typename char_t>
-    static int compare(const char_t* str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length) noexcept {return compare(str_a, index_a, str_b, index_b, length, false);}
+    static int compare(const char_t* str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, false);}
     template<typename char_t>
-    static int compare(const char_t* str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length) noexcept {return compare(str_a, index_a, str_b, index_b, length, false);}
+    static int compare(const char_t* str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, false);}
     /// @endcond
     
     
@@ -187,19 +241,15 @@ namespace xtd {
     /// | Zero              | str_a occurs in the same position as str_b in the sort order. |
     /// | Greater than zero | str_a follows str_b in the sort order.                        |
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length, bool ignore_case) noexcept {
-      std::basic_string<char_t> sa(str_a.substr(index_a, length));
-      std::basic_string<char_t> sb(str_b.substr(index_b, length));
-      return compare(str_a, index_a, str_b, index_b, length, ignore_case ? xtd::string_comparison::ordinal_ignore_case : xtd::string_comparison::ordinal);
-    }
+    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length, bool ignore_case) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, ignore_case);}
     
     /// @cond
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length, bool ignore_case) noexcept {return compare(str_a, index_a, std::basic_string<char_t>(str_b), index_b, length, ignore_case);}
+    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length, bool ignore_case) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, ignore_case);}
     template<typename char_t>
-    static int compare(const char_t* str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length, bool ignore_case) noexcept {return compare(std::basic_string<char_t>(str_a), index_a, str_b, index_b, length, ignore_case);}
+    static int compare(const char_t* str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length, bool ignore_case) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, ignore_case);}
     template<typename char_t>
-    static int compare(const char_t* str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length, bool ignore_case) noexcept {return compare(std::basic_string<char_t>(str_a), index_a, std::basic_string<char_t>(str_b), index_b, length, ignore_case);}
+    static int compare(const char_t* str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length, bool ignore_case) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, ignore_case);}
     /// @endcond
     
     /// @brief Compares substrings of two specified String objects using the specified rules, and returns an integer that indicates their relative position in the sort order.
@@ -216,264 +266,158 @@ namespace xtd {
     /// | Zero              | str_a occurs in the same position as str_b in the sort order. |
     /// | Greater than zero | str_a follows str_b in the sort order.                        |
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length, xtd::string_comparison comparison_type) noexcept {
-      std::basic_string<char_t> sa(str_a.substr(index_a, length));
-      std::basic_string<char_t> sb(str_b.substr(index_b, length));
-      if (comparison_type == xtd::string_comparison::ordinal_ignore_case)
-        return to_lower(sa).compare(to_lower(sb));
-      return sa.compare(sb);
-    }
+    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, comparison_type);}
     
     /// @cond
     template<typename char_t>
-    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length, xtd::string_comparison comparison_type) noexcept {return compare(str_a, index_a, std::basic_string<char_t>(str_b), index_b, length, comparison_type);}
+    static int compare(const std::basic_string<char_t>& str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, comparison_type);}
     template<typename char_t>
-    static int compare(const char_t* str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string<char_t>(str_a), index_a, str_b, index_b, length, comparison_type);}
+    static int compare(const char_t* str_a, size_t index_a, const std::basic_string<char_t>& str_b, size_t index_b, size_t length, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, comparison_type);}
     template<typename char_t>
-    static int compare(const char_t* str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string<char_t>(str_a), index_a, std::basic_string<char_t>(str_b), index_b, length, comparison_type);}
+    static int compare(const char_t* str_a, size_t index_a, const char_t* str_b, size_t index_b, size_t length, xtd::string_comparison comparison_type) noexcept {return compare(std::basic_string_view<char_t>(str_a), index_a, std::basic_string_view<char_t>(str_b), index_b, length, comparison_type);}
     /// @endcond
     
-    /// @brief Concatenates four specified instances of string.
-    /// @param str_a The first string to concatenate.
-    /// @param str_b The second string to concatenate.
-    /// @param str_c The third string to concatenate.
-    /// @param str_d The fourth string to concatenate.
-    /// @return The concatenation of str_a, str_b, str_c and str_d.
+    /// @cond
     template<typename char_t>
-    static std::basic_string<char_t> concat(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b, const std::basic_string<char_t>& str_c, const std::basic_string<char_t>& str_d) noexcept {
-      std::basic_stringstream<char_t> ss;
-      ss << str_a;
-      ss << str_b;
-      ss << str_c;
-      ss << str_d;
-      return ss.str();
-    }
-    
-    /// @brief Concatenates four specified instances of object.
-    /// @param obj_a The first object to concatenate.
-    /// @param obj_b The second object to concatenate.
-    /// @param obj_c The third object to concatenate.
-    /// @param obj_d The fourth object to concatenate.
-    /// @return The concatenation of obj_a, obj_b, obj_c and obj_d.
-    template<typename char_t, typename ObjectA, typename ObjectB, typename ObjectC, typename ObjectD>
-    static std::basic_string<char_t> concat(ObjectA obj_a, ObjectB obj_b, ObjectC obj_c, ObjectD obj_d) noexcept {
-      std::basic_stringstream<char_t> ss;
-      ss << obj_a;
-      ss << obj_b;
-      ss << obj_c;
-      ss << obj_d;
-      return ss.str();
-    }
-    
-    /// @brief Concatenates four specified instances of object.
-    /// @param obj_a The first object to concatenate.
-    /// @param obj_b The second object to concatenate.
-    /// @param obj_c The third object to concatenate.
-    /// @param obj_d The fourth object to concatenate.
-    /// @return The concatenation of obj_a, obj_b, obj_c and obj_d.
-    template<typename ObjectA, typename ObjectB, typename ObjectC, typename ObjectD>
-    static std::string concat(ObjectA obj_a, ObjectB obj_b, ObjectC obj_c, ObjectD obj_d) noexcept {
-      std::stringstream ss;
-      ss << obj_a;
-      ss << obj_b;
-      ss << obj_c;
-      ss << obj_d;
-      return ss.str();
-    }
-    
-    /// @brief Concatenates three specified instances of string.
-    /// @param str_a The first string to concatenate.
-    /// @param str_b The second string to concatenate.
-    /// @param str_c The third string to concatenate.
-    /// @return String The concatenation of str_a, str_b and str_c.
-    template<typename char_t>
-    static std::basic_string<char_t> concat(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b, const std::basic_string<char_t>& str_c) noexcept {
-      std::basic_stringstream<char_t> ss;
-      ss << str_a;
-      ss << str_b;
-      ss << str_c;
-      return ss.str();
-    }
-    
-    /// @brief Concatenates three specified instances of object.
-    /// @param obj_a The first object to concatenate.
-    /// @param obj_b The second object to concatenate.
-    /// @param obj_c The third object to concatenate.
-    /// @return The concatenation of obj_a, obj_b and obj_c.
-    template<typename char_t, typename ObjectA, typename ObjectB, typename ObjectC>
-    static std::basic_string<char_t> concat(ObjectA obj_a, ObjectB obj_b, ObjectC obj_c) noexcept {
-      std::basic_stringstream<char_t> ss;
-      ss << obj_a;
-      ss << obj_b;
-      ss << obj_c;
-      return ss.str();
-    }
-    
-    /// @brief Concatenates three specified instances of object.
-    /// @param obj_a The first object to concatenate.
-    /// @param obj_b The second object to concatenate.
-    /// @param obj_c The third object to concatenate.
-    /// @return The concatenation of obj_a, obj_b and obj_c.
-    template<typename ObjectA, typename ObjectB, typename ObjectC>
-    static std::string concat(ObjectA obj_a, ObjectB obj_b, ObjectC obj_c) noexcept {
-      std::stringstream ss;
-      ss << obj_a;
-      ss << obj_b;
-      ss << obj_c;
-      return ss.str();
-    }
-    
-    /// @brief Concatenates two specified instances of string.
-    /// @param str_a The first string to concatenate.
-    /// @param str_b The second string to concatenate.
-    /// @return String The concatenation of str_a and str_b.
+    static int compare(std::basic_string_view<char_t> str_a, std::basic_string_view<char_t> str_b) noexcept {return compare(str_a, str_b, false);}
     template<typename char_t>
-    static std::basic_string<char_t> concat(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b) noexcept {
-      std::basic_stringstream<char_t> ss;
-      ss << str_a;
-      ss << str_b;
-      return ss.str();
+    static int compare(std::basic_string_view<char_t> str_a, std::basic_string_view<char_t> str_b, xtd::string_comparison comparison_type) noexcept {
+      if (comparison_type == xtd::string_comparison::ordinal_ignore_case) {
+        size_t index = __mismatch_ignore_case(str_a.data(), str_b.data(), std::min(str_a.size(), str_b.size()));
+        if (index < str_a.size() && index < str_b.size()) return std::char_traits<char_t>::lt(__fold_case_char(str_a[index]), __fold_case_char(str_b[index])) ? -1 : 1;
+        return str_a.size() == str_b.size() ? 0 : (str_a.size() < str_b.size() ? -1 : 1);
+      }
+      return str_a.compare(str_b);
     }
+    template<typename char_t>
+    static int compare(std::basic_string_view<char_t> str_a, std::basic_string_view<char_t> str_b, bool ignore_case) noexcept {return compare(str_a, str_b, ignore_case ? xtd::string_comparison::ordinal_ignore_case : xtd::string_comparison::ordinal);}
+    template<typename char_t>
+    static int compare(std::basic_string_view<char_t> str_a, size_t index_a, std::basic_string_view<char_t> str_b, size_t index_b, size_t length) noexcept {return compare(str_a, index_a, str_b, index_b, length, false);}
+    template<typename char_t>
+    static int compare(std::basic_string_view<char_t> str_a, size_t index_a, std::basic_string_view<char_t> str_b, size_t index_b, size_t length, bool ignore_case) noexcept {return compare(str_a, index_a, str_b, index_b, length, ignore_case ? xtd::string_comparison::ordinal_ignore_case : xtd::string_comparison::ordinal);}
+    template<typename char_t>
+    static int compare(std::basic_string_view<char_t> str_a, size_t index_a, std::basic_string_view<char_t> str_b, size_t index_b, size_t length, xtd::string_comparison comparison_type) noexcept {return compare(str_a.substr(index_a, length), str_b.substr(index_b, length), comparison_type);}
+    /// @endcond
     
-    /// @brief Concatenates two specified instances of object.
-    /// @param obj_a The first object to concatenate.
-    /// @param obj_b The second object to concatenate.
-    /// @return The concatenation of obj_a and obj_b.
-    template<typename char_t, typename ObjectA, typename ObjectB>
-    static std::basic_string<char_t> concat(ObjectA obj_a, ObjectB obj_b) noexcept {
-      std::basic_stringstream<char_t> ss;
-      ss << obj_a;
-      ss << obj_b;
-      return ss.str();
+    /// @brief Concatenates the string representations of the specified objects.
+    /// @param args The objects to concatenate.
+    /// @return The concatenation of the string representations of args.
+    /// @remarks The result is a std::basic_string of the character type specified as first template argument, as in concat<wchar_t>(...); otherwise of the character type of the first string in args; otherwise a std::string.
+    /// @remarks The length of the result is computed first so that it is allocated once: strings and characters are copied, numbers are converted without a stream, as std::basic_ostream does in the classic locale. Other objects are streamed with their stream << operator.
+    template<typename char_t = void, typename ...args_t>
+    static std::basic_string<typename __concat_char<char_t, args_t...>::type> concat(const args_t& ...args) noexcept {
+      using result_char_t = typename __concat_char<char_t, args_t...>::type;
+      std::basic_string<result_char_t> result;
+      result.reserve((size_t(0) + ... + __concat_size_hint<result_char_t>(args)));
+      (__concat_append(result, args), ...);
+      return result;
     }
     
-    /// @brief Concatenates two specified instances of object.
-    /// @param obj_a The first object to concatenate.
-    /// @param obj_b The second object to concatenate.
-    /// @return The concatenation of obj_a and obj_b.
-    template<typename ObjectA, typename ObjectB>
-    static std::string concat(const ObjectA& obj_a, const ObjectB& obj_b) noexcept {
-      std::stringstream ss;
-      ss << obj_a;
-      ss << obj_b;
-      return ss.str();
+    /// @brief Concatenates the string representations of the specified objects into a string that uses the specified allocator.
+    /// @param allocator The allocator of the result, whose value type is the character type of the result.
+    /// @param args The objects to concatenate.
+    /// @return The concatenation of the string representations of args.
+    /// @par Examples
+    /// @code
+    /// std::pmr::monotonic_buffer_resource resource;
+    /// std::pmr::string key = xtd::strings::concat(std::allocator_arg, std::pmr::polymorphic_allocator<char>(&resource), "user:", id);
+    /// @endcode
+    template<typename allocator_t, typename ...args_t>
+    static std::basic_string<typename allocator_t::value_type, std::char_traits<typename allocator_t::value_type>, allocator_t> concat(std::allocator_arg_t, const allocator_t& allocator, const args_t& ...args) {
+      using result_char_t = typename allocator_t::value_type;
+      std::basic_string<result_char_t, std::char_traits<result_char_t>, allocator_t> result(allocator);
+      result.reserve((size_t(0) + ... + __concat_size_hint<result_char_t>(args)));
+      (__concat_append(result, args), ...);
+      return result;
     }
     
     /// @brief Concatenates the elements of a specified string array.
     /// @param values An array of string instances.
     /// @return The concatenated elements of values.
     template<typename char_t>
-    static std::basic_string<char_t> concat(const std::vector<std::basic_string<char_t>>& values) noexcept {
-      std::basic_stringstream<char_t> ss;
-      for (const auto& item : values)
-        ss << item;
-      return ss.str();
-    }
+    static std::basic_string<char_t> concat(const std::vector<std::basic_string<char_t>>& values) noexcept {return concat_range<char_t>(values);}
     
     /// @cond
     template<typename char_t>
-    static std::basic_string<char_t> concat(const std::vector<const char_t*>& values) noexcept {
-      std::basic_stringstream<char_t> ss;
-      for (const auto& item : values)
-        ss << item;
-      return ss.str();
-    }
+    static std::basic_string<char_t> concat(const std::vector<const char_t*>& values) noexcept {return concat_range<char_t>(values);}
     
     template<typename char_t>
-    static std::basic_string<char_t> concat(const std::initializer_list<std::basic_string<char_t>>& values) noexcept {
-      std::basic_stringstream<char_t> ss;
-      for (const auto& item : values)
-        ss << item;
-      return ss.str();
-    }
+    static std::basic_string<char_t> concat(const std::initializer_list<std::basic_string<char_t>>& values) noexcept {return concat_range<char_t>(values);}
     
     template<typename char_t>
-    static std::basic_string<char_t> concat(const std::initializer_list<const char_t*>& values) noexcept {
-      std::basic_stringstream<char_t> ss;
-      for (const auto& item : values)
-        ss << item;
-      return ss.str();
-    }
+    static std::basic_string<char_t> concat(const std::initializer_list<const char_t*>& values) noexcept {return concat_range<char_t>(values);}
     /// @endcond
     
     /// @brief Concatenates the string representations of the elements in a specified Object array.
     /// @param args An object array that contains the elements to concatenate.
     /// @return The concatenated string representations of the values of the elements in args.
     template<typename char_t, typename Object>
-    static std::basic_string<char_t> concat(const std::vector<Object>& args) noexcept {
-      std::basic_stringstream<char_t> ss;
-      for (const auto& item : args)
-        ss << item;
-      return ss.str();
-    }
+    static std::basic_string<char_t> concat(const std::vector<Object>& args) noexcept {return concat_range<char_t>(args);}
     
     /// @cond
     template<typename char_t, typename Object>
-    static std::basic_string<char_t> concat(const std::initializer_list<Object>& args) noexcept {
-      std::basic_stringstream<char_t> ss;
-      for (const auto& item : args)
-        ss << item;
-      return ss.str();
-    }
+    static std::basic_string<char_t> concat(const std::initializer_list<Object>& args) noexcept {return concat_range<char_t>(args);}
     /// @endcond
     
     /// @brief Concatenates the string representations of the elements in a specified Object array.
     /// @param args An object array that contains the elements to concatenate.
     /// @return The concatenated string representations of the values of the elements in args.
     template<typename Object>
-    static std::string concat(const std::vector<Object>& args) noexcept {
-      std::stringstream ss;
-      for (const auto& item : args)
-        ss << item;
-      return ss.str();
-    }
+    static std::string concat(const std::vector<Object>& args) noexcept {return concat_range<char>(args);}
     
     /// @cond
     template<typename Object>
-    static std::string concat(const std::initializer_list<Object>& args) noexcept {
-      std::stringstream ss;
-      for (const auto& item : args)
-        ss << item;
-      return ss.str();
-    }
+    static std::string concat(const std::initializer_list<Object>& args) noexcept {return concat_range<char>(args);}
     /// @endcond
     
-    /// @brief Creates the string representation of a specified object.
-    /// @param obj_a The object to represent.
-    /// @return The string representation of the value of arg0.
-    template<typename char_t, typename Value>
-    static std::basic_string<char_t> concat(Value value) noexcept {
-      std::basic_stringstream<char_t> ss;
-      ss << value;
-      return ss.str();
-    }
+    /// @brief Returns a value indicating whether a specified substring occurs within the specified string.
+    /// @param str The string to check.
+    /// @param value The string to seek.
+    /// @return true if the value parameter occurs within this string, or if value is the empty string (""); otherwise, false.
+    template<typename char_t>
+    static bool contains(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value) noexcept {return contains(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value));}
     
-    /// @brief Creates the string representation of a specified object.
-    /// @param obj_a The object to represent.
-    /// @return The string representation of the value of arg0.
-    template<typename Value>
-    static std::string concat(Value value) noexcept {
-      std::stringstream ss;
-      ss << value;
-      return ss.str();
-    }
+    /// @cond
+    template<typename char_t>
+    static bool contains(const std::basic_string<char_t>& str, const char_t* value) noexcept {return contains(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value));}
+    template<typename char_t>
+    static bool contains(const char_t* str, const std::basic_string<char_t>& value) noexcept {return contains(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value));}
+    template<typename char_t>
+    static bool contains(const char_t* str, const char_t* value) noexcept {return contains(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value));}
+    /// @endcond
+    
+    /// @cond
+    template<typename char_t>
+    static bool contains(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value) noexcept {return str.find(value) != str.npos;}
+    /// @endcond
     
     /// @brief Returns a value indicating whether a specified substring occurs within the specified string.
     /// @param str The string to check.
-    /// @param value The string to seek.
+    /// @param value The preprocessed substring to seek.
     /// @return true if the value parameter occurs within this string, or if value is the empty string (""); otherwise, false.
     template<typename char_t>
-    static bool contains(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value) noexcept {
-      return str.find(value) != str.npos;
-    }
+    static bool contains(const std::basic_string<char_t>& str, const xtd::searcher<char_t>& value) noexcept {return value.find(str) != xtd::searcher<char_t>::npos;}
     
     /// @cond
     template<typename char_t>
-    static bool contains(const std::basic_string<char_t>& str, const char_t* value) noexcept {return contains(str, std::basic_string<char_t>(value));}
+    static bool contains(const char_t* str, const xtd::searcher<char_t>& value) noexcept {return value.find(str) != xtd::searcher<char_t>::npos;}
+    template<typename char_t>
+    static bool contains(std::basic_string_view<char_t> str, const xtd::searcher<char_t>& value) noexcept {return value.find(str) != xtd::searcher<char_t>::npos;}
+    /// @endcond
+    
+    /// @brief Returns a value indicating whether any of the specified substrings occurs within the specified string.
+    /// @param str The string to check.
+    /// @param values The compiled substrings to seek.
+    /// @return true if at least one of the substrings occurs within this string; otherwise, false.
+    /// @remarks The string is read once, whatever the number of substrings.
+    template<typename char_t>
+    static bool contains_any(const std::basic_string<char_t>& str, const xtd::pattern_set<char_t>& values) noexcept {return values.contains_any(str);}
+    
+    /// @cond
     template<typename char_t>
-    static bool contains(const char_t* str, const std::basic_string<char_t>& value) noexcept {return contains(std::basic_string<char_t>(str), value);}
+    static bool contains_any(const char_t* str, const xtd::pattern_set<char_t>& values) noexcept {return values.contains_any(str);}
     template<typename char_t>
-    static bool contains(const char_t* str, const char_t* value) noexcept {return contains(std::basic_string<char_t>(str), std::basic_string<char_t>(value));}
+    static bool contains_any(std::basic_string_view<char_t> str, const xtd::pattern_set<char_t>& values) noexcept {return values.contains_any(str);}
     /// @endcond
     
     template<typename char_t>
@@ -543,11 +487,11 @@ namespace xtd {
     /// @param value The char_t to compare to the substring at the end of this instance.
     /// @return true if value matches the end of this instance; otherwise, false.
     template<typename char_t>
-    static bool ends_with(const std::basic_string<char_t>& str, char_t value) noexcept {return str.rfind(value) == str.size() - 1;}
+    static bool ends_with(const std::basic_string<char_t>& str, char_t value) noexcept {return ends_with(std::basic_string_view<char_t>(str), value);}
     
     /// @cond
     template<typename char_t>
-    static bool ends_with(const char_t* str, char_t value) noexcept {return ends_with(std::basic_string<char_t>(str), value);}
+    static bool ends_with(const char_t* str, char_t value) noexcept {return ends_with(std::basic_string_view<char_t>(str), value);}
     /// @endcond
     
     /// @brief Determines whether the end of the specified string matches the specified string.
@@ -555,47 +499,163 @@ namespace xtd {
     /// @param value The string to compare to the substring at the end of this instance.
     /// @return true if value matches the end of this instance; otherwise, false.
     template<typename char_t>
-    static bool ends_with(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value) noexcept {return ends_with(str, value, false);}
+    static bool ends_with(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), false);}
     
     /// @brief Determines whether the end of this string instance matches the specified string when compared using the specified culture.
     /// @param str The string to match.
     /// @param ignore_case true to ignore case during the comparison; otherwise, false.
     /// @return bool true if value matches the end of the specified string; otherwise, false.
     template<typename char_t>
-    static bool ends_with(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, bool ignore_case) noexcept {return ends_with(str, value, ignore_case ? xtd::string_comparison::ordinal_ignore_case : xtd::string_comparison::ordinal);}
+    static bool ends_with(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, bool ignore_case) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), ignore_case ? xtd::string_comparison::ordinal_ignore_case : xtd::string_comparison::ordinal);}
     
     /// @brief Determines whether the end of the specified string matches the specified string when compared using the specified comparison option.
     /// @param str The string to match.
     /// @param comparison_type One of the enumeration values that determines how this string and value are compared.
     /// @return bool true if value matches the end of the specified string; otherwise, false.
     template<typename char_t>
-    static bool ends_with(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, xtd::string_comparison comparison_type) noexcept {
-      if (comparison_type == xtd::string_comparison::ordinal_ignore_case)
-        return to_lower(str).rfind(to_lower(value)) + to_lower(value).size() == str.size();
-      return str.rfind(value) + value.size() == str.size();
+    static bool ends_with(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, xtd::string_comparison comparison_type) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), comparison_type);}
+    
+    /// @cond
+    template<typename char_t>
+    static bool ends_with(const std::basic_string<char_t>& str, const char_t* value) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), false);}
+    template<typename char_t>
+    static bool ends_with(const char_t* str, const std::basic_string<char_t>& value) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), false);}
+    template<typename char_t>
+    static bool ends_with(const char_t* str, const char_t* value) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), false);}
+    
+    template<typename char_t>
+    static bool ends_with(const std::basic_string<char_t>& str, const char_t* value, bool ignore_case) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), ignore_case);}
+    template<typename char_t>
+    static bool ends_with(const char_t* str, const std::basic_string<char_t>& value, bool ignore_case) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), ignore_case);}
+    template<typename char_t>
+    static bool ends_with(const char_t* str, const char_t* value, bool ignore_case) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), ignore_case);}
+    
+    template<typename char_t>
+    static bool ends_with(const std::basic_string<char_t>& str, const char_t* value, xtd::string_comparison comparison_type) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), comparison_type);}
+    template<typename char_t>
+    static bool ends_with(const char_t* str, const std::basic_string<char_t>& value, xtd::string_comparison comparison_type) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), comparison_type);}
+    template<typename char_t>
+    static bool ends_with(const char_t* str, const char_t* value, xtd::string_comparison comparison_type) noexcept {return ends_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), comparison_type);}
+    /// @endcond
+    
+    /// @cond
+    template<typename char_t>
+    static bool ends_with(std::basic_string_view<char_t> str, char_t value) noexcept {return !str.empty() && str.back() == value;}
+    template<typename char_t>
+    static bool ends_with(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value) noexcept {return ends_with(str, value, false);}
+    template<typename char_t>
+    static bool ends_with(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value, xtd::string_comparison comparison_type) noexcept {
+      if (value.size() > str.size()) return false;
+      return equals(str.substr(str.size() - value.size()), value, comparison_type);
+    }
+    template<typename char_t>
+    static bool ends_with(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value, bool ignore_case) noexcept {return ends_with(str, value, ignore_case ? xtd::string_comparison::ordinal_ignore_case : xtd::string_comparison::ordinal);}
+    /// @endcond
+    
+    /// @brief Determines whether the end of the specified string matches any of the specified suffixes.
+    /// @param str The string to match.
+    /// @param values The suffixes to compare to the end of str.
+    /// @return true if at least one of values matches the end of str; otherwise, false.
+    /// @remarks Each suffix is compared with a bounded comparison; for hundreds of suffixes use the xtd::suffix_trie overload.
+    template<typename char_t>
+    static bool ends_with_any(const std::basic_string<char_t>& str, const std::vector<std::basic_string<char_t>>& values) noexcept {return ends_with_any(std::basic_string_view<char_t>(str), values, false);}
+    
+    /// @brief Determines whether the end of the specified string matches any of the specified suffixes, ignoring or honoring their case.
+    /// @param str The string to match.
+    /// @param values The suffixes to compare to the end of str.
+    /// @param ignore_case true to ignore case during the comparison; otherwise, false.
+    /// @return true if at least one of values matches the end of str; otherwise, false.
+    template<typename char_t>
+    static bool ends_with_any(const std::basic_string<char_t>& str, const std::vector<std::basic_string<char_t>>& values, bool ignore_case) noexcept {return ends_with_any(std::basic_string_view<char_t>(str), values, ignore_case);}
+    
+    /// @brief Determines whether the end of the specified string matches any of the suffixes of the specified xtd::suffix_trie.
+    /// @param str The string to match.
+    /// @param values The precompiled suffixes to compare to the end of str.
+    /// @return true if at least one of values matches the end of str; otherwise, false.
+    /// @remarks The string is read once, in a time that does not depend on the number of suffixes.
+    template<typename char_t>
+    static bool ends_with_any(const std::basic_string<char_t>& str, const xtd::suffix_trie<char_t>& values) noexcept {return values.matches(str);}
+    
+    /// @cond
+    template<typename char_t>
+    static bool ends_with_any(const char_t* str, const std::vector<std::basic_string<char_t>>& values) noexcept {return ends_with_any(std::basic_string_view<char_t>(str), values, false);}
+    template<typename char_t>
+    static bool ends_with_any(const char_t* str, const std::vector<std::basic_string<char_t>>& values, bool ignore_case) noexcept {return ends_with_any(std::basic_string_view<char_t>(str), values, ignore_case);}
+    template<typename char_t>
+    static bool ends_with_any(const char_t* str, const xtd::suffix_trie<char_t>& values) noexcept {return values.matches(str);}
+    /// @endcond
+    
+    /// @cond
+    template<typename char_t>
+    static bool ends_with_any(std::basic_string_view<char_t> str, const std::vector<std::basic_string<char_t>>& values) noexcept {return ends_with_any(str, values, false);}
+    template<typename char_t>
+    static bool ends_with_any(std::basic_string_view<char_t> str, const std::vector<std::basic_string<char_t>>& values, bool ignore_case) noexcept {
+      for (const auto& value : values)
+        if (ends_with(str, std::basic_string_view<char_t>(value), ignore_case)) return true;
+      return false;
     }
+    template<typename char_t>
+    static bool ends_with_any(std::basic_string_view<char_t> str, const xtd::suffix_trie<char_t>& values) noexcept {return values.matches(str);}
+    /// @endcond
+    
+    /// @brief Determines whether two specified strings have the same value.
+    /// @param str_a The first string to compare.
+    /// @param str_b The second string to compare.
+    /// @return true if the value of str_a is the same as the value of str_b; otherwise, false.
+    template<typename char_t>
+    static bool equals(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), false);}
+    
+    /// @brief Determines whether two specified strings have the same value, ignoring or honoring their case.
+    /// @param str_a The first string to compare.
+    /// @param str_b The second string to compare.
+    /// @param ignore_case true to ignore case during the comparison; otherwise, false.
+    /// @return true if the value of str_a is the same as the value of str_b; otherwise, false.
+    template<typename char_t>
+    static bool equals(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b, bool ignore_case) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), ignore_case);}
+    
+    /// @brief Determines whether two specified strings have the same value. A parameter specifies the comparison rules used in the comparison.
+    /// @param str_a The first string to compare.
+    /// @param str_b The second string to compare.
+    /// @param comparison_type One of the enumeration values that specifies the rules for the comparison.
+    /// @return true if the value of str_a is the same as the value of str_b; otherwise, false.
+    /// @remarks Unlike compare, strings of different lengths are rejected before any character is read, and no lowered copy is made when case is ignored.
+    template<typename char_t>
+    static bool equals(const std::basic_string<char_t>& str_a, const std::basic_string<char_t>& str_b, xtd::string_comparison comparison_type) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), comparison_type);}
     
     /// @cond
     template<typename char_t>
-    static bool ends_with(const std::basic_string<char_t>& str, const char_t* value) noexcept {return ends_with(str, std::basic_string<char_t>(value), false);}
+    static bool equals(const std::basic_string<char_t>& str_a, const char_t* str_b) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), false);}
+    template<typename char_t>
+    static bool equals(const char_t* str_a, const std::basic_string<char_t>& str_b) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), false);}
     template<typename char_t>
-    static bool ends_with(const char_t* str, const std::basic_string<char_t>& value) noexcept {return ends_with(std::basic_string<char_t>(str), value, false);}
+    static bool equals(const char_t* str_a, const char_t* str_b) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), false);}
+    
+    template<typename char_t>
+    static bool equals(const std::basic_string<char_t>& str_a, const char_t* str_b, bool ignore_case) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), ignore_case);}
     template<typename char_t>
-    static bool ends_with(const char_t* str, const char_t* value) noexcept {return ends_with(std::basic_string<char_t>(str), std::basic_string<char_t>(value), false);}
+    static bool equals(const char_t* str_a, const std::basic_string<char_t>& str_b, bool ignore_case) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), ignore_case);}
+    template<typename char_t>
+    static bool equals(const char_t* str_a, const char_t* str_b, bool ignore_case) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), ignore_case);}
     
     template<typename char_t>
-    static bool ends_with(const std::basic_string<char_t>& str, const char_t* value, bool ignore_case) noexcept {return ends_with(str, std::basic_string<char_t>(value), ignore_case);}
+    static bool equals(const std::basic_string<char_t>& str_a, const char_t* str_b, xtd::string_comparison comparison_type) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), comparison_type);}
     template<typename char_t>
-    static bool ends_with(const char_t* str, const std::basic_string<char_t>& value, bool ignore_case) noexcept {return ends_with(std::basic_string<char_t>(str), value, ignore_case);}
+    static bool equals(const char_t* str_a, const std::basic_string<char_t>& str_b, xtd::string_comparison comparison_type) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), comparison_type);}
     template<typename char_t>
-    static bool ends_with(const char_t* str, const char_t* value, bool ignore_case) noexcept {return ends_with(std::basic_string<char_t>(str), std::basic_string<char_t>(value), ignore_case);}
+    static bool equals(const char_t* str_a, const char_t* str_b, xtd::string_comparison comparison_type) noexcept {return equals(std::basic_string_view<char_t>(str_a), std::basic_string_view<char_t>(str_b), comparison_type);}
+    /// @endcond
     
+    /// @cond
     template<typename char_t>
-    static bool ends_with(const std::basic_string<char_t>& str, const char_t* value, xtd::string_comparison comparison_type) noexcept {return ends_with(str, std::basic_string<char_t>(value), comparison_type);}
+    static bool equals(std::basic_string_view<char_t> str_a, std::basic_string_view<char_t> str_b) noexcept {return equals(str_a, str_b, false);}
     template<typename char_t>
-    static bool ends_with(const char_t* str, const std::basic_string<char_t>& value, xtd::string_comparison comparison_type) noexcept {return ends_with(std::basic_string<char_t>(str), value, comparison_type);}
+    static bool equals(std::basic_string_view<char_t> str_a, std::basic_string_view<char_t> str_b, xtd::string_comparison comparison_type) noexcept {
+      if (str_a.size() != str_b.size()) return false;
+      if (comparison_type == xtd::string_comparison::ordinal_ignore_case) return __mismatch_ignore_case(str_a.data(), str_b.data(), str_a.size()) == str_a.size();
+      return std::char_traits<char_t>::compare(str_a.data(), str_b.data(), str_a.size()) == 0;
+    }
     template<typename char_t>
-    static bool ends_with(const char_t* str, const char_t* value, xtd::string_comparison comparison_type) noexcept {return ends_with(std::basic_string<char_t>(str), std::basic_string<char_t>(value), comparison_type);}
+    static bool equals(std::basic_string_view<char_t> str_a, std::basic_string_view<char_t> str_b, bool ignore_case) noexcept {return equals(str_a, str_b, ignore_case ? xtd::string_comparison::ordinal_ignore_case : xtd::string_comparison::ordinal);}
     /// @endcond
     
     /// @brief Writes the text representation of the specified arguments list, to string using the specified format information.
@@ -603,14 +663,15 @@ namespace xtd {
     /// @param args anarguments list to write using format.
     /// @return string formated.
     /// @remarks for more information about format see @ref FormatPage "Format".
-    template<typename char_t, typename ...args_t>
-    static std::basic_string<char_t> format(const std::basic_string<char_t>& fmt, args_t&&... args) {
-      std::basic_string<char_t> result;
+    /// @remarks The result uses the allocator of fmt.
+    template<typename char_t, typename allocator_t, typename ...args_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> format(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& fmt, args_t&&... args) {
+      std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(fmt.get_allocator());
       size_t index = 0;
       std::vector<__format_information<char_t>> formats;
-      typename std::basic_string<char_t>::const_iterator begin_format_iterator =  fmt.cend();
-      typename std::basic_string<char_t>::const_iterator end_format_iterator =  fmt.cend();
-      for (typename std::basic_string<char_t>::const_iterator iterator = fmt.cbegin(); iterator != fmt.cend(); ++iterator) {
+      typename std::basic_string<char_t, std::char_traits<char_t>, allocator_t>::const_iterator begin_format_iterator =  fmt.cend();
+      typename std::basic_string<char_t, std::char_traits<char_t>, allocator_t>::const_iterator end_format_iterator =  fmt.cend();
+      for (typename std::basic_string<char_t, std::char_traits<char_t>, allocator_t>::const_iterator iterator = fmt.cbegin(); iterator != fmt.cend(); ++iterator) {
         if (*iterator == char_t('{')) {
           ++iterator;
           if (*iterator == char_t('{'))
@@ -679,6 +740,84 @@ namespace xtd {
     static std::basic_string<char_t> format(const char_t* fmt, args_t&&... args) {return format(std::basic_string<char_t>(fmt), std::forward<args_t>(args)...);}
     /// @endcond
     
+    /// @brief Writes the text representation of the specified arguments list, to a string that uses the specified allocator, using the specified format information.
+    /// @param allocator The allocator of the result.
+    /// @param fmt A composite format string.
+    /// @param args anarguments list to write using format.
+    /// @return string formated.
+    /// @remarks for more information about format see @ref FormatPage "Format".
+    template<typename char_t, typename allocator_t, typename ...args_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> format(std::allocator_arg_t, const allocator_t& allocator, const char_t* fmt, args_t&&... args) {return format(std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(fmt, allocator), std::forward<args_t>(args)...);}
+    
+    /// @brief Appends the text representation of the specified arguments list to a fixed string, using the specified format information.
+    /// @param result The fixed string to append to.
+    /// @param fmt A composite format string.
+    /// @param args anarguments list to write using format.
+    /// @return true.
+    /// @exception std::length_error The text does not fit in the remaining capacity of result; result is left unchanged.
+    /// @remarks The text is the same as the one returned by format. Strings, characters and small integers are written directly into result; other arguments are converted to a temporary string first.
+    /// @remarks for more information about format see @ref FormatPage "Format".
+    /// @par Examples
+    /// @code
+    /// xtd::fixed_string<char, 64> line;
+    /// xtd::strings::format_to(line, "{0}={1,6}", key, value);
+    /// @endcode
+    template<typename char_t, size_t capacity, typename ...args_t>
+    static bool format_to(xtd::fixed_string<char_t, capacity>& result, typename xtd::fixed_string<char_t, capacity>::view_type fmt, args_t&&... args) {return format_to(result, xtd::fixed_string_overflow::error, fmt, std::forward<args_t>(args)...);}
+    
+    /// @brief Appends the text representation of the specified arguments list to a fixed string, using the specified format information; what happens when the text does not fit is specified by overflow.
+    /// @param result The fixed string to append to.
+    /// @param overflow What happens when the text does not fit in the remaining capacity of result.
+    /// @param fmt A composite format string.
+    /// @param args anarguments list to write using format.
+    /// @return true if the whole text is appended; false if it is truncated.
+    /// @exception std::length_error The text does not fit in the remaining capacity of result and overflow is xtd::fixed_string_overflow::error; result is left unchanged.
+    /// @remarks The text is the same as the one returned by format. Strings, characters and small integers are written directly into result; other arguments are converted to a temporary string first.
+    /// @remarks for more information about format see @ref FormatPage "Format".
+    template<typename char_t, size_t capacity, typename ...args_t>
+    static bool format_to(xtd::fixed_string<char_t, capacity>& result, xtd::fixed_string_overflow overflow, typename xtd::fixed_string<char_t, capacity>::view_type fmt, args_t&&... args) {
+      static constexpr char_t brackets[] {char_t('{'), char_t('}')};
+      size_t length = result.size();
+      bool complete = true;
+      try {
+        size_t index = 0;
+        for (size_t position = 0; position < fmt.size();) {
+          size_t bracket = std::min(fmt.find_first_of(std::basic_string_view<char_t>(brackets, 2), position), fmt.size());
+          if (!result.append(fmt.substr(position, bracket - position), overflow)) complete = false;
+          if (bracket == fmt.size()) break;
+          if (bracket + 1 < fmt.size() && fmt[bracket + 1] == fmt[bracket]) {
+            if (!result.append(1, fmt[bracket], overflow)) complete = false;
+            position = bracket + 2;
+            continue;
+          }
+          if (fmt[bracket] == char_t('}')) throw std::invalid_argument("Invalid format expression : closing bracket '{' without open bracket '}'");
+          size_t end = fmt.find(char_t('}'), bracket);
+          if (end == fmt.npos) throw std::invalid_argument("Invalid format expression : open bracket '}' without end bracket '{'");
+          std::basic_string_view<char_t> item = fmt.substr(bracket + 1, end - bracket - 1);
+          size_t alignment_separator = item.find(char_t(','));
+          size_t format_separator = item.find(char_t(':'));
+          if (alignment_separator != item.npos && format_separator != item.npos && alignment_separator > format_separator) alignment_separator = item.npos;
+          int alignment = alignment_separator == item.npos ? 0 : __parse_format_alignment(item.substr(alignment_separator + 1, format_separator != item.npos ? format_separator - alignment_separator - 1 : item.npos));
+          std::basic_string_view<char_t> format = format_separator == item.npos ? std::basic_string_view<char_t>() : item.substr(format_separator + 1);
+          std::basic_string_view<char_t> index_str = item.substr(0, std::min(alignment_separator, format_separator));
+          size_t arg_index = 0;
+          if (index_str.empty()) arg_index = index++;
+          else for (auto c : index_str) {
+            if (c < char_t('0') || c > char_t('9')) throw std::invalid_argument("Invalid format expression : format argument must be start by ':'");
+            arg_index = arg_index * 10 + static_cast<size_t>(c - char_t('0'));
+          }
+          size_t arg_position = 0;
+          auto write = [&](auto&& arg) {if (arg_position++ == arg_index && !__format_to_arg(result, arg, format, alignment, overflow)) complete = false;};
+          (write(args), ...);
+          position = end + 1;
+        }
+      } catch (...) {
+        result.resize(length);
+        throw;
+      }
+      return complete;
+    }
+    
     /// @brief Writes the text representation of the specified arguments list, to string using the specified format information.
     /// @param fmt A composite format string.
     /// @param args anarguments list to write using format.
@@ -747,12 +886,29 @@ namespace xtd {
     
     /// @brief Returns the hash code for this string.
     /// @return A hash code.
+    /// @remarks The hash code is computed with wyhash. Its seed is 0 unless XTD_STRINGS_RANDOM_HASH_SEED is defined, in which case it is drawn at random once per process: hash codes must then not be persisted.
+    template<typename char_t>
+    static size_t get_hash_code(const std::basic_string<char_t>& str) noexcept {return get_hash_code(std::basic_string_view<char_t>(str));}
+    
+    /// @brief Returns the hash code for this string with the specified rules.
+    /// @param comparison_type One of the enumeration values that specifies the rules for the hash.
+    /// @return A hash code; strings that are equal for comparison_type have the same hash code.
+    /// @remarks When case is ignored, the characters are folded as they are hashed; the string is not copied.
+    template<typename char_t>
+    static size_t get_hash_code(const std::basic_string<char_t>& str, xtd::string_comparison comparison_type) noexcept {return get_hash_code(std::basic_string_view<char_t>(str), comparison_type);}
+    
+    /// @cond
+    template<typename char_t>
+    static size_t get_hash_code(const char_t* str) noexcept {return get_hash_code(std::basic_string_view<char_t>(str));}
     template<typename char_t>
-    static size_t get_hash_code(const std::basic_string<char_t>& str) noexcept {return std::hash<std::basic_string<char_t>>()(str);}
+    static size_t get_hash_code(const char_t* str, xtd::string_comparison comparison_type) noexcept {return get_hash_code(std::basic_string_view<char_t>(str), comparison_type);}
+    /// @endcond
     
     /// @cond
     template<typename char_t>
-    static size_t get_hash_code(const char_t* str) noexcept {return std::hash<std::basic_string<char_t>>{}(std::basic_string<char_t>(str));}
+    static size_t get_hash_code(std::basic_string_view<char_t> str) noexcept {return __hash_string(str, false, __hash_seed());}
+    template<typename char_t>
+    static size_t get_hash_code(std::basic_string_view<char_t> str, xtd::string_comparison comparison_type) noexcept {return __hash_string(str, comparison_type == xtd::string_comparison::ordinal_ignore_case, __hash_seed());}
     /// @endcond
     
     /// @brief Reports the index of the first occurrence of the specified character in the sêcified tring.
@@ -760,24 +916,24 @@ namespace xtd {
     /// @param value A Unicode character to seek
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t index_of(const std::basic_string<char_t>& str, char_t value) noexcept {return index_of(str, value, 0, str.size());}
+    static size_t index_of(const std::basic_string<char_t>& str, char_t value) noexcept {return index_of(std::basic_string_view<char_t>(str), value, 0, str.size());}
     
     /// @brief Reports the index of the first occurrence of the specified string in the specified string.
     /// @param str A String to find index of.
     /// @param value A Unicode character to seek
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value) noexcept {return index_of(str, value, 0, str.size());}
+    static size_t index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), 0, str.size());}
     
     /// @cond
     template<typename char_t>
-    static size_t index_of(const char_t* str, char_t value) noexcept {return index_of(std::basic_string<char_t>(str), value);}
+    static size_t index_of(const char_t* str, char_t value) noexcept {return index_of(std::basic_string_view<char_t>(str), value);}
     template<typename char_t>
-    static size_t index_of(const std::basic_string<char_t>& str, const char_t* value) noexcept {return index_of(str, std::basic_string<char_t>(value));}
+    static size_t index_of(const std::basic_string<char_t>& str, const char_t* value) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value));}
     template<typename char_t>
-    static size_t index_of(const char_t* str, const std::basic_string<char_t>& value) noexcept {return index_of(std::basic_string<char_t>(str), value);}
+    static size_t index_of(const char_t* str, const std::basic_string<char_t>& value) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value));}
     template<typename char_t>
-    static size_t index_of(const char_t* str, const char_t* value) noexcept {return index_of(std::basic_string<char_t>(str), std::basic_string<char_t>(value));}
+    static size_t index_of(const char_t* str, const char_t* value) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value));}
     /// @endcond
     
     /// @brief Reports the index of the first occurrence of the specified character in the spexified string. The search starts at a specified character position.
@@ -786,7 +942,7 @@ namespace xtd {
     /// @param start_index The search starting position
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t index_of(const std::basic_string<char_t>& str, char_t value, size_t start_index) noexcept {return index_of(str, value, start_index, str.size() - start_index);}
+    static size_t index_of(const std::basic_string<char_t>& str, char_t value, size_t start_index) noexcept {return index_of(std::basic_string_view<char_t>(str), value, start_index, str.size() - start_index);}
     
     /// @brief Reports the index of the first occurrence of the specified character in the spexified string. The search starts at a specified character position.
     /// @param str A String to find index of.
@@ -794,17 +950,17 @@ namespace xtd {
     /// @param start_index The search starting position
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, size_t start_index) noexcept {return index_of(str, value, start_index, str.size() - start_index);}
+    static size_t index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, size_t start_index) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index, str.size() - start_index);}
     
     /// @cond
     template<typename char_t>
-    static size_t index_of(const char_t* str, char_t value, size_t start_index) noexcept {return index_of(std::basic_string<char_t>(str), value, start_index);}
+    static size_t index_of(const char_t* str, char_t value, size_t start_index) noexcept {return index_of(std::basic_string_view<char_t>(str), value, start_index);}
     template<typename char_t>
-    static size_t index_of(const std::basic_string<char_t>& str, const char_t* value, size_t start_index) noexcept {return index_of(str, std::basic_string<char_t>(value), start_index);}
+    static size_t index_of(const std::basic_string<char_t>& str, const char_t* value, size_t start_index) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index);}
     template<typename char_t>
-    static size_t index_of(const char_t* str, const std::basic_string<char_t>& value, size_t start_index) noexcept {return index_of(std::basic_string<char_t>(str), value, start_index);}
+    static size_t index_of(const char_t* str, const std::basic_string<char_t>& value, size_t start_index) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index);}
     template<typename char_t>
-    static size_t index_of(const char_t* str, const char_t* value, size_t start_index) noexcept {return index_of(std::basic_string<char_t>(str), std::basic_string<char_t>(value), start_index);}
+    static size_t index_of(const char_t* str, const char_t* value, size_t start_index) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index);}
     /// @endcond
     
     /// @brief Reports the index of the first occurrence of the specified character in the spexified string. The search starts at a specified character position and examines a specified number of character positions.
@@ -814,10 +970,7 @@ namespace xtd {
     /// @param count The number of character positions to examine
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t index_of(const std::basic_string<char_t>& str, char_t value, size_t start_index, size_t count) noexcept {
-      size_t result = str.find(value, start_index);
-      return result > start_index + count ? std::basic_string<char_t>::npos : result;
-    }
+    static size_t index_of(const std::basic_string<char_t>& str, char_t value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string_view<char_t>(str), value, start_index, count);}
     
     /// @brief Reports the index of the first occurrence of the specified character in the spexified string. The search starts at a specified character position and examines a specified number of character positions.
     /// @param str A String to find index of.
@@ -826,20 +979,81 @@ namespace xtd {
     /// @param count The number of character positions to examine
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, size_t start_index, size_t count) noexcept {
+    static size_t index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index, count);}
+    
+    /// @cond
+    template<typename char_t>
+    static size_t index_of(const char_t* str, char_t value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string_view<char_t>(str), value, start_index, count);}
+    template<typename char_t>
+    static size_t index_of(const std::basic_string<char_t>& str, const char_t* value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index, count);}
+    template<typename char_t>
+    static size_t index_of(const char_t* str, const std::basic_string<char_t>& value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index, count);}
+    template<typename char_t>
+    static size_t index_of(const char_t* str, const char_t* value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index, count);}
+    /// @endcond
+    
+    /// @cond
+    template<typename char_t>
+    static size_t index_of(std::basic_string_view<char_t> str, char_t value) noexcept {return index_of(str, value, 0, str.size());}
+    template<typename char_t>
+    static size_t index_of(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value) noexcept {return index_of(str, value, 0, str.size());}
+    template<typename char_t>
+    static size_t index_of(std::basic_string_view<char_t> str, char_t value, size_t start_index) noexcept {return index_of(str, value, start_index, str.size() - start_index);}
+    template<typename char_t>
+    static size_t index_of(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value, size_t start_index) noexcept {return index_of(str, value, start_index, str.size() - start_index);}
+    template<typename char_t>
+    static size_t index_of(std::basic_string_view<char_t> str, char_t value, size_t start_index, size_t count) noexcept {
+      size_t result = str.find(value, start_index);
+      return result > start_index + count ? std::basic_string<char_t>::npos : result;
+    }
+    template<typename char_t>
+    static size_t index_of(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value, size_t start_index, size_t count) noexcept {
       size_t result = str.find(value, start_index);
       return result > start_index + count ? std::basic_string<char_t>::npos : result;
     }
+    /// @endcond
+    
+    /// @brief Reports the index of the first occurrence of the specified substring in the specified string.
+    /// @param str A String to find index of.
+    /// @param value The preprocessed substring to seek.
+    /// @return size_t The index position of value if that string is found, or std::basic_string<char_t>::npos if it is not. If value is empty, the return value is 0.
+    template<typename char_t>
+    static size_t index_of(const std::basic_string<char_t>& str, const xtd::searcher<char_t>& value) noexcept {return index_of(std::basic_string_view<char_t>(str), value, 0, str.size());}
+    
+    /// @brief Reports the index of the first occurrence of the specified substring in the specified string. The search starts at a specified character position.
+    /// @param str A String to find index of.
+    /// @param value The preprocessed substring to seek.
+    /// @param start_index The search starting position
+    /// @return size_t The index position of value if that string is found, or std::basic_string<char_t>::npos if it is not. If value is empty, the return value is start_index.
+    template<typename char_t>
+    static size_t index_of(const std::basic_string<char_t>& str, const xtd::searcher<char_t>& value, size_t start_index) noexcept {return index_of(std::basic_string_view<char_t>(str), value, start_index, str.size() - start_index);}
+    
+    /// @brief Reports the index of the first occurrence of the specified substring in the specified string. The search starts at a specified character position and examines a specified number of character positions.
+    /// @param str A String to find index of.
+    /// @param value The preprocessed substring to seek.
+    /// @param start_index The search starting position
+    /// @param count The number of character positions to examine.
+    /// @return size_t The index position of value if that string is found, or std::basic_string<char_t>::npos if it is not. If value is empty, the return value is start_index.
+    template<typename char_t>
+    static size_t index_of(const std::basic_string<char_t>& str, const xtd::searcher<char_t>& value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string_view<char_t>(str), value, start_index, count);}
     
     /// @cond
     template<typename char_t>
-    static size_t index_of(const char_t* str, char_t value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string<char_t>(str), value, start_index, count);}
+    static size_t index_of(const char_t* str, const xtd::searcher<char_t>& value) noexcept {return index_of(std::basic_string_view<char_t>(str), value);}
     template<typename char_t>
-    static size_t index_of(const std::basic_string<char_t>& str, const char_t* value, size_t start_index, size_t count) noexcept {return index_of(str, std::basic_string<char_t>(value), start_index, count);}
+    static size_t index_of(const char_t* str, const xtd::searcher<char_t>& value, size_t start_index) noexcept {return index_of(std::basic_string_view<char_t>(str), value, start_index);}
     template<typename char_t>
-    static size_t index_of(const char_t* str, const std::basic_string<char_t>& value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string<char_t>(str), value, start_index, count);}
+    static size_t index_of(const char_t* str, const xtd::searcher<char_t>& value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string_view<char_t>(str), value, start_index, count);}
+    
+    template<typename char_t>
+    static size_t index_of(std::basic_string_view<char_t> str, const xtd::searcher<char_t>& value) noexcept {return index_of(str, value, 0, str.size());}
     template<typename char_t>
-    static size_t index_of(const char_t* str, const char_t* value, size_t start_index, size_t count) noexcept {return index_of(std::basic_string<char_t>(str), std::basic_string<char_t>(value), start_index, count);}
+    static size_t index_of(std::basic_string_view<char_t> str, const xtd::searcher<char_t>& value, size_t start_index) noexcept {return index_of(str, value, start_index, str.size() - start_index);}
+    template<typename char_t>
+    static size_t index_of(std::basic_string_view<char_t> str, const xtd::searcher<char_t>& value, size_t start_index, size_t count) noexcept {
+      size_t result = value.find(str, start_index);
+      return result > start_index + count ? std::basic_string<char_t>::npos : result;
+    }
     /// @endcond
     
     /// @brief Reports the index of the first occurrence in this instance of any character in a specified array of characters.
@@ -847,7 +1061,7 @@ namespace xtd {
     /// @param values A Unicode character array containing one or more characters to seek
     /// @return size_t The index position of the first occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
     template<typename char_t>
-    static size_t index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values) noexcept {return index_of_any(str, values, 0, str.size());}
+    static size_t index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values, 0, str.size());}
     
     /// @brief Reports the index of the first occurrence in this instance of any character in a specified array of characters. The search starts at a specified character position.
     /// @param str A String to find index of any.
@@ -855,7 +1069,7 @@ namespace xtd {
     /// @param start_index The search starting position
     /// @return size_t The index position of the first occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
     template<typename char_t>
-    static size_t index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values, size_t start_index) noexcept {return index_of_any(str, values, start_index, str.size() - start_index);}
+    static size_t index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values, size_t start_index) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values, start_index, str.size() - start_index);}
     
     /// @brief Reports the index of the first occurrence in this instance of any character in a specified array of characters. The search starts at a specified character position.
     /// @param str A String to find index of any.
@@ -864,81 +1078,152 @@ namespace xtd {
     /// @param count The number of character positions to examine.
     /// @return size_t The index position of the first occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
     template<typename char_t>
-    static size_t index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values, size_t start_index, size_t count) noexcept {
-      size_t index = 0;
-      for (const auto& item : str) {
-        if (index++ < start_index) continue;
-        if (index - 1 > start_index + count) break;
-        if (std::find(values.begin(), values.end(), item) != values.end()) return index - 1;
-      }
-      return std::basic_string<char_t>::npos;
-    }
+    static size_t index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values, size_t start_index, size_t count) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values, start_index, count);}
     
     /// @cond
     template<typename char_t>
-    static size_t index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values) noexcept {return index_of_any(str, std::vector<char_t>(values));}
+    static size_t index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values) noexcept {return index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values));}
     
     template<typename char_t>
-    static size_t index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values, size_t start_index) noexcept {return index_of_any(str, std::vector<char_t>(values), start_index);}
+    static size_t index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values, size_t start_index) noexcept {return index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values), start_index);}
     
     template<typename char_t>
-    static size_t index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values, size_t start_index, size_t count) noexcept {return index_of_any(str, std::vector<char_t>(values), start_index, count);}
+    static size_t index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values, size_t start_index, size_t count) noexcept {return index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values), start_index, count);}
     
     template<typename char_t>
-    static size_t index_of_any(const char_t* str, const std::vector<char_t>& values) noexcept {return index_of_any(std::basic_string<char_t>(str), values);}
+    static size_t index_of_any(const char_t* str, const std::vector<char_t>& values) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values);}
     
     template<typename char_t>
-    static size_t index_of_any(const char_t* str, const std::vector<char_t>& values, size_t start_index) noexcept {return index_of_any(std::basic_string<char_t>(str), values, start_index);}
+    static size_t index_of_any(const char_t* str, const std::vector<char_t>& values, size_t start_index) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values, start_index);}
     
     template<typename char_t>
-    static size_t index_of_any(const char_t* str, const std::vector<char_t>& values, size_t start_index, size_t count) noexcept {return index_of_any(std::basic_string<char_t>(str), std::vector<char_t>(values), start_index, count);}
+    static size_t index_of_any(const char_t* str, const std::vector<char_t>& values, size_t start_index, size_t count) noexcept {return index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values), start_index, count);}
     
     template<typename char_t>
-    static size_t index_of_any(const char_t* str, const std::initializer_list<char_t>& values) noexcept {return index_of_any(std::basic_string<char_t>(str), std::vector<char_t>(values));}
+    static size_t index_of_any(const char_t* str, const std::initializer_list<char_t>& values) noexcept {return index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values));}
     
     template<typename char_t>
-    static size_t index_of_any(const char_t* str, const std::initializer_list<char_t>& values, size_t start_index) noexcept {return index_of_any(std::basic_string<char_t>(str), std::vector<char_t>(values), start_index);}
+    static size_t index_of_any(const char_t* str, const std::initializer_list<char_t>& values, size_t start_index) noexcept {return index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values), start_index);}
     
     template<typename char_t>
-    static size_t index_of_any(const char_t* str, const std::initializer_list<char_t>& values, size_t start_index, size_t count) noexcept {return index_of_any(std::basic_string<char_t>(str), std::vector<char_t>(values), start_index, count);}
+    static size_t index_of_any(const char_t* str, const std::initializer_list<char_t>& values, size_t start_index, size_t count) noexcept {return index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values), start_index, count);}
     /// @endcond
     
-    /// @brief Inserts a specified instance of String at a specified index position in this instance.
-    /// @param start_index The index position of the insertion.
-    /// @param value The String to insert.
-    /// @return String A new String equivalent to this instance but with value inserted at position start_index.
-    /// @remarks If start_index is equal to the length of this instance, value is appended to the end of this instance.
-    /// @remarks For example, the return value of "abc".Insert(2, "XYZ") is "abXYZc".
+    /// @brief Reports the index of the first occurrence in this instance of any character in a specified set of characters.
+    /// @param str A String to find index of any.
+    /// @param values A precompiled set of characters to seek.
+    /// @return size_t The index position of the first occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
+    /// @remarks Use this overload to scan many strings for the same characters: the set is built once.
     template<typename char_t>
-    static std::basic_string<char_t> insert(const std::basic_string<char_t>& str, size_t start_index, const std::basic_string<char_t>& value) noexcept {
-      std::basic_string<char_t> result(str);
-      result.insert(start_index, value);
-      return result;
-    }
+    static size_t index_of_any(const std::basic_string<char_t>& str, const xtd::char_set<char_t>& values) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values, 0, str.size());}
+    
+    /// @brief Reports the index of the first occurrence in this instance of any character in a specified set of characters. The search starts at a specified character position.
+    /// @param str A String to find index of any.
+    /// @param values A precompiled set of characters to seek.
+    /// @param start_index The search starting position
+    /// @return size_t The index position of the first occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
+    template<typename char_t>
+    static size_t index_of_any(const std::basic_string<char_t>& str, const xtd::char_set<char_t>& values, size_t start_index) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values, start_index);}
+    
+    /// @brief Reports the index of the first occurrence in this instance of any character in a specified set of characters. The search starts at a specified character position.
+    /// @param str A String to find index of any.
+    /// @param values A precompiled set of characters to seek.
+    /// @param start_index The search starting position
+    /// @param count The number of character positions to examine.
+    /// @return size_t The index position of the first occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
+    template<typename char_t>
+    static size_t index_of_any(const std::basic_string<char_t>& str, const xtd::char_set<char_t>& values, size_t start_index, size_t count) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values, start_index, count);}
     
     /// @cond
     template<typename char_t>
-    static std::basic_string<char_t> insert(const char_t* str, size_t start_index, const std::basic_string<char_t>& value) noexcept {return insert(std::basic_string<char_t>(str), start_index, value);}
+    static size_t index_of_any(const char_t* str, const xtd::char_set<char_t>& values) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values);}
     template<typename char_t>
-    static std::basic_string<char_t> insert(const std::basic_string<char_t>& str, size_t start_index, char_t* value) noexcept {return insert(str, start_index, std::basic_string<char_t>(value));}
+    static size_t index_of_any(const char_t* str, const xtd::char_set<char_t>& values, size_t start_index) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values, start_index);}
     template<typename char_t>
-    static std::basic_string<char_t> insert(const char_t* str, size_t start_index, const char_t* value) noexcept {return insert(std::basic_string<char_t>(str), start_index, std::basic_string<char_t>(value));}
+    static size_t index_of_any(const char_t* str, const xtd::char_set<char_t>& values, size_t start_index, size_t count) noexcept {return index_of_any(std::basic_string_view<char_t>(str), values, start_index, count);}
     /// @endcond
     
-    /// @brief Indicates whether the specified string is an empty string ("").
-    /// @param str The string to test.
-    /// @return true if the value parameter is null or an empty string (""); otherwise, false.
+    /// @cond
     template<typename char_t>
-    static bool is_empty(const std::basic_string<char_t>& str) {return str.empty();}
+    static size_t index_of_any(std::basic_string_view<char_t> str, const std::vector<char_t>& values) noexcept {return index_of_any(str, values, 0, str.size());}
+    template<typename char_t>
+    static size_t index_of_any(std::basic_string_view<char_t> str, const std::vector<char_t>& values, size_t start_index) noexcept {return index_of_any(str, values, start_index, str.size() - start_index);}
+    template<typename char_t>
+    static size_t index_of_any(std::basic_string_view<char_t> str, const std::vector<char_t>& values, size_t start_index, size_t count) noexcept {return index_of_any(str, xtd::char_set<char_t>(values), start_index, count);}
+    template<typename char_t>
+    static size_t index_of_any(std::basic_string_view<char_t> str, const xtd::char_set<char_t>& values) noexcept {return index_of_any(str, values, 0, str.size());}
+    template<typename char_t>
+    static size_t index_of_any(std::basic_string_view<char_t> str, const xtd::char_set<char_t>& values, size_t start_index) noexcept {return index_of_any(str, values, start_index, str.size() - start_index);}
+    template<typename char_t>
+    static size_t index_of_any(std::basic_string_view<char_t> str, const xtd::char_set<char_t>& values, size_t start_index, size_t count) noexcept {
+      if (start_index >= str.size()) return std::basic_string<char_t>::npos;
+      return values.find_first(str.substr(0, count < str.size() - start_index ? start_index + count + 1 : str.size()), start_index);
+    }
+    /// @endcond
     
-    /// @brief Concatenates a specified separator String between each element of a specified Object array, yielding a single concatenated String.
-    /// @param separator A String separator.
-    /// @param values An array of Object.
-    /// @return A String consisting of the elements of value interspersed with the separator String.
-    /// @remarks For example if separator is ", " and the elements of value are "red", "blue", "green", and "yellow", Join(separator, value) returns "red, blue, green, yellow".
-    /// @remarks stream << operator is called on each object to generate the content.
-    template<typename char_t, typename Collection>
-    static std::basic_string<char_t> join(const std::basic_string<char_t>& separator, const Collection& values) noexcept {return join(separator, values, 0, values.size());}
+    /// @brief Reports the index of the first occurrence in this instance of any of the specified substrings.
+    /// @param str A String to find index of any.
+    /// @param values The compiled substrings to seek.
+    /// @return size_t The index position of the leftmost occurrence of any substring; otherwise, std::basic_string<char_t>::npos if none was found.
+    /// @remarks Use xtd::pattern_set::index_of_any to also get which substring was found.
+    template<typename char_t>
+    static size_t index_of_any(const std::basic_string<char_t>& str, const xtd::pattern_set<char_t>& values) noexcept {return values.index_of_any(str).index;}
+    
+    /// @brief Reports the index of the first occurrence in this instance of any of the specified substrings. The search starts at a specified character position.
+    /// @param str A String to find index of any.
+    /// @param values The compiled substrings to seek.
+    /// @param start_index The search starting position
+    /// @return size_t The index position of the leftmost occurrence of any substring; otherwise, std::basic_string<char_t>::npos if none was found.
+    template<typename char_t>
+    static size_t index_of_any(const std::basic_string<char_t>& str, const xtd::pattern_set<char_t>& values, size_t start_index) noexcept {return values.index_of_any(str, start_index).index;}
+    
+    /// @cond
+    template<typename char_t>
+    static size_t index_of_any(const char_t* str, const xtd::pattern_set<char_t>& values) noexcept {return values.index_of_any(str).index;}
+    template<typename char_t>
+    static size_t index_of_any(const char_t* str, const xtd::pattern_set<char_t>& values, size_t start_index) noexcept {return values.index_of_any(str, start_index).index;}
+    template<typename char_t>
+    static size_t index_of_any(std::basic_string_view<char_t> str, const xtd::pattern_set<char_t>& values) noexcept {return values.index_of_any(str).index;}
+    template<typename char_t>
+    static size_t index_of_any(std::basic_string_view<char_t> str, const xtd::pattern_set<char_t>& values, size_t start_index) noexcept {return values.index_of_any(str, start_index).index;}
+    /// @endcond
+    
+    /// @brief Inserts a specified instance of String at a specified index position in this instance.
+    /// @param start_index The index position of the insertion.
+    /// @param value The String to insert.
+    /// @return String A new String equivalent to this instance but with value inserted at position start_index.
+    /// @remarks If start_index is equal to the length of this instance, value is appended to the end of this instance.
+    /// @remarks For example, the return value of "abc".Insert(2, "XYZ") is "abXYZc".
+    template<typename char_t>
+    static std::basic_string<char_t> insert(const std::basic_string<char_t>& str, size_t start_index, const std::basic_string<char_t>& value) noexcept {
+      std::basic_string<char_t> result(str);
+      result.insert(start_index, value);
+      return result;
+    }
+    
+    /// @cond
+    template<typename char_t>
+    static std::basic_string<char_t> insert(const char_t* str, size_t start_index, const std::basic_string<char_t>& value) noexcept {return insert(std::basic_string<char_t>(str), start_index, value);}
+    template<typename char_t>
+    static std::basic_string<char_t> insert(const std::basic_string<char_t>& str, size_t start_index, char_t* value) noexcept {return insert(str, start_index, std::basic_string<char_t>(value));}
+    template<typename char_t>
+    static std::basic_string<char_t> insert(const char_t* str, size_t start_index, const char_t* value) noexcept {return insert(std::basic_string<char_t>(str), start_index, std::basic_string<char_t>(value));}
+    /// @endcond
+    
+    /// @brief Indicates whether the specified string is an empty string ("").
+    /// @param str The string to test.
+    /// @return true if the value parameter is null or an empty string (""); otherwise, false.
+    template<typename char_t>
+    static bool is_empty(const std::basic_string<char_t>& str) {return str.empty();}
+    
+    /// @brief Concatenates a specified separator String between each element of a specified Object array, yielding a single concatenated String.
+    /// @param separator A String separator.
+    /// @param values An array of Object.
+    /// @return A String consisting of the elements of value interspersed with the separator String.
+    /// @remarks For example if separator is ", " and the elements of value are "red", "blue", "green", and "yellow", Join(separator, value) returns "red, blue, green, yellow".
+    /// @remarks Strings and numbers are appended without a stream into a result allocated once; stream << operator is called on other objects to generate the content.
+    template<typename char_t, typename allocator_t, typename Collection>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> join(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& separator, const Collection& values) noexcept {return join(separator, values, 0, values.size());}
     
     /// @brief Concatenates a specified separator String between each element of a specified Object array, yielding a single concatenated String.
     /// @param separator A String separator.
@@ -946,9 +1231,9 @@ namespace xtd {
     /// @param start_index The first array element in value to use.
     /// @return A String consisting of the elements of value interspersed with the separator String.
     /// @remarks For example if separator is ", " and the elements of value are "red", "blue", "green", and "yellow", Join(separator, value) returns "red, blue, green, yellow".
-    /// @remarks stream << operator is called on each object to generate the content.
-    template<typename char_t, typename Collection>
-    static std::basic_string<char_t> join(const std::basic_string<char_t>& separator, const Collection& values, size_t index) noexcept {return join(separator, values, index, values.size()-index);}
+    /// @remarks Strings and numbers are appended without a stream into a result allocated once; stream << operator is called on other objects to generate the content.
+    template<typename char_t, typename allocator_t, typename Collection>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> join(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& separator, const Collection& values, size_t index) noexcept {return join(separator, values, index, values.size()-index);}
     
     /// @brief Concatenates a specified separator String between each element of a specified Object array, yielding a single concatenated String.
     /// @param separator A String separator.
@@ -957,19 +1242,25 @@ namespace xtd {
     /// @param count The number of elements of value to use.
     /// @return A String consisting of the elements of value interspersed with the separator String.
     /// @remarks For example if separator is ", " and the elements of value are "red", "blue", "green", and "yellow", Join(separator, value) returns "red, blue, green, yellow".
-    /// @remarks stream << operator is called on each object to generate the content.
-    template<typename char_t, typename Collection>
-    static std::basic_string<char_t> join(const std::basic_string<char_t>& separator, const Collection& values, size_t index, size_t count) noexcept {
-      size_t i = 0;
-      std::basic_stringstream<char_t> ss;
+    /// @remarks Strings and numbers are appended without a stream into a result allocated once; stream << operator is called on other objects to generate the content.
+    template<typename char_t, typename allocator_t, typename Collection>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> join(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& separator, const Collection& values, size_t index, size_t count) noexcept {
+      size_t i = 0, length = 0;
+      for (const auto& item : values) {
+        if (i >= index) length += (i != index ? separator.size() : 0) + __concat_size_hint<char_t>(item);
+        if (++i >= index + count) break;
+      }
+      std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(separator.get_allocator());
+      result.reserve(length);
+      i = 0;
       for (const auto& item : values) {
         if (i >= index) {
-          if (i != index) ss << separator;
-          ss << item;
+          if (i != index) result.append(separator);
+          __concat_append(result, item);
         }
         if (++i >= index + count) break;
       }
-      return ss.str();
+      return result;
     }
     
     /// @cond
@@ -992,24 +1283,24 @@ namespace xtd {
     /// @param value A Unicode character to seek
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t last_index_of(const std::basic_string<char_t>& str, char_t value) noexcept {return last_index_of(str, value, 0, str.size());}
+    static size_t last_index_of(const std::basic_string<char_t>& str, char_t value) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value, 0, str.size());}
     
     /// @brief Reports the index of the last occurrence of the specified string in the specified string.
     /// @param str A String to find last index of.
     /// @param value A Unicode character to seek
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t last_index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value) noexcept {return last_index_of(str, value, 0, str.size());}
+    static size_t last_index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), 0, str.size());}
     
     /// @cond
     template<typename char_t>
-    static size_t last_index_of(const char_t* str, char_t value) noexcept {return last_index_of(std::basic_string<char_t>(str), value);}
+    static size_t last_index_of(const char_t* str, char_t value) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value);}
     template<typename char_t>
-    static size_t last_index_of(const std::basic_string<char_t>& str, const char_t* value) noexcept {return last_index_of(str, std::basic_string<char_t>(value));}
+    static size_t last_index_of(const std::basic_string<char_t>& str, const char_t* value) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value));}
     template<typename char_t>
-    static size_t last_index_of(const char_t* str, const std::basic_string<char_t>& value) noexcept {return last_index_of(std::basic_string<char_t>(str), value);}
+    static size_t last_index_of(const char_t* str, const std::basic_string<char_t>& value) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value));}
     template<typename char_t>
-    static size_t last_index_of(const char_t* str, const char_t* value) noexcept {return last_index_of(std::basic_string<char_t>(str), std::basic_string<char_t>(value));}
+    static size_t last_index_of(const char_t* str, const char_t* value) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value));}
     /// @endcond
     
     /// @brief Reports the index of the last occurrence of the specified character in the spexified string. The search starts at a specified character position.
@@ -1018,7 +1309,7 @@ namespace xtd {
     /// @param start_index The search starting position
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t last_index_of(const std::basic_string<char_t>& str, char_t value, size_t start_index) noexcept {return last_index_of(str, value, start_index, str.size() - start_index);}
+    static size_t last_index_of(const std::basic_string<char_t>& str, char_t value, size_t start_index) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value, start_index, str.size() - start_index);}
     
     /// @brief Reports the index of the last occurrence of the specified character in the spexified string. The search starts at a specified character position.
     /// @param str A String to find last index of.
@@ -1026,17 +1317,17 @@ namespace xtd {
     /// @param start_index The search starting position
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t last_index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, size_t start_index) noexcept {return last_index_of(str, value, start_index, str.size() - start_index);}
+    static size_t last_index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, size_t start_index) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index, str.size() - start_index);}
     
     /// @cond
     template<typename char_t>
-    static size_t last_index_of(const char_t* str, char_t value, size_t start_index) noexcept {return last_index_of(std::basic_string<char_t>(str), value, start_index);}
+    static size_t last_index_of(const char_t* str, char_t value, size_t start_index) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value, start_index);}
     template<typename char_t>
-    static size_t last_index_of(const std::basic_string<char_t>& str, const char_t* value, size_t start_index) noexcept {return last_index_of(str, std::basic_string<char_t>(value), start_index);}
+    static size_t last_index_of(const std::basic_string<char_t>& str, const char_t* value, size_t start_index) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index);}
     template<typename char_t>
-    static size_t last_index_of(const char_t* str, const std::basic_string<char_t>& value, size_t start_index) noexcept {return last_index_of(std::basic_string<char_t>(str), value, start_index);}
+    static size_t last_index_of(const char_t* str, const std::basic_string<char_t>& value, size_t start_index) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index);}
     template<typename char_t>
-    static size_t last_index_of(const char_t* str, const char_t* value, size_t start_index) noexcept {return last_index_of(std::basic_string<char_t>(str), std::basic_string<char_t>(value), start_index);}
+    static size_t last_index_of(const char_t* str, const char_t* value, size_t start_index) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index);}
     /// @endcond
     
     /// @brief Reports the index of the last occurrence of the specified character in the spexified string. The search starts at a specified character position and examines a specified number of character positions.
@@ -1046,10 +1337,7 @@ namespace xtd {
     /// @param count The number of character positions to examine
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t last_index_of(const std::basic_string<char_t>& str, char_t value, size_t start_index, size_t count) noexcept {
-      size_t result = str.rfind(value, start_index + count - 1);
-      return result < start_index ? std::basic_string<char_t>::npos : result;
-    }
+    static size_t last_index_of(const std::basic_string<char_t>& str, char_t value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value, start_index, count);}
     
     /// @brief Reports the index of the last occurrence of the specified character in the spexified string. The search starts at a specified character position and examines a specified number of character positions.
     /// @param str A String to find last index of.
@@ -1058,20 +1346,82 @@ namespace xtd {
     /// @param count The number of character positions to examine
     /// @return size_t The index position of value if that character is found, or std::basic_string<char_t>::npos if it is not.
     template<typename char_t>
-    static size_t last_index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, size_t start_index, size_t count) noexcept {
+    static size_t last_index_of(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index, count);}
+    
+    /// @cond
+    template<typename char_t>
+    static size_t last_index_of(const char_t* str, char_t value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value, start_index, count);}
+    template<typename char_t>
+    static size_t last_index_of(const std::basic_string<char_t>& str, const char_t* value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index, count);}
+    template<typename char_t>
+    static size_t last_index_of(const char_t* str, const std::basic_string<char_t>& value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index, count);}
+    template<typename char_t>
+    static size_t last_index_of(const char_t* str, const char_t* value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), start_index, count);}
+    /// @endcond
+    
+    /// @cond
+    template<typename char_t>
+    static size_t last_index_of(std::basic_string_view<char_t> str, char_t value) noexcept {return last_index_of(str, value, 0, str.size());}
+    template<typename char_t>
+    static size_t last_index_of(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value) noexcept {return last_index_of(str, value, 0, str.size());}
+    template<typename char_t>
+    static size_t last_index_of(std::basic_string_view<char_t> str, char_t value, size_t start_index) noexcept {return last_index_of(str, value, start_index, str.size() - start_index);}
+    template<typename char_t>
+    static size_t last_index_of(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value, size_t start_index) noexcept {return last_index_of(str, value, start_index, str.size() - start_index);}
+    template<typename char_t>
+    static size_t last_index_of(std::basic_string_view<char_t> str, char_t value, size_t start_index, size_t count) noexcept {
+      size_t result = str.rfind(value, start_index + count - 1);
+      return result < start_index ? std::basic_string<char_t>::npos : result;
+    }
+    template<typename char_t>
+    static size_t last_index_of(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value, size_t start_index, size_t count) noexcept {
       size_t result = str.rfind(value, start_index + count - value.size());
       return result < start_index ? std::basic_string<char_t>::npos : result;
     }
+    /// @endcond
+    
+    /// @brief Reports the index of the last occurrence of the specified substring in the specified string.
+    /// @param str A String to find last index of.
+    /// @param value The preprocessed substring to seek.
+    /// @return size_t The index position of value if that string is found, or std::basic_string<char_t>::npos if it is not.
+    template<typename char_t>
+    static size_t last_index_of(const std::basic_string<char_t>& str, const xtd::searcher<char_t>& value) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value, 0, str.size());}
+    
+    /// @brief Reports the index of the last occurrence of the specified substring in the specified string. The search starts at a specified character position.
+    /// @param str A String to find last index of.
+    /// @param value The preprocessed substring to seek.
+    /// @param start_index The search starting position
+    /// @return size_t The index position of value if that string is found, or std::basic_string<char_t>::npos if it is not.
+    template<typename char_t>
+    static size_t last_index_of(const std::basic_string<char_t>& str, const xtd::searcher<char_t>& value, size_t start_index) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value, start_index, str.size() - start_index);}
+    
+    /// @brief Reports the index of the last occurrence of the specified substring in the specified string. The search starts at a specified character position and examines a specified number of character positions.
+    /// @param str A String to find last index of.
+    /// @param value The preprocessed substring to seek.
+    /// @param start_index The search starting position
+    /// @param count The number of character positions to examine.
+    /// @return size_t The index position of value if that string is found, or std::basic_string<char_t>::npos if it is not.
+    template<typename char_t>
+    static size_t last_index_of(const std::basic_string<char_t>& str, const xtd::searcher<char_t>& value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value, start_index, count);}
     
     /// @cond
     template<typename char_t>
-    static size_t last_index_of(const char_t* str, char_t value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string<char_t>(str), value, start_index, count);}
+    static size_t last_index_of(const char_t* str, const xtd::searcher<char_t>& value) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value);}
+    template<typename char_t>
+    static size_t last_index_of(const char_t* str, const xtd::searcher<char_t>& value, size_t start_index) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value, start_index);}
+    template<typename char_t>
+    static size_t last_index_of(const char_t* str, const xtd::searcher<char_t>& value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string_view<char_t>(str), value, start_index, count);}
+    
     template<typename char_t>
-    static size_t last_index_of(const std::basic_string<char_t>& str, const char_t* value, size_t start_index, size_t count) noexcept {return last_index_of(str, std::basic_string<char_t>(value), start_index, count);}
+    static size_t last_index_of(std::basic_string_view<char_t> str, const xtd::searcher<char_t>& value) noexcept {return last_index_of(str, value, 0, str.size());}
     template<typename char_t>
-    static size_t last_index_of(const char_t* str, const std::basic_string<char_t>& value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string<char_t>(str), value, start_index, count);}
+    static size_t last_index_of(std::basic_string_view<char_t> str, const xtd::searcher<char_t>& value, size_t start_index) noexcept {return last_index_of(str, value, start_index, str.size() - start_index);}
     template<typename char_t>
-    static size_t last_index_of(const char_t* str, const char_t* value, size_t start_index, size_t count) noexcept {return last_index_of(std::basic_string<char_t>(str), std::basic_string<char_t>(value), start_index, count);}
+    static size_t last_index_of(std::basic_string_view<char_t> str, const xtd::searcher<char_t>& value, size_t start_index, size_t count) noexcept {
+      if (value.value().size() > start_index + count) return std::basic_string<char_t>::npos;
+      size_t result = value.find_last(str, start_index + count - value.value().size());
+      return result < start_index ? std::basic_string<char_t>::npos : result;
+    }
     /// @endcond
     
     /// @brief Reports the index of the last occurrence in this instance of any character in a specified array of characters.
@@ -1079,7 +1429,7 @@ namespace xtd {
     /// @param values A Unicode character array containing one or more characters to seek
     /// @return size_t The index position of the first occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
     template<typename char_t>
-    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values) noexcept {return last_index_of_any(str, values, 0, str.size());}
+    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values, 0, str.size());}
     
     /// @brief Reports the index of the last occurrence in this instance of any character in a specified array of characters. The search starts at a specified character position.
     /// @param str A String to find index of any.
@@ -1087,7 +1437,7 @@ namespace xtd {
     /// @param start_index The search starting position
     /// @return size_t The index position of the first occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
     template<typename char_t>
-    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values, size_t start_index) noexcept {return last_index_of_any(str, values, start_index, str.size() - start_index);}
+    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values, size_t start_index) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values, start_index, str.size() - start_index);}
     
     /// @brief Reports the index of the last occurrence in this instance of any character in a specified array of characters. The search starts at a specified character position.
     /// @param str A String to find last index of any.
@@ -1096,43 +1446,87 @@ namespace xtd {
     /// @param count The number of character positions to examine.
     /// @return size_t The index position of the first occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
     template<typename char_t>
-    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values, size_t start_index, size_t count) noexcept {
-      size_t index = str.size() - 1;
-      for (typename std::basic_string<char_t>::const_reverse_iterator it = str.crbegin(); it != str.crend(); ++it) {
-        if (index-- > start_index + count) continue;
-        if (index + 1 < start_index) break;
-        if (std::find(values.begin(), values.end(), *it) != values.end()) return index + 1;
-      }
-      return std::basic_string<char_t>::npos;
-    }
+    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::vector<char_t>& values, size_t start_index, size_t count) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values, start_index, count);}
     
     /// @cond
     template<typename char_t>
-    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values) noexcept {return last_index_of_any(str, std::vector<char_t>(values));}
+    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values));}
+    
+    template<typename char_t>
+    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values, size_t start_index) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values), start_index);}
+    
+    template<typename char_t>
+    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values, size_t start_index, size_t count) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values), start_index, count);}
+    
+    template<typename char_t>
+    static size_t last_index_of_any(const char_t* str, const std::vector<char_t>& values) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values);}
+    
+    template<typename char_t>
+    static size_t last_index_of_any(const char_t* str, const std::vector<char_t>& values, size_t start_index) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values, start_index);}
+    
+    template<typename char_t>
+    static size_t last_index_of_any(const char_t* str, const std::vector<char_t>& values, size_t start_index, size_t count) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values), start_index, count);}
     
     template<typename char_t>
-    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values, size_t start_index) noexcept {return last_index_of_any(str, std::vector<char_t>(values), start_index);}
+    static size_t last_index_of_any(const char_t* str, const std::initializer_list<char_t>& values) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values));}
     
     template<typename char_t>
-    static size_t last_index_of_any(const std::basic_string<char_t>& str, const std::initializer_list<char_t>& values, size_t start_index, size_t count) noexcept {return last_index_of_any(str, std::vector<char_t>(values), start_index, count);}
+    static size_t last_index_of_any(const char_t* str, const std::initializer_list<char_t>& values, size_t start_index) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values), start_index);}
     
     template<typename char_t>
-    static size_t last_index_of_any(const char_t* str, const std::vector<char_t>& values) noexcept {return last_index_of_any(std::basic_string<char_t>(str), values);}
+    static size_t last_index_of_any(const char_t* str, const std::initializer_list<char_t>& values, size_t start_index, size_t count) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), std::vector<char_t>(values), start_index, count);}
+    /// @endcond
     
+    /// @brief Reports the index of the last occurrence in this instance of any character in a specified set of characters.
+    /// @param str A String to find last index of any.
+    /// @param values A precompiled set of characters to seek.
+    /// @return size_t The index position of the last occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
     template<typename char_t>
-    static size_t last_index_of_any(const char_t* str, const std::vector<char_t>& values, size_t start_index) noexcept {return last_index_of_any(std::basic_string<char_t>(str), values, start_index);}
+    static size_t last_index_of_any(const std::basic_string<char_t>& str, const xtd::char_set<char_t>& values) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values, 0, str.size());}
     
+    /// @brief Reports the index of the last occurrence in this instance of any character in a specified set of characters. The search starts at a specified character position.
+    /// @param str A String to find last index of any.
+    /// @param values A precompiled set of characters to seek.
+    /// @param start_index The search starting position
+    /// @return size_t The index position of the last occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
     template<typename char_t>
-    static size_t last_index_of_any(const char_t* str, const std::vector<char_t>& values, size_t start_index, size_t count) noexcept {return last_index_of_any(std::basic_string<char_t>(str), std::vector<char_t>(values), start_index, count);}
+    static size_t last_index_of_any(const std::basic_string<char_t>& str, const xtd::char_set<char_t>& values, size_t start_index) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values, start_index);}
     
+    /// @brief Reports the index of the last occurrence in this instance of any character in a specified set of characters. The search starts at a specified character position.
+    /// @param str A String to find last index of any.
+    /// @param values A precompiled set of characters to seek.
+    /// @param start_index The search starting position
+    /// @param count The number of character positions to examine.
+    /// @return size_t The index position of the last occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
     template<typename char_t>
-    static size_t last_index_of_any(const char_t* str, const std::initializer_list<char_t>& values) noexcept {return last_index_of_any(std::basic_string<char_t>(str), std::vector<char_t>(values));}
+    static size_t last_index_of_any(const std::basic_string<char_t>& str, const xtd::char_set<char_t>& values, size_t start_index, size_t count) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values, start_index, count);}
     
+    /// @cond
+    template<typename char_t>
+    static size_t last_index_of_any(const char_t* str, const xtd::char_set<char_t>& values) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values);}
     template<typename char_t>
-    static size_t last_index_of_any(const char_t* str, const std::initializer_list<char_t>& values, size_t start_index) noexcept {return last_index_of_any(std::basic_string<char_t>(str), std::vector<char_t>(values), start_index);}
+    static size_t last_index_of_any(const char_t* str, const xtd::char_set<char_t>& values, size_t start_index) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values, start_index);}
+    template<typename char_t>
+    static size_t last_index_of_any(const char_t* str, const xtd::char_set<char_t>& values, size_t start_index, size_t count) noexcept {return last_index_of_any(std::basic_string_view<char_t>(str), values, start_index, count);}
+    /// @endcond
     
+    /// @cond
     template<typename char_t>
-    static size_t last_index_of_any(const char_t* str, const std::initializer_list<char_t>& values, size_t start_index, size_t count) noexcept {return last_index_of_any(std::basic_string<char_t>(str), std::vector<char_t>(values), start_index, count);}
+    static size_t last_index_of_any(std::basic_string_view<char_t> str, const std::vector<char_t>& values) noexcept {return last_index_of_any(str, values, 0, str.size());}
+    template<typename char_t>
+    static size_t last_index_of_any(std::basic_string_view<char_t> str, const std::vector<char_t>& values, size_t start_index) noexcept {return last_index_of_any(str, values, start_index, str.size() - start_index);}
+    template<typename char_t>
+    static size_t last_index_of_any(std::basic_string_view<char_t> str, const std::vector<char_t>& values, size_t start_index, size_t count) noexcept {return last_index_of_any(str, xtd::char_set<char_t>(values), start_index, count);}
+    template<typename char_t>
+    static size_t last_index_of_any(std::basic_string_view<char_t> str, const xtd::char_set<char_t>& values) noexcept {return last_index_of_any(str, values, 0, str.size());}
+    template<typename char_t>
+    static size_t last_index_of_any(std::basic_string_view<char_t> str, const xtd::char_set<char_t>& values, size_t start_index) noexcept {return last_index_of_any(str, values, start_index, str.size() - start_index);}
+    template<typename char_t>
+    static size_t last_index_of_any(std::basic_string_view<char_t> str, const xtd::char_set<char_t>& values, size_t start_index, size_t count) noexcept {
+      if (start_index >= str.size()) return std::basic_string<char_t>::npos;
+      size_t index = values.find_last(str.substr(start_index, count < str.size() - start_index ? count + 1 : str.size() - start_index));
+      return index == xtd::char_set<char_t>::npos ? std::basic_string<char_t>::npos : start_index + index;
+    }
     /// @endcond
     
     /// @brief Right-aligns the characters iin the specified string, padding with spaces on the left for a specified total length.
@@ -1141,8 +1535,8 @@ namespace xtd {
     /// @return String A new String that is equivalent to the specified string, but right-aligned and padded on the left with as many spaces as needed to create a length of total_width. Or, if total_width is less than the length of the specified string, a new String object that is identical to the specified string.
     /// @remarks A Unicode space is defined as hexadecimal 0x20.
     /// @remarks The pad_left(const std::basic_string<char_t>&, int) method pads the beginning of the returned String. This means that, when used with right-to-left languages, it pads the right portion of the String..
-    template<typename char_t>
-    static std::basic_string<char_t> pad_left(const std::basic_string<char_t>& str, size_t total_width) noexcept {return pad_left(str, total_width, static_cast<char_t>(0x20));}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> pad_left(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, size_t total_width) noexcept {return pad_left(str, total_width, static_cast<char_t>(0x20));}
     
     /// @brief Right-aligns the characters in the specified string, padding with spaces on the left for a specified total length.
     /// @param str String to pad left.
@@ -1151,10 +1545,12 @@ namespace xtd {
     /// @return String A new String that is equivalent to the specified string, but right-aligned and padded on the left with as many spaces as needed to create a length of total_width. Or, if total_width is less than the length of the specified string, a new String object that is identical the specified string.
     /// @remarks A Unicode space is defined as hexadecimal 0x20.
     /// @remarks The pad_left(const std::basic_string<char_t>&, int) method pads the beginning of the returned String. This means that, when used with right-to-left languages, it pads the right portion of the String..
-    template<typename char_t>
-    static std::basic_string<char_t> pad_left(const std::basic_string<char_t>& str, size_t total_width, char_t padding_char) noexcept {
-      if (total_width < str.size()) return str;
-      return std::basic_string<char_t>(total_width - str.size(), padding_char).append(str);
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> pad_left(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, size_t total_width, char_t padding_char) noexcept {
+      if (total_width < str.size()) return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(str, str.get_allocator());
+      std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(total_width - str.size(), padding_char, str.get_allocator());
+      result.append(str);
+      return result;
     }
     
     /// @cond
@@ -1171,8 +1567,8 @@ namespace xtd {
     /// @return String A new String that is equivalent to the specified string, but left-aligned and padded on the right with as many spaces as needed to create a length of totalWidth. Or, if totalWidth is less than the length of the specified string, a new String object that is identical to the specified string.
     /// @remarks A Unicode space is defined as hexadecimal 0x20.
     /// @remarks The PadRight(const std::basic_string<char_t>&, int) method pads the end of the returned String. This means that, when used with right-to-left languages, it pads the left portion of the String..
-    template<typename char_t>
-    static std::basic_string<char_t> pad_right(const std::basic_string<char_t>& str, size_t total_width) noexcept {return pad_right(str, total_width, static_cast<char_t>(0x20));}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> pad_right(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, size_t total_width) noexcept {return pad_right(str, total_width, static_cast<char_t>(0x20));}
     
     /// @brief Left-aligns the characters in the specified string, padding with spaces on the right for a specified total length.
     /// @param str String to pad right.
@@ -1181,10 +1577,12 @@ namespace xtd {
     /// @return String A new String that is equivalent to the specified string, but left-aligned and padded on the tight with as many spaces as needed to create a length of totalWidth. Or, if totalWidth is less than the length of the specified string, a new String object that is identical to the specified string.
     /// @remarks A Unicode space is defined as hexadecimal 0x20.
     /// @remarks The PadRight(const std::basic_string<char_t>&, int) method pads the end of the returned String. This means that, when used with right-to-left languages, it pads the left portion of the String..
-    template<typename char_t>
-    static std::basic_string<char_t> pad_right(const std::basic_string<char_t>& str, size_t total_width, char_t padding_char) noexcept {
-      if (total_width < str.size()) return str;
-      return std::basic_string<char_t>(str).append(total_width - str.size(), padding_char);
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> pad_right(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, size_t total_width, char_t padding_char) noexcept {
+      if (total_width < str.size()) return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(str, str.get_allocator());
+      std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(str, str.get_allocator());
+      result.append(total_width - str.size(), padding_char);
+      return result;
     }
     
     /// @cond
@@ -1228,8 +1626,12 @@ namespace xtd {
     /// @param old_char A char_t to be replaced.
     /// @param new_char A char_t to replace all occurrences of old_char.
     /// @return String A A new String equivalent to the specified string but with all instances of old_char replaced with new_char.
-    template<typename char_t>
-    static std::basic_string<char_t> replace(const std::basic_string<char_t>& str, char_t old_char, char_t new_char) noexcept {return replace(str, std::basic_string<char_t>(1, old_char), std::basic_string<char_t>(1, new_char));}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> replace(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, char_t old_char, char_t new_char) noexcept {
+      std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(str, str.get_allocator());
+      std::replace(result.begin(), result.end(), old_char, new_char);
+      return result;
+    }
     
     /// @brief Replaces all occurrences of a specified String in the specified string with another specified String.
     /// @param str String containing string to replace.
@@ -1237,37 +1639,131 @@ namespace xtd {
     /// @param new_string A String to replace all occurrences of old_string.
     /// @return String A A new String equivalent to the specified string but with all instances of old_string replaced with new_string.
     /// @remarks If new_string is empty, all occurrences of old_string are removed
-    template<typename char_t>
-    static std::basic_string<char_t> replace(const std::basic_string<char_t>& str, const std::basic_string<char_t>& old_string, const std::basic_string<char_t>& new_string) noexcept {
-      std::basic_string<char_t> result(str);
-      size_t index = 0;
-      while (true) {
-        index = result.find(old_string, index);
-        if (index == std::string::npos) break;
-        result.erase(index, old_string.size());
-        result.insert(index, new_string);
-        index += new_string.size();
-      }
-      return result;
-    }
+    /// @remarks The occurrences are counted first, so that the result is allocated once with its final size.
+    template<typename char_t, typename allocator_t, typename old_allocator_t, typename new_allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> replace(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::basic_string<char_t, std::char_traits<char_t>, old_allocator_t>& old_string, const std::basic_string<char_t, std::char_traits<char_t>, new_allocator_t>& new_string) noexcept {return replace(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(old_string), std::basic_string_view<char_t>(new_string), str.get_allocator());}
     
     /// @cond
     template<typename char_t>
     static std::basic_string<char_t> replace(const char_t* str, char_t old_char, char_t new_char) noexcept {return replace(std::basic_string<char_t>(str), old_char, new_char);}
     template<typename char_t>
     static std::basic_string<char_t> replace(const char_t* str, const char_t* old_string, const char_t* new_string) noexcept {return replace(std::basic_string<char_t>(str), std::basic_string<char_t>(old_string), std::basic_string<char_t>(new_string));}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> replace(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const char_t* old_string, const char_t* new_string) noexcept {return replace(str, std::basic_string<char_t>(old_string), std::basic_string<char_t>(new_string));}
+    template<typename char_t, typename old_allocator_t>
+    static std::basic_string<char_t> replace(const char_t* str, const std::basic_string<char_t, std::char_traits<char_t>, old_allocator_t>& old_string, const char_t* new_string) noexcept {return replace(std::basic_string<char_t>(str), old_string, std::basic_string<char_t>(new_string));}
+    template<typename char_t, typename new_allocator_t>
+    static std::basic_string<char_t> replace(const char_t* str, const char_t* old_string, const std::basic_string<char_t, std::char_traits<char_t>, new_allocator_t>& new_string) noexcept {return replace(std::basic_string<char_t>(str), std::basic_string<char_t>(old_string), new_string);}
+    template<typename char_t, typename allocator_t, typename old_allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> replace(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::basic_string<char_t, std::char_traits<char_t>, old_allocator_t>& old_string, const char_t* new_string) noexcept {return replace(str, old_string, std::basic_string<char_t>(new_string));}
+    template<typename char_t, typename allocator_t, typename new_allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> replace(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const char_t* old_string, const std::basic_string<char_t, std::char_traits<char_t>, new_allocator_t>& new_string) noexcept {return replace(str, std::basic_string<char_t>(old_string), new_string);}
+    template<typename char_t, typename old_allocator_t, typename new_allocator_t>
+    static std::basic_string<char_t> replace(const char_t* str, const std::basic_string<char_t, std::char_traits<char_t>, old_allocator_t>& old_string, const std::basic_string<char_t, std::char_traits<char_t>, new_allocator_t>& new_string) noexcept {return replace(std::basic_string<char_t>(str), old_string, new_string);}
+    /// @endcond
+    
+    /// @cond
+    template<typename char_t, typename allocator_t = std::allocator<char_t>>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> replace(std::basic_string_view<char_t> str, std::basic_string_view<char_t> old_string, std::basic_string_view<char_t> new_string, const allocator_t& allocator = allocator_t()) noexcept {
+      // An empty old_string matches before each character and at the end.
+      if (old_string.empty()) {
+        if (new_string.empty()) return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(str, allocator);
+        std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(allocator);
+        result.reserve(str.size() + (str.size() + 1) * new_string.size());
+        for (auto c : str)
+          result.append(new_string).push_back(c);
+        result.append(new_string);
+        return result;
+      }
+      size_t count = 0;
+      for (size_t index = str.find(old_string); index != str.npos; index = str.find(old_string, index + old_string.size()))
+        ++count;
+      if (count == 0) return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(str, allocator);
+      std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(allocator);
+      result.reserve(str.size() - count * old_string.size() + count * new_string.size());
+      size_t start = 0;
+      for (size_t index = str.find(old_string); index != str.npos; index = str.find(old_string, start)) {
+        result.append(str.data() + start, index - start).append(new_string);
+        start = index + old_string.size();
+      }
+      result.append(str.data() + start, str.size() - start);
+      return result;
+    }
+    /// @endcond
+    
+    /// @brief Replaces, in a single pass, all occurrences of several specified strings in the specified string with their replacement strings.
+    /// @param str String containing strings to replace.
+    /// @param replacements The pairs of a string to be replaced and its replacement string.
+    /// @return String A new String equivalent to the specified string but with all instances of each first string replaced with its second string.
+    /// @remarks The specified string is scanned once with an xtd::pattern_set: at each position the longest string to be replaced wins, and replaced text is never searched again. If the same string is specified several times, its first replacement is used. Empty strings to be replaced are ignored.
+    /// @par Examples
+    /// @code
+    /// auto escaped = xtd::strings::replace(text, {{"&", "&amp;"}, {"<", "&lt;"}, {">", "&gt;"}});
+    /// @endcode
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> replace(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::vector<std::pair<std::basic_string<char_t>, std::basic_string<char_t>>>& replacements) noexcept {return replace(std::basic_string_view<char_t>(str), replacements, str.get_allocator());}
+    
+    /// @cond
     template<typename char_t>
-    static std::basic_string<char_t> replace(const std::basic_string<char_t>& str, const char_t* old_string, const char_t* new_string) noexcept {return replace(str, std::basic_string<char_t>(old_string), std::basic_string<char_t>(new_string));}
-    template<typename char_t>
-    static std::basic_string<char_t> replace(const char_t* str, std::basic_string<char_t>& old_string, const char_t* new_string) noexcept {return replace(std::basic_string<char_t>(str), old_string, std::basic_string<char_t>(new_string));}
-    template<typename char_t>
-    static std::basic_string<char_t> replace(const char_t* str, const char_t* old_string, const std::basic_string<char_t>& new_string) noexcept {return replace(std::basic_string<char_t>(str), std::basic_string<char_t>(old_string), new_string);}
-    template<typename char_t>
-    static std::basic_string<char_t> replace(const std::basic_string<char_t>& str, const std::basic_string<char_t>& old_string, const char_t* new_string) noexcept {return replace(str, old_string, std::basic_string<char_t>(new_string));}
-    template<typename char_t>
-    static std::basic_string<char_t> replace(const std::basic_string<char_t>& str, const char_t* old_string, const std::basic_string<char_t>& new_string) noexcept {return replace(str, std::basic_string<char_t>(old_string), new_string);}
+    static std::basic_string<char_t> replace(const char_t* str, const std::vector<std::pair<std::basic_string<char_t>, std::basic_string<char_t>>>& replacements) noexcept {return replace(std::basic_string_view<char_t>(str), replacements);}
+    template<typename char_t, typename allocator_t = std::allocator<char_t>>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> replace(std::basic_string_view<char_t> str, const std::vector<std::pair<std::basic_string<char_t>, std::basic_string<char_t>>>& replacements, const allocator_t& allocator = allocator_t()) noexcept {
+      std::vector<std::basic_string<char_t>> old_strings;
+      old_strings.reserve(replacements.size());
+      for (const auto& replacement : replacements)
+        old_strings.push_back(replacement.first);
+      xtd::pattern_set<char_t> patterns(old_strings);
+      std::vector<typename xtd::pattern_set<char_t>::match> matches;
+      size_t length = str.size();
+      for (auto match = patterns.index_of_any(str); match.index != xtd::pattern_set<char_t>::npos; match = patterns.index_of_any(str, match.index + match.length)) {
+        matches.push_back(match);
+        length = length - match.length + replacements[match.pattern].second.size();
+      }
+      if (matches.empty()) return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(str, allocator);
+      std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(allocator);
+      result.reserve(length);
+      size_t start = 0;
+      for (const auto& match : matches) {
+        result.append(str.data() + start, match.index - start).append(replacements[match.pattern].second);
+        start = match.index + match.length;
+      }
+      result.append(str.data() + start, str.size() - start);
+      return result;
+    }
+    /// @endcond
+    
+    /// @brief Replaces all occurrences of a preprocessed substring in the specified string with another specified String.
+    /// @param str String containing string to replace.
+    /// @param old_string The preprocessed substring to be replaced; it can ignore case.
+    /// @param new_string A String to replace all occurrences of old_string.
+    /// @return String A new String equivalent to the specified string but with all instances of old_string replaced with new_string.
+    /// @remarks The string is searched twice: once to count the occurrences and size the result, once to copy it.
+    template<typename char_t, typename allocator_t, typename new_allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> replace(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::searcher<char_t>& old_string, const std::basic_string<char_t, std::char_traits<char_t>, new_allocator_t>& new_string) noexcept {
+      size_t length = old_string.value().size();
+      if (length == 0) return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(str, str.get_allocator());
+      size_t count = 0;
+      for (size_t index = old_string.find(str); index != xtd::searcher<char_t>::npos; index = old_string.find(str, index + length))
+        ++count;
+      if (count == 0) return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(str, str.get_allocator());
+      std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(str.get_allocator());
+      result.reserve(str.size() - count * length + count * new_string.size());
+      size_t start = 0;
+      for (size_t index = old_string.find(str); index != xtd::searcher<char_t>::npos; index = old_string.find(str, start)) {
+        result.append(str, start, index - start).append(new_string);
+        start = index + length;
+      }
+      result.append(str, start, str.size() - start);
+      return result;
+    }
+    
+    /// @cond
     template<typename char_t>
-    static std::basic_string<char_t> replace(const char_t* str, const std::basic_string<char_t>& old_string, const std::basic_string<char_t>& new_string) noexcept {return replace(std::basic_string<char_t>(str), old_string, new_string);}
+    static std::basic_string<char_t> replace(const char_t* str, const xtd::searcher<char_t>& old_string, const char_t* new_string) noexcept {return replace(std::basic_string<char_t>(str), old_string, std::basic_string<char_t>(new_string));}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> replace(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::searcher<char_t>& old_string, const char_t* new_string) noexcept {return replace(str, old_string, std::basic_string<char_t>(new_string));}
+    template<typename char_t, typename new_allocator_t>
+    static std::basic_string<char_t> replace(const char_t* str, const xtd::searcher<char_t>& old_string, const std::basic_string<char_t, std::char_traits<char_t>, new_allocator_t>& new_string) noexcept {return replace(std::basic_string<char_t>(str), old_string, new_string);}
     /// @endcond
     
     /// @brief Splits a specified string into a maximum number of substrings based on the characters in an array.
@@ -1282,28 +1778,10 @@ namespace xtd {
     /// @remarks Each element of separator defines a separate delimiter character. If the options parameter is None, and two delimiters are adjacent or a delimiter is found at the beginning or end of the specified string, the corresponding array element contains an empty string.
     /// @remarks If there are more than count substrings in the specified string, the first count minus 1 substrings are returned in the first count minus 1 elements of the return value, and the remaining characters in the specified string are returned in the last element of the return value.
     /// @remarks If count is greater than the number of substrings, the available substrings are returned.
-    template<typename char_t>
-    static std::vector<std::basic_string<char_t>> split(const std::basic_string<char_t>& str, const std::vector<char_t>& separators, size_t count, string_split_options options) noexcept {
-      if (count == 0) return {};
-      if (count == 1) return {str};
-      
-      std::vector<std::basic_string<char_t>> list;
-      std::basic_string<char_t> subString;
-      std::vector<char_t> split_char_separators = separators.size() == 0 ? std::vector<char_t> {9, 10, 11, 12, 13, 32} : separators;
-      for (std::string::const_iterator it = str.begin(); it != str.end(); it++) {
-        bool is_separator =  std::find(split_char_separators.begin(), split_char_separators.end(), *it) != split_char_separators.end();
-        if (!is_separator) subString.append(std::string(1, *it));
-        if ((it - str.begin() == str.length() - 1 || is_separator) && (subString.length() > 0 || (subString.length() == 0 && options != string_split_options::remove_empty_entries))) {
-          if (list.size() == count - 1) {
-            list.push_back(subString + std::string(str.c_str(), it - str.begin() + (is_separator ? 0 : 1), str.length() - (it - str.begin()) + (is_separator ? 0 : 1)));
-            return list;
-          }
-          list.push_back(subString);
-          subString.clear();
-        }
-      }
-      
-      return list;
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::vector<char_t>& separators, size_t count, string_split_options options) noexcept {
+      if (separators.empty()) return split(str, xtd::char_set<char_t>::white_spaces(), count, options);
+      return split(str, xtd::char_set<char_t>(separators), count, options);
     }
     
     /// @brief Splits a specified string into substrings that are based on the default white-space characters. White-space characters are defined by the c++ standard and return true if they are passed to the std::isspace() or std::iswspace() method.
@@ -1311,8 +1789,8 @@ namespace xtd {
     /// @return An array whose elements contain the substrings in this string that are delimited by one or more characters in white-space separators. For more information, see the Remarks section.
     /// @remarks Delimiter characters are not included in the elements of the returned array.
     /// @remarks If the specified string does not contain any of the characters in separator, or the count parameter is 1, the returned array consists of a single element that contains the specified string.
-    template<typename char_t>
-    static std::vector<std::basic_string<char_t>> split(const std::basic_string<char_t>& str) noexcept {return split(str, std::vector<char_t> {9, 10, 11, 12, 13, 32}, std::numeric_limits<size_t>::max(), string_split_options::none);}
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str) noexcept {return split(str, std::vector<char_t> {9, 10, 11, 12, 13, 32}, std::numeric_limits<size_t>::max(), string_split_options::none);}
     
     /// @brief Splits a specified string into substrings that are based on the characters in an array.
     /// @param str string to split.
@@ -1320,8 +1798,8 @@ namespace xtd {
     /// @return An array whose elements contain the substrings in this string that are delimited by one or more characters in separators. For more information, see the Remarks section.
     /// @remarks Delimiter characters are not included in the elements of the returned array.
     /// @remarks If the specified string does not contain any of the characters in separator, or the count parameter is 1, the returned array consists of a single element that contains the specified string.
-    template<typename char_t>
-    static std::vector<std::basic_string<char_t>> split(const std::basic_string<char_t>& str, const std::vector<char_t>& separators) noexcept {return split(str, separators, std::numeric_limits<size_t>::max(), string_split_options::none);}
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::vector<char_t>& separators) noexcept {return split(str, separators, std::numeric_limits<size_t>::max(), string_split_options::none);}
     
     /// @brief Splits a specified string into substrings based on the characters in an array. You can specify whether the substrings include empty array elements.
     /// @param str string to split.
@@ -1340,8 +1818,8 @@ namespace xtd {
     ///   5. empty string, which represents the empty string that follows the "-" character at index 5.
     /// @remarks If the separator parameter contains no characters, white-space characters are assumed to be the delimiters. White-space characters are defined by the c++ standard and return true if they are passed to the std::isspace() or std::iswspace() method.
     /// @remarks If count is greater than the number of substrings, the available substrings are returned.
-    template<typename char_t>
-    static std::vector<std::basic_string<char_t>> split(const std::basic_string<char_t>& str, const std::vector<char_t>& separators, string_split_options options) noexcept {return split(str, separators, std::numeric_limits<size_t>::max(), options);}
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::vector<char_t>& separators, string_split_options options) noexcept {return split(str, separators, std::numeric_limits<size_t>::max(), options);}
     
     /// Splits a specified string into a maximum number of substrings based on the characters in an array. You also specify the maximum number of substrings to return.
     /// @param str string to split.
@@ -1352,8 +1830,8 @@ namespace xtd {
     /// @remarks If the separator parameter contains no characters, white-space characters are assumed to be the delimiters. White-space characters are defined by the Unicode standard and return true if they are passed to the char_t.IsWhiteSpace method.
     /// @remarks Each element of separator defines a separate delimiter character. If two delimiters are adjacent, or a delimiter is found at the beginning or end of the specified string, the corresponding array element contains empty string.
     /// @remarks If there are more than count substrings in the specified string, the first count minus 1 substrings are returned in the first count minus 1 elements of the return value, and the remaining characters in the specified string are returned in the last element of the return value.
-    template<typename char_t>
-    static std::vector<std::basic_string<char_t>> split(const std::basic_string<char_t>& str, const std::vector<char_t>& separators, size_t count) noexcept {return split(str, separators, count, string_split_options::none);}
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::vector<char_t>& separators, size_t count) noexcept {return split(str, separators, count, string_split_options::none);}
     
     /// @cond
     template<typename char_t>
@@ -1366,6 +1844,250 @@ namespace xtd {
     static std::vector<std::basic_string<char_t>> split(const char_t* str, const std::vector<char_t>& separators, string_split_options options) noexcept {return split(str, separators, std::numeric_limits<size_t>::max(), options);}
     template<typename char_t>
     static std::vector<std::basic_string<char_t>> split(const char_t* str, const std::vector<char_t>& separators, size_t count) noexcept {return split(str, separators, count, string_split_options::none);}
+    
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::initializer_list<char_t>& separators) noexcept {return split(str, std::vector<char_t>(separators), std::numeric_limits<size_t>::max(), string_split_options::none);}
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::initializer_list<char_t>& separators, string_split_options options) noexcept {return split(str, std::vector<char_t>(separators), std::numeric_limits<size_t>::max(), options);}
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::initializer_list<char_t>& separators, size_t count) noexcept {return split(str, std::vector<char_t>(separators), count, string_split_options::none);}
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::initializer_list<char_t>& separators, size_t count, string_split_options options) noexcept {return split(str, std::vector<char_t>(separators), count, options);}
+    template<typename char_t>
+    static std::vector<std::basic_string<char_t>> split(const char_t* str, const std::initializer_list<char_t>& separators) noexcept {return split(std::basic_string<char_t>(str), std::vector<char_t>(separators), std::numeric_limits<size_t>::max(), string_split_options::none);}
+    template<typename char_t>
+    static std::vector<std::basic_string<char_t>> split(const char_t* str, const std::initializer_list<char_t>& separators, string_split_options options) noexcept {return split(std::basic_string<char_t>(str), std::vector<char_t>(separators), std::numeric_limits<size_t>::max(), options);}
+    template<typename char_t>
+    static std::vector<std::basic_string<char_t>> split(const char_t* str, const std::initializer_list<char_t>& separators, size_t count) noexcept {return split(std::basic_string<char_t>(str), std::vector<char_t>(separators), count, string_split_options::none);}
+    template<typename char_t>
+    static std::vector<std::basic_string<char_t>> split(const char_t* str, const std::initializer_list<char_t>& separators, size_t count, string_split_options options) noexcept {return split(std::basic_string<char_t>(str), std::vector<char_t>(separators), count, options);}
+    /// @endcond
+    
+    /// @brief Splits a specified string into substrings that are based on the characters in a set.
+    /// @param str string to split.
+    /// @param separators A precompiled set of characters that delimits the substrings in this string.
+    /// @return An array whose elements contain the substrings in this string that are delimited by one or more characters in separators.
+    /// @remarks Use this overload to split many strings on the same characters: the set is built once and scanned with xtd::char_set::find_first.
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::char_set<char_t>& separators) noexcept {return split(str, separators, std::numeric_limits<size_t>::max(), string_split_options::none);}
+    
+    /// @brief Splits a specified string into substrings based on the characters in a set. You can specify whether the substrings include empty array elements.
+    /// @param str string to split.
+    /// @param separators A precompiled set of characters that delimits the substrings in this string.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty array elements from the array returned; or None to include empty array elements in the array returned.
+    /// @return An array whose elements contain the substrings in this string that are delimited by one or more characters in separators.
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::char_set<char_t>& separators, string_split_options options) noexcept {return split(str, separators, std::numeric_limits<size_t>::max(), options);}
+    
+    /// @brief Splits a specified string into a maximum number of substrings based on the characters in a set.
+    /// @param str string to split.
+    /// @param separators A precompiled set of characters that delimits the substrings in this string.
+    /// @param count The maximum number of substrings to return.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty array elements from the array returned; or None to include empty array elements in the array returned.
+    /// @return An array whose elements contain the substrings in this string that are delimited by one or more characters in separators.
+    /// @remarks If there are more than count substrings in the specified string, the first count minus 1 substrings are returned in the first count minus 1 elements of the return value, and the remaining characters in the specified string are returned in the last element of the return value.
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::char_set<char_t>& separators, size_t count, string_split_options options) noexcept {
+      __string_vector<char_t, allocator_t> list(str.get_allocator());
+      for (auto token : xtd::split_view<char_t, xtd::char_set<char_t>>(str, separators, count, options))
+        list.emplace_back(token);
+      return list;
+    }
+    
+    /// @cond
+    template<typename char_t>
+    static std::vector<std::basic_string<char_t>> split(const char_t* str, const xtd::char_set<char_t>& separators) noexcept {return split(std::basic_string<char_t>(str), separators, std::numeric_limits<size_t>::max(), string_split_options::none);}
+    template<typename char_t>
+    static std::vector<std::basic_string<char_t>> split(const char_t* str, const xtd::char_set<char_t>& separators, string_split_options options) noexcept {return split(std::basic_string<char_t>(str), separators, std::numeric_limits<size_t>::max(), options);}
+    template<typename char_t>
+    static std::vector<std::basic_string<char_t>> split(const char_t* str, const xtd::char_set<char_t>& separators, size_t count, string_split_options options) noexcept {return split(std::basic_string<char_t>(str), separators, count, options);}
+    /// @endcond
+    
+    /// @brief Splits a specified string into substrings that are delimited by a preprocessed substring.
+    /// @param str string to split.
+    /// @param separator The preprocessed substring that delimits the substrings in this string.
+    /// @return An array whose elements contain the substrings in this string that are delimited by separator.
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::searcher<char_t>& separator) noexcept {return split(str, separator, std::numeric_limits<size_t>::max(), string_split_options::none);}
+    
+    /// @brief Splits a specified string into substrings that are delimited by a preprocessed substring. You can specify whether the substrings include empty array elements.
+    /// @param str string to split.
+    /// @param separator The preprocessed substring that delimits the substrings in this string.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty array elements from the array returned; or None to include empty array elements in the array returned.
+    /// @return An array whose elements contain the substrings in this string that are delimited by separator.
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::searcher<char_t>& separator, string_split_options options) noexcept {return split(str, separator, std::numeric_limits<size_t>::max(), options);}
+    
+    /// @brief Splits a specified string into a maximum number of substrings that are delimited by a preprocessed substring.
+    /// @param str string to split.
+    /// @param separator The preprocessed substring that delimits the substrings in this string.
+    /// @param count The maximum number of substrings to return.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty array elements from the array returned; or None to include empty array elements in the array returned.
+    /// @return An array whose elements contain the substrings in this string that are delimited by separator.
+    /// @remarks If separator is empty, the returned array consists of a single element that contains the specified string.
+    /// @remarks If there are more than count substrings in the specified string, the first count minus 1 substrings are returned in the first count minus 1 elements of the return value, and the remaining characters in the specified string are returned in the last element of the return value.
+    template<typename char_t, typename allocator_t>
+    static __string_vector<char_t, allocator_t> split(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::searcher<char_t>& separator, size_t count, string_split_options options) noexcept {
+      __string_vector<char_t, allocator_t> list(str.get_allocator());
+      for (auto token : xtd::split_view<char_t, xtd::searcher<char_t>>(str, separator, count, options))
+        list.emplace_back(token);
+      return list;
+    }
+    
+    /// @cond
+    template<typename char_t>
+    static std::vector<std::basic_string<char_t>> split(const char_t* str, const xtd::searcher<char_t>& separator) noexcept {return split(std::basic_string<char_t>(str), separator, std::numeric_limits<size_t>::max(), string_split_options::none);}
+    template<typename char_t>
+    static std::vector<std::basic_string<char_t>> split(const char_t* str, const xtd::searcher<char_t>& separator, string_split_options options) noexcept {return split(std::basic_string<char_t>(str), separator, std::numeric_limits<size_t>::max(), options);}
+    template<typename char_t>
+    static std::vector<std::basic_string<char_t>> split(const char_t* str, const xtd::searcher<char_t>& separator, size_t count, string_split_options options) noexcept {return split(std::basic_string<char_t>(str), separator, count, options);}
+    /// @endcond
+    
+    /// @brief Splits a specified string lazily into substrings that are delimited by white-space characters.
+    /// @param str string to split.
+    /// @return A range of std::basic_string_view that refer to the substrings of str; the substrings are found while the range is iterated, and nothing is allocated.
+    /// @remarks The substrings are the elements of the array returned by split(str). str must outlive the returned range.
+    template<typename char_t>
+    static xtd::split_view<char_t, xtd::char_set<char_t>> split_view(const std::basic_string<char_t>& str) noexcept {return split_view(std::basic_string_view<char_t>(str));}
+    
+    /// @brief Splits a specified string lazily into substrings that are delimited by a separator.
+    /// @param str string to split.
+    /// @param separator A character, a string, an xtd::char_set or an xtd::searcher that delimits the substrings in this string.
+    /// @return A range of std::basic_string_view that refer to the substrings of str; the substrings are found while the range is iterated, and nothing is allocated.
+    /// @remarks str, and separator when it is an xtd::char_set or an xtd::searcher, must outlive the returned range.
+    /// @par Examples
+    /// @code
+    /// for (std::string_view field : xtd::strings::split_view(line, ' ', xtd::string_split_options::remove_empty_entries))
+    ///   fields.push_back(field);
+    /// @endcode
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(const std::basic_string<char_t>& str, const separator_t& separator) noexcept {return split_view(std::basic_string_view<char_t>(str), separator);}
+    
+    /// @brief Splits a specified string lazily into substrings that are delimited by a separator. You can specify whether the substrings include empty elements.
+    /// @param str string to split.
+    /// @param separator A character, a string, an xtd::char_set or an xtd::searcher that delimits the substrings in this string.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty substrings; or None to include them.
+    /// @return A range of std::basic_string_view that refer to the substrings of str; the substrings are found while the range is iterated, and nothing is allocated.
+    /// @remarks str, and separator when it is an xtd::char_set or an xtd::searcher, must outlive the returned range.
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(const std::basic_string<char_t>& str, const separator_t& separator, string_split_options options) noexcept {return split_view(std::basic_string_view<char_t>(str), separator, options);}
+    
+    /// @brief Splits a specified string lazily into a maximum number of substrings that are delimited by a separator.
+    /// @param str string to split.
+    /// @param separator A character, a string, an xtd::char_set or an xtd::searcher that delimits the substrings in this string.
+    /// @param count The maximum number of substrings to return.
+    /// @return A range of std::basic_string_view that refer to the substrings of str; the substrings are found while the range is iterated, and nothing is allocated.
+    /// @remarks If there are more than count substrings, the last one contains the remaining characters of str.
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(const std::basic_string<char_t>& str, const separator_t& separator, size_t count) noexcept {return split_view(std::basic_string_view<char_t>(str), separator, count);}
+    
+    /// @brief Splits a specified string lazily into a maximum number of substrings that are delimited by a separator. You can specify whether the substrings include empty elements.
+    /// @param str string to split.
+    /// @param separator A character, a string, an xtd::char_set or an xtd::searcher that delimits the substrings in this string.
+    /// @param count The maximum number of substrings to return.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty substrings; or None to include them.
+    /// @return A range of std::basic_string_view that refer to the substrings of str; the substrings are found while the range is iterated, and nothing is allocated.
+    /// @remarks If there are more than count substrings, the last one contains the remaining characters of str.
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(const std::basic_string<char_t>& str, const separator_t& separator, size_t count, string_split_options options) noexcept {return split_view(std::basic_string_view<char_t>(str), separator, count, options);}
+    
+    /// @cond
+    template<typename char_t, typename ...args_t>
+    static void split_view(std::basic_string<char_t>&& str, args_t&& ...args) = delete;
+    template<typename char_t>
+    static xtd::split_view<char_t, xtd::char_set<char_t>> split_view(const char_t* str) noexcept {return split_view(std::basic_string_view<char_t>(str));}
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(const char_t* str, const separator_t& separator) noexcept {return split_view(std::basic_string_view<char_t>(str), separator);}
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(const char_t* str, const separator_t& separator, string_split_options options) noexcept {return split_view(std::basic_string_view<char_t>(str), separator, options);}
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(const char_t* str, const separator_t& separator, size_t count) noexcept {return split_view(std::basic_string_view<char_t>(str), separator, count);}
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(const char_t* str, const separator_t& separator, size_t count, string_split_options options) noexcept {return split_view(std::basic_string_view<char_t>(str), separator, count, options);}
+    template<typename char_t>
+    static xtd::split_view<char_t, xtd::char_set<char_t>> split_view(std::basic_string_view<char_t> str) noexcept {return xtd::split_view<char_t, xtd::char_set<char_t>>(str, xtd::char_set<char_t>::white_spaces());}
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(std::basic_string_view<char_t> str, const separator_t& separator) noexcept {return split_view(str, separator, std::numeric_limits<size_t>::max(), string_split_options::none);}
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(std::basic_string_view<char_t> str, const separator_t& separator, string_split_options options) noexcept {return split_view(str, separator, std::numeric_limits<size_t>::max(), options);}
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(std::basic_string_view<char_t> str, const separator_t& separator, size_t count) noexcept {return split_view(str, separator, count, string_split_options::none);}
+    template<typename char_t, typename separator_t>
+    static xtd::split_view<char_t, typename __split_view_separator<char_t, separator_t>::type> split_view(std::basic_string_view<char_t> str, const separator_t& separator, size_t count, string_split_options options) noexcept {
+      using view_separator_t = typename __split_view_separator<char_t, separator_t>::type;
+      if constexpr (std::is_same<view_separator_t, separator_t>::value) return xtd::split_view<char_t, view_separator_t>(str, separator, count, options);
+      else return xtd::split_view<char_t, view_separator_t>(str, view_separator_t(separator), count, options);
+    }
+    /// @endcond
+    
+    /// @brief Splits a specified string into substrings that are delimited by white-space characters, and stores them in the specified container.
+    /// @param str string to split.
+    /// @param result The container that receives the substrings; its previous content is replaced.
+    /// @return The number of substrings stored in result.
+    /// @remarks result is a sequence container of std::basic_string, with any allocator such as std::pmr::polymorphic_allocator, or of std::basic_string_view that then refer to str. Its existing elements are assigned the new substrings, so that their capacity is reused, and the remaining elements are erased: splitting records one after another into the same container does not allocate once the container has grown.
+    template<typename char_t, typename container_t>
+    static size_t split_into(const std::basic_string<char_t>& str, container_t& result) {return split_into(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces(), std::numeric_limits<size_t>::max(), string_split_options::none, result);}
+    
+    /// @brief Splits a specified string into substrings that are delimited by a separator, and stores them in the specified container.
+    /// @param str string to split.
+    /// @param separator A character, a string, a std::vector of characters, an xtd::char_set or an xtd::searcher that delimits the substrings in this string.
+    /// @param result The container that receives the substrings; its previous content is replaced.
+    /// @return The number of substrings stored in result.
+    /// @remarks See split_into(const std::basic_string<char_t>&, container_t&) for the requirements on result.
+    template<typename char_t, typename separator_t, typename container_t>
+    static size_t split_into(const std::basic_string<char_t>& str, const separator_t& separator, container_t& result) {return split_into(std::basic_string_view<char_t>(str), separator, std::numeric_limits<size_t>::max(), string_split_options::none, result);}
+    
+    /// @brief Splits a specified string into substrings that are delimited by a separator, and stores them in the specified container. You can specify whether the substrings include empty elements.
+    /// @param str string to split.
+    /// @param separator A character, a string, a std::vector of characters, an xtd::char_set or an xtd::searcher that delimits the substrings in this string.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty substrings; or None to include them.
+    /// @param result The container that receives the substrings; its previous content is replaced.
+    /// @return The number of substrings stored in result.
+    /// @remarks See split_into(const std::basic_string<char_t>&, container_t&) for the requirements on result.
+    template<typename char_t, typename separator_t, typename container_t>
+    static size_t split_into(const std::basic_string<char_t>& str, const separator_t& separator, string_split_options options, container_t& result) {return split_into(std::basic_string_view<char_t>(str), separator, std::numeric_limits<size_t>::max(), options, result);}
+    
+    /// @brief Splits a specified string into a maximum number of substrings that are delimited by a separator, and stores them in the specified container. You can specify whether the substrings include empty elements.
+    /// @param str string to split.
+    /// @param separator A character, a string, a std::vector of characters, an xtd::char_set or an xtd::searcher that delimits the substrings in this string.
+    /// @param count The maximum number of substrings to return.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty substrings; or None to include them.
+    /// @param result The container that receives the substrings; its previous content is replaced.
+    /// @return The number of substrings stored in result.
+    /// @remarks The substrings are the elements of the array returned by the corresponding split overload. See split_into(const std::basic_string<char_t>&, container_t&) for the requirements on result.
+    template<typename char_t, typename separator_t, typename container_t>
+    static size_t split_into(const std::basic_string<char_t>& str, const separator_t& separator, size_t count, string_split_options options, container_t& result) {return split_into(std::basic_string_view<char_t>(str), separator, count, options, result);}
+    
+    /// @cond
+    template<typename char_t, typename container_t>
+    static size_t split_into(const char_t* str, container_t& result) {return split_into(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces(), std::numeric_limits<size_t>::max(), string_split_options::none, result);}
+    template<typename char_t, typename separator_t, typename container_t>
+    static size_t split_into(const char_t* str, const separator_t& separator, container_t& result) {return split_into(std::basic_string_view<char_t>(str), separator, std::numeric_limits<size_t>::max(), string_split_options::none, result);}
+    template<typename char_t, typename separator_t, typename container_t>
+    static size_t split_into(const char_t* str, const separator_t& separator, string_split_options options, container_t& result) {return split_into(std::basic_string_view<char_t>(str), separator, std::numeric_limits<size_t>::max(), options, result);}
+    template<typename char_t, typename separator_t, typename container_t>
+    static size_t split_into(const char_t* str, const separator_t& separator, size_t count, string_split_options options, container_t& result) {return split_into(std::basic_string_view<char_t>(str), separator, count, options, result);}
+    template<typename char_t, typename container_t>
+    static size_t split_into(std::basic_string_view<char_t> str, container_t& result) {return split_into(str, xtd::char_set<char_t>::white_spaces(), std::numeric_limits<size_t>::max(), string_split_options::none, result);}
+    template<typename char_t, typename separator_t, typename container_t>
+    static size_t split_into(std::basic_string_view<char_t> str, const separator_t& separator, container_t& result) {return split_into(str, separator, std::numeric_limits<size_t>::max(), string_split_options::none, result);}
+    template<typename char_t, typename separator_t, typename container_t>
+    static size_t split_into(std::basic_string_view<char_t> str, const separator_t& separator, string_split_options options, container_t& result) {return split_into(str, separator, std::numeric_limits<size_t>::max(), options, result);}
+    template<typename char_t, typename separator_t, typename container_t>
+    static size_t split_into(std::basic_string_view<char_t> str, const separator_t& separator, size_t count, string_split_options options, container_t& result) {
+      if constexpr (std::is_same<separator_t, std::vector<char_t>>::value) return split_into(str, separator.empty() ? xtd::char_set<char_t>::white_spaces() : xtd::char_set<char_t>(separator), count, options, result);
+      else {
+        // Elements already in result are assigned in place; new elements are appended only past its former size, so element stays valid.
+        size_t former_size = result.size(), size = 0;
+        auto element = result.begin();
+        for (auto token : split_view(str, separator, count, options)) {
+          if (size++ < former_size) *element++ = token;
+          else result.emplace_back(token);
+        }
+        if (size < former_size) result.erase(element, result.end());
+        return size;
+      }
+    }
     /// @endcond
     
     /// @brief Determines whether the beginning of an instance of String matches a specified String.
@@ -1374,7 +2096,7 @@ namespace xtd {
     /// @return bool true if value matches the beginning of the specified string; otherwise, false.
     /// @remarks This method compares value to the substring at the beginning of the specified string that is the same length as value, and returns an indication whether they are equal. To be equal, value must be a reference to this same instance, or match the beginning of the specified string.
     template<typename char_t>
-    static bool starts_with(const std::basic_string<char_t>& str, char_t value) noexcept {return starts_with(str, value, false);}
+    static bool starts_with(const std::basic_string<char_t>& str, char_t value) noexcept {return starts_with(std::basic_string_view<char_t>(str), value, false);}
     
     /// @brief Determines whether the beginning of an instance of String matches a specified String, ignoring or honoring their case.
     /// @param str string beginning with value.
@@ -1383,11 +2105,7 @@ namespace xtd {
     /// @return bool true if value matches the beginning of the specified string; otherwise, false.
     /// @remarks This method compares value to the substring at the beginning of the specified string that is the same length as value, and returns an indication whether they are equal. To be equal, value must be a reference to this same instance, or match the beginning of the specified string.
     template<typename char_t>
-    static bool starts_with(const std::basic_string<char_t>& str, char_t value, bool ignore_case) noexcept {
-      if (ignore_case)
-        return to_lower(str).find(tolower(value)) == 0;
-      return str.find(value) == 0;
-    }
+    static bool starts_with(const std::basic_string<char_t>& str, char_t value, bool ignore_case) noexcept {return starts_with(std::basic_string_view<char_t>(str), value, ignore_case);}
     
     /// @brief Determines whether the beginning of an instance of String matches a specified String.
     /// @param str string beginning with value.
@@ -1395,7 +2113,7 @@ namespace xtd {
     /// @return bool true if value matches the beginning of the specified string; otherwise, false.
     /// @remarks This method compares value to the substring at the beginning of the specified string that is the same length as value, and returns an indication whether they are equal. To be equal, value must be a reference to this same instance, or match the beginning of the specified string.
     template<typename char_t>
-    static bool starts_with(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value) noexcept {return starts_with(str, value, false);}
+    static bool starts_with(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value) noexcept {return starts_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), false);}
     
     /// @brief Determines whether the beginning of an instance of String matches a specified String, ignoring or honoring their case.
     /// @param str string beginning with value.
@@ -1404,30 +2122,89 @@ namespace xtd {
     /// @return bool true if value matches the beginning of the specified string; otherwise, false.
     /// @remarks This method compares value to the substring at the beginning of the specified string that is the same length as value, and returns an indication whether they are equal. To be equal, value must be a reference to this same instance, or match the beginning of the specified string.
     template<typename char_t>
-    static bool starts_with(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, bool ignore_case) noexcept {
-      if (ignore_case)
-        return to_lower(str).find(to_lower(value)) == 0;
-      return str.find(value) == 0;
-    }
+    static bool starts_with(const std::basic_string<char_t>& str, const std::basic_string<char_t>& value, bool ignore_case) noexcept {return starts_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), ignore_case);}
+    
+    /// @cond
+    template<typename char_t>
+    static bool starts_with(const char_t* str, char_t value) noexcept {return starts_with(std::basic_string_view<char_t>(str), value, false);}
+    template<typename char_t>
+    static bool starts_with(const char_t* str, char_t value, bool ignore_case) noexcept {return starts_with(std::basic_string_view<char_t>(str), value, ignore_case);}
+    template<typename char_t>
+    static bool starts_with(const std::basic_string<char_t>& str, const char_t* value) noexcept {return starts_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), false);}
+    template<typename char_t>
+    static bool starts_with(const char_t* str, const std::basic_string<char_t>& value) noexcept {return starts_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), false);}
+    template<typename char_t>
+    static bool starts_with(const char_t* str, const char_t* value) noexcept {return starts_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), false);}
+    
+    template<typename char_t>
+    static bool starts_with(const std::basic_string<char_t>& str, const char_t* value, bool ignore_case) noexcept {return starts_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), ignore_case);}
+    template<typename char_t>
+    static bool starts_with(const char_t* str, const std::basic_string<char_t>& value, bool ignore_case) noexcept {return starts_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), ignore_case);}
+    template<typename char_t>
+    static bool starts_with(const char_t* str, const char_t* value, bool ignore_case) noexcept {return starts_with(std::basic_string_view<char_t>(str), std::basic_string_view<char_t>(value), ignore_case);}
+    /// @endcond
     
     /// @cond
     template<typename char_t>
-    static bool starts_with(const char_t* str, char_t value) noexcept {return starts_with(std::basic_string<char_t>(str), value, false);}
+    static bool starts_with(std::basic_string_view<char_t> str, char_t value) noexcept {return starts_with(str, value, false);}
+    template<typename char_t>
+    static bool starts_with(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value) noexcept {return starts_with(str, value, false);}
+    template<typename char_t>
+    static bool starts_with(std::basic_string_view<char_t> str, char_t value, bool ignore_case) noexcept {
+      if (str.empty()) return false;
+      return ignore_case ? __fold_case_char(str[0]) == __fold_case_char(value) : str[0] == value;
+    }
+    template<typename char_t>
+    static bool starts_with(std::basic_string_view<char_t> str, std::basic_string_view<char_t> value, bool ignore_case) noexcept {
+      if (value.size() > str.size()) return false;
+      return equals(str.substr(0, value.size()), value, ignore_case);
+    }
+    /// @endcond
+    
+    /// @brief Determines whether the beginning of the specified string matches any of the specified prefixes.
+    /// @param str The string to match.
+    /// @param values The prefixes to compare to the beginning of str.
+    /// @return true if at least one of values matches the beginning of str; otherwise, false.
+    /// @remarks Each prefix is compared with a bounded comparison; for hundreds of prefixes use the xtd::prefix_trie overload.
+    template<typename char_t>
+    static bool starts_with_any(const std::basic_string<char_t>& str, const std::vector<std::basic_string<char_t>>& values) noexcept {return starts_with_any(std::basic_string_view<char_t>(str), values, false);}
+    
+    /// @brief Determines whether the beginning of the specified string matches any of the specified prefixes, ignoring or honoring their case.
+    /// @param str The string to match.
+    /// @param values The prefixes to compare to the beginning of str.
+    /// @param ignore_case true to ignore case during the comparison; otherwise, false.
+    /// @return true if at least one of values matches the beginning of str; otherwise, false.
+    template<typename char_t>
+    static bool starts_with_any(const std::basic_string<char_t>& str, const std::vector<std::basic_string<char_t>>& values, bool ignore_case) noexcept {return starts_with_any(std::basic_string_view<char_t>(str), values, ignore_case);}
+    
+    /// @brief Determines whether the beginning of the specified string matches any of the prefixes of the specified xtd::prefix_trie.
+    /// @param str The string to match.
+    /// @param values The precompiled prefixes to compare to the beginning of str.
+    /// @return true if at least one of values matches the beginning of str; otherwise, false.
+    /// @remarks The string is read once, in a time that does not depend on the number of prefixes.
     template<typename char_t>
-    static bool starts_with(const char_t* str, char_t value, bool ignore_case) noexcept {return starts_with(std::basic_string<char_t>(str), value, ignore_case);}
+    static bool starts_with_any(const std::basic_string<char_t>& str, const xtd::prefix_trie<char_t>& values) noexcept {return values.matches(str);}
+    
+    /// @cond
     template<typename char_t>
-    static bool starts_with(const std::basic_string<char_t>& str, const char_t* value) noexcept {return starts_with(str, std::basic_string<char_t>(value), false);}
+    static bool starts_with_any(const char_t* str, const std::vector<std::basic_string<char_t>>& values) noexcept {return starts_with_any(std::basic_string_view<char_t>(str), values, false);}
     template<typename char_t>
-    static bool starts_with(const char_t* str, const std::basic_string<char_t>& value) noexcept {return starts_with(std::basic_string<char_t>(str), value, false);}
+    static bool starts_with_any(const char_t* str, const std::vector<std::basic_string<char_t>>& values, bool ignore_case) noexcept {return starts_with_any(std::basic_string_view<char_t>(str), values, ignore_case);}
     template<typename char_t>
-    static bool starts_with(const char_t* str, const char_t* value) noexcept {return starts_with(std::basic_string<char_t>(str), std::basic_string<char_t>(value), false);}
+    static bool starts_with_any(const char_t* str, const xtd::prefix_trie<char_t>& values) noexcept {return values.matches(str);}
+    /// @endcond
     
+    /// @cond
     template<typename char_t>
-    static bool starts_with(const std::basic_string<char_t>& str, const char_t* value, bool ignore_case) noexcept {return starts_with(str, std::basic_string<char_t>(value), ignore_case);}
+    static bool starts_with_any(std::basic_string_view<char_t> str, const std::vector<std::basic_string<char_t>>& values) noexcept {return starts_with_any(str, values, false);}
     template<typename char_t>
-    static bool starts_with(const char_t* str, const std::basic_string<char_t>& value, bool ignore_case) noexcept {return starts_with(std::basic_string<char_t>(str), value, ignore_case);}
+    static bool starts_with_any(std::basic_string_view<char_t> str, const std::vector<std::basic_string<char_t>>& values, bool ignore_case) noexcept {
+      for (const auto& value : values)
+        if (starts_with(str, std::basic_string_view<char_t>(value), ignore_case)) return true;
+      return false;
+    }
     template<typename char_t>
-    static bool starts_with(const char_t* str, const char_t* value, bool ignore_case) noexcept {return starts_with(std::basic_string<char_t>(str), std::basic_string<char_t>(value), ignore_case);}
+    static bool starts_with_any(std::basic_string_view<char_t> str, const xtd::prefix_trie<char_t>& values) noexcept {return values.matches(str);}
     /// @endcond
     
     /// @brief Retrieves a substring from this instance. The substring starts at a specified character position and has a specified length.
@@ -1496,161 +2273,375 @@ namespace xtd {
     /// @brief Returns a copy of the specified string converted to lowercase.
     /// @param str string to convert to lower.
     /// @return String A new String in lowercase.
-    template<typename char_t>
-    static const std::basic_string<char_t> to_lower(const std::basic_string<char_t>& str) noexcept {
-      std::basic_string<char_t> result;
-      for(char c : str) result.push_back(tolower(c));
+    /// @remarks A char string is converted as ASCII; use the overload with a std::locale to convert other letters. Wider strings are converted as UTF-16 or UTF-32 with the Unicode simple case mappings, independently of any locale.
+    template<typename char_t, typename allocator_t>
+    static const std::basic_string<char_t, std::char_traits<char_t>, allocator_t> to_lower(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str) noexcept {
+      std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(str, str.get_allocator());
+      __to_lower_in_place(result.data(), result.size());
       return result;
     }
     
-    /// @cond
-    static const std::basic_string<char16_t> to_lower(const std::basic_string<char16_t>& str) noexcept {
-      std::basic_string<char16_t> result;
-      for(char16_t c : str) result.push_back(c <= 0xFF ? static_cast<char16_t>(tolower(static_cast<char>(c))) : c);
-      return result;
+    /// @brief Converts the specified string to lowercase in place.
+    /// @param str string to convert to lower.
+    /// @return String The buffer of str, in lowercase.
+    /// @remarks A char string is converted as ASCII; use the overload with a std::locale to convert other letters. Wider strings are converted as UTF-16 or UTF-32 with the Unicode simple case mappings, independently of any locale.
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> to_lower(std::basic_string<char_t, std::char_traits<char_t>, allocator_t>&& str) noexcept {
+      __to_lower_in_place(str.data(), str.size());
+      return std::move(str);
     }
     
-    static const std::basic_string<char32_t> to_lower(const std::basic_string<char32_t>& str) noexcept {
-      std::basic_string<char32_t> result;
-      for(char32_t c : str) result.push_back(c <= 0xFF ? static_cast<char32_t>(tolower(static_cast<char>(c))) : c);
-      return result;
+    /// @brief Returns a copy of the specified string converted to lowercase with the casing rules of the specified locale.
+    /// @param str string to convert to lower.
+    /// @param locale The locale whose std::ctype facet converts the characters.
+    /// @return String A new String in lowercase.
+    template<typename char_t, typename allocator_t>
+    static const std::basic_string<char_t, std::char_traits<char_t>, allocator_t> to_lower(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::locale& locale) {return to_lower(std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(str, str.get_allocator()), locale);}
+    
+    /// @brief Converts the specified string to lowercase in place with the casing rules of the specified locale.
+    /// @param str string to convert to lower.
+    /// @param locale The locale whose std::ctype facet converts the characters.
+    /// @return String The buffer of str, in lowercase.
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> to_lower(std::basic_string<char_t, std::char_traits<char_t>, allocator_t>&& str, const std::locale& locale) {
+      std::use_facet<std::ctype<char_t>>(locale).tolower(str.data(), str.data() + str.size());
+      return std::move(str);
     }
     
+    /// @cond
     template<typename char_t>
     static const std::basic_string<char_t> to_lower(const char_t* str) noexcept {return to_lower(std::basic_string<char_t>(str));}
+    template<typename char_t>
+    static const std::basic_string<char_t> to_lower(const char_t* str, const std::locale& locale) {return to_lower(std::basic_string<char_t>(str), locale);}
     /// @endcond
     
     /// @brief Returns a copy of the specified string converted to uppercase.
     /// @param str string to convert to upper.
     /// @return String A new String in uppercase.
-    template<typename char_t>
-    static const std::basic_string<char_t> to_upper(const std::basic_string<char_t>& str) noexcept {
-      std::basic_string<char_t> result;
-      for(char c : str) result.push_back(toupper(c));
+    /// @remarks A char string is converted as ASCII; use the overload with a std::locale to convert other letters. Wider strings are converted as UTF-16 or UTF-32 with the Unicode simple case mappings, independently of any locale.
+    template<typename char_t, typename allocator_t>
+    static const std::basic_string<char_t, std::char_traits<char_t>, allocator_t> to_upper(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str) noexcept {
+      std::basic_string<char_t, std::char_traits<char_t>, allocator_t> result(str, str.get_allocator());
+      __to_upper_in_place(result.data(), result.size());
       return result;
     }
     
-    /// @cond
-    static const std::basic_string<char16_t> to_upper(const std::basic_string<char16_t>& str) noexcept {
-      std::basic_string<char16_t> result;
-      for(char16_t c : str) result.push_back(c <= 0xFF ? static_cast<char16_t>(toupper(static_cast<char>(c))) : c);
-      return result;
+    /// @brief Converts the specified string to uppercase in place.
+    /// @param str string to convert to upper.
+    /// @return String The buffer of str, in uppercase.
+    /// @remarks A char string is converted as ASCII; use the overload with a std::locale to convert other letters. Wider strings are converted as UTF-16 or UTF-32 with the Unicode simple case mappings, independently of any locale.
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> to_upper(std::basic_string<char_t, std::char_traits<char_t>, allocator_t>&& str) noexcept {
+      __to_upper_in_place(str.data(), str.size());
+      return std::move(str);
     }
     
-    static const std::basic_string<char32_t> to_upper(const std::basic_string<char32_t>& str) noexcept {
-      std::basic_string<char32_t> result;
-      for(char32_t c : str) result.push_back(c <= 0xFF ? static_cast<char32_t>(toupper(static_cast<char>(c))) : c);
-      return result;
+    /// @brief Returns a copy of the specified string converted to uppercase with the casing rules of the specified locale.
+    /// @param str string to convert to upper.
+    /// @param locale The locale whose std::ctype facet converts the characters.
+    /// @return String A new String in uppercase.
+    template<typename char_t, typename allocator_t>
+    static const std::basic_string<char_t, std::char_traits<char_t>, allocator_t> to_upper(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::locale& locale) {return to_upper(std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(str, str.get_allocator()), locale);}
+    
+    /// @brief Converts the specified string to uppercase in place with the casing rules of the specified locale.
+    /// @param str string to convert to upper.
+    /// @param locale The locale whose std::ctype facet converts the characters.
+    /// @return String The buffer of str, in uppercase.
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> to_upper(std::basic_string<char_t, std::char_traits<char_t>, allocator_t>&& str, const std::locale& locale) {
+      std::use_facet<std::ctype<char_t>>(locale).toupper(str.data(), str.data() + str.size());
+      return std::move(str);
     }
     
+    /// @cond
     template<typename char_t>
     static const std::basic_string<char_t> to_upper(const char_t* str) noexcept {return to_upper(std::basic_string<char_t>(str));}
+    template<typename char_t>
+    static const std::basic_string<char_t> to_upper(const char_t* str, const std::locale& locale) {return to_upper(std::basic_string<char_t>(str), locale);}
     /// @endcond
     
     /// @brief Removes all leading and trailing occurrences of white-space characters from the specifed String.
     /// @param str String to trim end.
     /// @param trim_char A character to remove.
     /// @return The String that remains after all occurrences of the character in the trim_char parameter are removed from the start and te and of the specified String.
-    template<typename char_t>
-    static std::basic_string<char_t> trim(const std::basic_string<char_t>& str) noexcept {return trim(str, std::vector<char_t> {9, 10, 11, 12, 13, 32});}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str) noexcept {return trim(str, xtd::char_set<char_t>::white_spaces());}
     
     /// @brief Removes all eading and trailing occurrences of a character specified from the specifed String .
     /// @param str String to trim start.
     /// @param trim_char A character to remove.
     /// @return The String that remains after all occurrences of the character in the trim_char parameter are removed from the start and the end of the specofoed String.
-    template<typename char_t>
-    static std::basic_string<char_t> trim(const std::basic_string<char_t>& str, char_t trim_char) noexcept {return trim(str, std::vector<char_t> {trim_char});}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, char_t trim_char) noexcept {return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(trim_view(std::basic_string_view<char_t>(str), trim_char), str.get_allocator());}
     
     /// @brief Removes all eading and trailing occurrences of a set of characters specified in an array from the specified String.
     /// @param str String to trim end.
     /// @param trim_chars An array of characters to remove.
     /// @return The String that remains after all occurrences of the characters in the trim_chars parameter are removed from the start and the edn of the specified String.
-    template<typename char_t>
-    static std::basic_string<char_t> trim(const std::basic_string<char_t>& str, const std::vector<char_t>& trim_chars) noexcept {return trim_end(trim_start(str, trim_chars), trim_chars);}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::vector<char_t>& trim_chars) noexcept {return trim(str, xtd::char_set<char_t>(trim_chars));}
+    
+    /// @brief Removes all leading and trailing occurrences of a set of characters from the specified String.
+    /// @param str String to trim.
+    /// @param trim_chars A precompiled set of characters to remove.
+    /// @return The String that remains after all occurrences of the characters in the trim_chars parameter are removed from the start and the end of the specified String.
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::char_set<char_t>& trim_chars) noexcept {return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(trim_view(std::basic_string_view<char_t>(str), trim_chars), str.get_allocator());}
     
     /// @cond
     template<typename char_t>
-    static std::basic_string<char_t> trim(const char_t* str) noexcept {return trim(std::basic_string<char_t>(str), std::vector<char_t> {9, 10, 11, 12, 13, 32});}
+    static std::basic_string<char_t> trim(const char_t* str) noexcept {return std::basic_string<char_t>(trim_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces()));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim(const char_t* str, char_t trim_char) noexcept {return std::basic_string<char_t>(trim_view(std::basic_string_view<char_t>(str), trim_char));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim(const char_t* str, const std::vector<char_t>& trim_chars) noexcept {return std::basic_string<char_t>(trim_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>(trim_chars)));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim(const char_t* str, const xtd::char_set<char_t>& trim_chars) noexcept {return std::basic_string<char_t>(trim_view(std::basic_string_view<char_t>(str), trim_chars));}
+    
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::initializer_list<char_t>& trim_chars) noexcept {return trim(str, xtd::char_set<char_t>(trim_chars));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim(const char_t* str, const std::initializer_list<char_t>& trim_chars) noexcept {return std::basic_string<char_t>(trim_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>(trim_chars)));}
+    /// @endcond
     
+    /// @brief Removes all leading and trailing white-space characters from the specified String without copying it.
+    /// @param str String to trim.
+    /// @return A view of the part of str that remains after all white-space characters are removed from the start and the end of it.
+    /// @remarks str must outlive the returned view.
     template<typename char_t>
-    static std::basic_string<char_t> trim(const char_t* str, char_t trim_char) noexcept {return trim(std::basic_string<char_t>(str), std::vector<char_t> {trim_char});}
+    static std::basic_string_view<char_t> trim_view(const std::basic_string<char_t>& str) noexcept {return trim_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces());}
     
+    /// @brief Removes all leading and trailing occurrences of a character from the specified String without copying it.
+    /// @param str String to trim.
+    /// @param trim_char A character to remove.
+    /// @return A view of the part of str that remains after all occurrences of trim_char are removed from the start and the end of it.
+    /// @remarks str must outlive the returned view.
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_view(const std::basic_string<char_t>& str, char_t trim_char) noexcept {return trim_view(std::basic_string_view<char_t>(str), trim_char);}
+    
+    /// @brief Removes all leading and trailing occurrences of a set of characters from the specified String without copying it.
+    /// @param str String to trim.
+    /// @param trim_chars A precompiled set of characters to remove.
+    /// @return A view of the part of str that remains after all occurrences of the characters in trim_chars are removed from the start and the end of it.
+    /// @remarks str must outlive the returned view.
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_view(const std::basic_string<char_t>& str, const xtd::char_set<char_t>& trim_chars) noexcept {return trim_view(std::basic_string_view<char_t>(str), trim_chars);}
+    
+    /// @cond
+    template<typename char_t, typename ...args_t>
+    static void trim_view(std::basic_string<char_t>&& str, args_t&& ...args) = delete;
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_view(const char_t* str) noexcept {return trim_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces());}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_view(const char_t* str, char_t trim_char) noexcept {return trim_view(std::basic_string_view<char_t>(str), trim_char);}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_view(const char_t* str, const xtd::char_set<char_t>& trim_chars) noexcept {return trim_view(std::basic_string_view<char_t>(str), trim_chars);}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_view(std::basic_string_view<char_t> str) noexcept {return trim_view(str, xtd::char_set<char_t>::white_spaces());}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_view(std::basic_string_view<char_t> str, char_t trim_char) noexcept {
+      size_t first = str.find_first_not_of(trim_char);
+      if (first == str.npos) return str.substr(str.size());
+      return str.substr(first, str.find_last_not_of(trim_char) - first + 1);
+    }
     template<typename char_t>
-    static std::basic_string<char_t> trim(const char_t* str, const std::vector<char_t>& trim_chars) noexcept {return trim(std::basic_string<char_t>(str), trim_chars);}
+    static std::basic_string_view<char_t> trim_view(std::basic_string_view<char_t> str, const xtd::char_set<char_t>& trim_chars) noexcept {
+      size_t first = trim_chars.find_first_not(str);
+      if (first == xtd::char_set<char_t>::npos) return str.substr(str.size());
+      return str.substr(first, trim_chars.find_last_not(str) - first + 1);
+    }
     /// @endcond
     
     /// @brief Removes all trailing occurrences of white-space characters from the specifed String.
     /// @param str String to trim end.
     /// @param trim_char A character to remove.
     /// @return The String that remains after all occurrences of the character in the trim_char parameter are removed from the end of the specified String.
-    template<typename char_t>
-    static std::basic_string<char_t> trim_end(const std::basic_string<char_t>& str) noexcept {return trim_end(str, std::vector<char_t> {9, 10, 11, 12, 13, 32});}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim_end(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str) noexcept {return trim_end(str, xtd::char_set<char_t>::white_spaces());}
     
     /// @brief Removes all trailing occurrences of a character specified from the specifed String .
     /// @param str String to trim start.
     /// @param trim_char A character to remove.
     /// @return The String that remains after all occurrences of the character in the trim_char parameter are removed from the end of the specofoed String.
-    template<typename char_t>
-    static std::basic_string<char_t> trim_end(const std::basic_string<char_t>& str, char_t trim_char) noexcept {return trim_end(str, std::vector<char_t> {trim_char});}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim_end(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, char_t trim_char) noexcept {return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(trim_end_view(std::basic_string_view<char_t>(str), trim_char), str.get_allocator());}
     
     /// @brief Removes all trailing occurrences of a set of characters specified in an array from the specified String.
     /// @param str String to trim end.
     /// @param trim_chars An array of characters to remove.
     /// @return The String that remains after all occurrences of the characters in the trim_chars parameter are removed from the end of the specified String.
-    template<typename char_t>
-    static std::basic_string<char_t> trim_end(const std::basic_string<char_t>& str, const std::vector<char_t>& trim_chars) noexcept {
-      std::basic_string<char_t> result(str);
-      while (std::find(trim_chars.begin(), trim_chars.end(), result[result.size() - 1]) != trim_chars.end())
-        result.erase(result.size() - 1, 1);
-      return result;
-    }
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim_end(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::vector<char_t>& trim_chars) noexcept {return trim_end(str, xtd::char_set<char_t>(trim_chars));}
+    
+    /// @brief Removes all trailing occurrences of a set of characters from the specified String.
+    /// @param str String to trim end.
+    /// @param trim_chars A precompiled set of characters to remove.
+    /// @return The String that remains after all occurrences of the characters in the trim_chars parameter are removed from the end of the specified String.
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim_end(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::char_set<char_t>& trim_chars) noexcept {return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(trim_end_view(std::basic_string_view<char_t>(str), trim_chars), str.get_allocator());}
     
     /// @cond
     template<typename char_t>
-    static std::basic_string<char_t> trim_end(const char_t* str) noexcept {return trim_end(std::basic_string<char_t>(str), std::vector<char_t> {9, 10, 11, 12, 13, 32});}
+    static std::basic_string<char_t> trim_end(const char_t* str) noexcept {return std::basic_string<char_t>(trim_end_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces()));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim_end(const char_t* str, char_t trim_char) noexcept {return std::basic_string<char_t>(trim_end_view(std::basic_string_view<char_t>(str), trim_char));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim_end(const char_t* str, const std::vector<char_t>& trim_chars) noexcept {return std::basic_string<char_t>(trim_end_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>(trim_chars)));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim_end(const char_t* str, const xtd::char_set<char_t>& trim_chars) noexcept {return std::basic_string<char_t>(trim_end_view(std::basic_string_view<char_t>(str), trim_chars));}
+    
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim_end(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::initializer_list<char_t>& trim_chars) noexcept {return trim_end(str, xtd::char_set<char_t>(trim_chars));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim_end(const char_t* str, const std::initializer_list<char_t>& trim_chars) noexcept {return std::basic_string<char_t>(trim_end_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>(trim_chars)));}
+    /// @endcond
+    
+    /// @brief Removes all trailing white-space characters from the specified String without copying it.
+    /// @param str String to trim.
+    /// @return A view of the part of str that remains after all white-space characters are removed from the end of it.
+    /// @remarks str must outlive the returned view.
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_end_view(const std::basic_string<char_t>& str) noexcept {return trim_end_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces());}
     
+    /// @brief Removes all trailing occurrences of a character from the specified String without copying it.
+    /// @param str String to trim.
+    /// @param trim_char A character to remove.
+    /// @return A view of the part of str that remains after all occurrences of trim_char are removed from the end of it.
+    /// @remarks str must outlive the returned view.
     template<typename char_t>
-    static std::basic_string<char_t> trim_end(const char_t* str, char_t trim_char) noexcept {return trim_end(std::basic_string<char_t>(str), std::vector<char_t> {trim_char});}
+    static std::basic_string_view<char_t> trim_end_view(const std::basic_string<char_t>& str, char_t trim_char) noexcept {return trim_end_view(std::basic_string_view<char_t>(str), trim_char);}
     
+    /// @brief Removes all trailing occurrences of a set of characters from the specified String without copying it.
+    /// @param str String to trim.
+    /// @param trim_chars A precompiled set of characters to remove.
+    /// @return A view of the part of str that remains after all occurrences of the characters in trim_chars are removed from the end of it.
+    /// @remarks str must outlive the returned view.
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_end_view(const std::basic_string<char_t>& str, const xtd::char_set<char_t>& trim_chars) noexcept {return trim_end_view(std::basic_string_view<char_t>(str), trim_chars);}
+    
+    /// @cond
+    template<typename char_t, typename ...args_t>
+    static void trim_end_view(std::basic_string<char_t>&& str, args_t&& ...args) = delete;
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_end_view(const char_t* str) noexcept {return trim_end_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces());}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_end_view(const char_t* str, char_t trim_char) noexcept {return trim_end_view(std::basic_string_view<char_t>(str), trim_char);}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_end_view(const char_t* str, const xtd::char_set<char_t>& trim_chars) noexcept {return trim_end_view(std::basic_string_view<char_t>(str), trim_chars);}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_end_view(std::basic_string_view<char_t> str) noexcept {return trim_end_view(str, xtd::char_set<char_t>::white_spaces());}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_end_view(std::basic_string_view<char_t> str, char_t trim_char) noexcept {
+      size_t last = str.find_last_not_of(trim_char);
+      return str.substr(0, last == str.npos ? 0 : last + 1);
+    }
     template<typename char_t>
-    static std::basic_string<char_t> trim_end(const char_t* str, const std::vector<char_t>& trim_chars) noexcept {return trim_end(std::basic_string<char_t>(str), trim_chars);}
+    static std::basic_string_view<char_t> trim_end_view(std::basic_string_view<char_t> str, const xtd::char_set<char_t>& trim_chars) noexcept {
+      size_t last = trim_chars.find_last_not(str);
+      return str.substr(0, last == xtd::char_set<char_t>::npos ? 0 : last + 1);
+    }
     /// @endcond
     
     /// @brief Removes all leading occurrences of white-space characters from the specifed String.
     /// @param str String to trim start.
     /// @param trim_char A character to remove.
     /// @return The String that remains after all occurrences of the character in the trim_char parameter are removed from the start of the specified String.
-    template<typename char_t>
-    static std::basic_string<char_t> trim_start(const std::basic_string<char_t>& str) noexcept {return trim_start(str, std::vector<char_t> {9, 10, 11, 12, 13, 32});}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim_start(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str) noexcept {return trim_start(str, xtd::char_set<char_t>::white_spaces());}
     
     /// @brief Removes all leading occurrences of a character specified from the specifed String .
     /// @param str String to trim start.
     /// @param trim_char A character to remove.
     /// @return The String that remains after all occurrences of the character in the trim_char parameter are removed from the start of the specofoed String.
-    template<typename char_t>
-    static std::basic_string<char_t> trim_start(const std::basic_string<char_t>& str, char_t trim_char) noexcept {return trim_start(str, std::vector<char_t> {trim_char});}
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim_start(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, char_t trim_char) noexcept {return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(trim_start_view(std::basic_string_view<char_t>(str), trim_char), str.get_allocator());}
     
     /// @brief Removes all leading occurrences of a set of characters specified in an array from the specified String.
     /// @param str String to trim start.
     /// @param trim_chars An array of characters to remove.
     /// @return The String that remains after all occurrences of the characters in the trim_chars parameter are removed from the start of the specified String.
-    template<typename char_t>
-    static std::basic_string<char_t> trim_start(const std::basic_string<char_t>& str, const std::vector<char_t>& trim_chars) noexcept {
-      std::basic_string<char_t> result(str);
-      while (std::find(trim_chars.begin(), trim_chars.end(), result[0]) != trim_chars.end())
-        result.erase(0, 1);
-      return result;
-    }
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim_start(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::vector<char_t>& trim_chars) noexcept {return trim_start(str, xtd::char_set<char_t>(trim_chars));}
+    
+    /// @brief Removes all leading occurrences of a set of characters from the specified String.
+    /// @param str String to trim start.
+    /// @param trim_chars A precompiled set of characters to remove.
+    /// @return The String that remains after all occurrences of the characters in the trim_chars parameter are removed from the start of the specified String.
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim_start(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const xtd::char_set<char_t>& trim_chars) noexcept {return std::basic_string<char_t, std::char_traits<char_t>, allocator_t>(trim_start_view(std::basic_string_view<char_t>(str), trim_chars), str.get_allocator());}
     
     /// @cond
     template<typename char_t>
-    static std::basic_string<char_t> trim_start(const char_t* str) noexcept {return trim_start(std::basic_string<char_t>(str), std::vector<char_t> {9, 10, 11, 12, 13, 32});}
+    static std::basic_string<char_t> trim_start(const char_t* str) noexcept {return std::basic_string<char_t>(trim_start_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces()));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim_start(const char_t* str, char_t trim_char) noexcept {return std::basic_string<char_t>(trim_start_view(std::basic_string_view<char_t>(str), trim_char));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim_start(const char_t* str, const std::vector<char_t>& trim_chars) noexcept {return std::basic_string<char_t>(trim_start_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>(trim_chars)));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim_start(const char_t* str, const xtd::char_set<char_t>& trim_chars) noexcept {return std::basic_string<char_t>(trim_start_view(std::basic_string_view<char_t>(str), trim_chars));}
+    
+    template<typename char_t, typename allocator_t>
+    static std::basic_string<char_t, std::char_traits<char_t>, allocator_t> trim_start(const std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& str, const std::initializer_list<char_t>& trim_chars) noexcept {return trim_start(str, xtd::char_set<char_t>(trim_chars));}
+    
+    template<typename char_t>
+    static std::basic_string<char_t> trim_start(const char_t* str, const std::initializer_list<char_t>& trim_chars) noexcept {return std::basic_string<char_t>(trim_start_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>(trim_chars)));}
+    /// @endcond
+    
+    /// @brief Removes all leading white-space characters from the specified String without copying it.
+    /// @param str String to trim.
+    /// @return A view of the part of str that remains after all white-space characters are removed from the start of it.
+    /// @remarks str must outlive the returned view.
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_start_view(const std::basic_string<char_t>& str) noexcept {return trim_start_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces());}
+    
+    /// @brief Removes all leading occurrences of a character from the specified String without copying it.
+    /// @param str String to trim.
+    /// @param trim_char A character to remove.
+    /// @return A view of the part of str that remains after all occurrences of trim_char are removed from the start of it.
+    /// @remarks str must outlive the returned view.
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_start_view(const std::basic_string<char_t>& str, char_t trim_char) noexcept {return trim_start_view(std::basic_string_view<char_t>(str), trim_char);}
     
+    /// @brief Removes all leading occurrences of a set of characters from the specified String without copying it.
+    /// @param str String to trim.
+    /// @param trim_chars A precompiled set of characters to remove.
+    /// @return A view of the part of str that remains after all occurrences of the characters in trim_chars are removed from the start of it.
+    /// @remarks str must outlive the returned view.
     template<typename char_t>
-    static std::basic_string<char_t> trim_start(const char_t* str, char_t trim_char) noexcept {return trim_start(std::basic_string<char_t>(str), std::vector<char_t> {trim_char});}
+    static std::basic_string_view<char_t> trim_start_view(const std::basic_string<char_t>& str, const xtd::char_set<char_t>& trim_chars) noexcept {return trim_start_view(std::basic_string_view<char_t>(str), trim_chars);}
     
+    /// @cond
+    template<typename char_t, typename ...args_t>
+    static void trim_start_view(std::basic_string<char_t>&& str, args_t&& ...args) = delete;
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_start_view(const char_t* str) noexcept {return trim_start_view(std::basic_string_view<char_t>(str), xtd::char_set<char_t>::white_spaces());}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_start_view(const char_t* str, char_t trim_char) noexcept {return trim_start_view(std::basic_string_view<char_t>(str), trim_char);}
     template<typename char_t>
-    static std::basic_string<char_t> trim_start(const char_t* str, const std::vector<char_t>& trim_chars) noexcept {return trim_start(std::basic_string<char_t>(str), trim_chars);}
+    static std::basic_string_view<char_t> trim_start_view(const char_t* str, const xtd::char_set<char_t>& trim_chars) noexcept {return trim_start_view(std::basic_string_view<char_t>(str), trim_chars);}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_start_view(std::basic_string_view<char_t> str) noexcept {return trim_start_view(str, xtd::char_set<char_t>::white_spaces());}
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_start_view(std::basic_string_view<char_t> str, char_t trim_char) noexcept {
+      size_t first = str.find_first_not_of(trim_char);
+      return str.substr(first == str.npos ? str.size() : first);
+    }
+    template<typename char_t>
+    static std::basic_string_view<char_t> trim_start_view(std::basic_string_view<char_t> str, const xtd::char_set<char_t>& trim_chars) noexcept {
+      size_t first = trim_chars.find_first_not(str);
+      return str.substr(first == xtd::char_set<char_t>::npos ? str.size() : first);
+    }
     /// @endcond
     
     template<typename Value>
@@ -1673,6 +2664,18 @@ namespace xtd {
       else return std::forward<arg_t>(arg);
     }
     
+    template<typename char_t, typename range_t>
+    static std::basic_string<char_t> concat_range(const range_t& values) noexcept {
+      size_t length = 0;
+      for (const auto& item : values)
+        length += __concat_size_hint<char_t>(item);
+      std::basic_string<char_t> result;
+      result.reserve(length);
+      for (const auto& item : values)
+        __concat_append(result, item);
+      return result;
+    }
+    
     static std::string get_class_name(const std::string& full_name) {
       size_t length = last_index_of(full_name, "<");
       if (length == -1) length = full_name.length();
@@ -1685,8 +2688,8 @@ namespace xtd {
 #include "parse.h"
 #include "to_string.h"
 
-template<typename char_t, typename arg_t>
-void __extract_format_arg(std::basic_string<char_t>& fmt, size_t& index, std::vector<__format_information<char_t>>& formats, arg_t&& arg) {
+template<typename char_t, typename allocator_t, typename arg_t>
+void __extract_format_arg(std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& fmt, size_t& index, std::vector<__format_information<char_t>>& formats, arg_t&& arg) {
   size_t offset = 0;
   for (auto& format : formats) {
     format.location += offset;
@@ -1710,12 +2713,67 @@ void __extract_format_arg(std::basic_string<char_t>& fmt, size_t& index, std::ve
   ++index;
 }
 
-template<typename char_t, typename ...args_t>
-void __extract_format_arg(std::basic_string<char_t>& fmt, std::vector<__format_information<char_t>>& formats, args_t&&... args) {
+template<typename char_t, typename allocator_t, typename ...args_t>
+void __extract_format_arg(std::basic_string<char_t, std::char_traits<char_t>, allocator_t>& fmt, std::vector<__format_information<char_t>>& formats, args_t&&... args) {
   size_t index = 0;
   (__extract_format_arg(fmt, index, formats, args),...);
 }
 
+// Appends arg to result as __extract_format_arg inserts it into a string. Strings, characters and integers that "G" writes in full are written without a temporary string.
+template<typename char_t, size_t capacity, typename arg_t>
+bool __format_to_arg(xtd::fixed_string<char_t, capacity>& result, arg_t&& arg, std::basic_string_view<char_t> format, int alignment, xtd::fixed_string_overflow overflow) {
+  using value_t = typename std::remove_cv<typename std::remove_reference<arg_t>::type>::type;
+  std::basic_string_view<char_t> text;
+  std::basic_string<char_t> arg_str;
+  char_t buffer[8];
+  if constexpr (std::is_convertible<const value_t&, std::basic_string_view<char_t>>::value) {
+    if (format.empty()) text = std::basic_string_view<char_t>(arg);
+  } else if constexpr (std::is_same<value_t, char_t>::value) {
+    if (format.empty()) text = std::basic_string_view<char_t>(&arg, 1);
+  } else if constexpr (std::is_integral<value_t>::value && __concat_is_number<value_t>::value) {
+    if (format.empty() && (std::is_signed<value_t>::value ? static_cast<long long>(arg) > -1000000 && static_cast<long long>(arg) < 1000000 : static_cast<unsigned long long>(arg) < 1000000)) {
+      char digits[sizeof(buffer)];
+      const char* last = std::to_chars(digits, digits + sizeof(digits), arg).ptr;
+      for (const char* c = digits; c != last; ++c)
+        buffer[c - digits] = static_cast<char_t>(*c);
+      text = std::basic_string_view<char_t>(buffer, last - digits);
+    }
+  }
+  if (text.data() == nullptr) {
+    arg_str = format.empty() ? __format_stringer<char_t, arg_t>(arg) : xtd::to_string(arg, std::basic_string<char_t>(format));
+    text = arg_str;
+  }
+  size_t width = static_cast<size_t>(alignment < 0 ? -alignment : alignment);
+  size_t padding = width > text.size() ? width - text.size() : 0;
+  bool complete = true;
+  if (alignment > 0 && !result.append(padding, char_t(' '), overflow)) complete = false;
+  if (!result.append(text, overflow)) complete = false;
+  if (alignment < 0 && !result.append(padding, char_t(' '), overflow)) complete = false;
+  return complete;
+}
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Appends the string representation of the specified value to a fixed string, using the specified format; what happens when it does not fit is specified by overflow.
+  /// @param result The fixed string to append to.
+  /// @param value The value to convert.
+  /// @param fmt The format of the value; empty for its default representation.
+  /// @param overflow What happens when the representation does not fit in the remaining capacity of result.
+  /// @return true if the whole representation is appended; false if it is truncated.
+  /// @exception std::length_error The representation does not fit in the remaining capacity of result and overflow is xtd::fixed_string_overflow::error; result is left unchanged.
+  /// @remarks The representation is the same as the one written by xtd::strings::format_to for "{0:fmt}".
+  template<typename char_t, size_t capacity, typename value_t>
+  inline bool to_string(xtd::fixed_string<char_t, capacity>& result, value_t&& value, typename xtd::fixed_string<char_t, capacity>::view_type fmt = {}, xtd::fixed_string_overflow overflow = xtd::fixed_string_overflow::error) {
+    size_t length = result.size();
+    try {
+      return __format_to_arg(result, value, fmt, 0, overflow);
+    } catch (...) {
+      result.resize(length);
+      throw;
+    }
+  }
+}
+
 /// @cond
 #undef __XTD_STRINGS_INCLUDE__
 /// @endcond
@@ -1,11 +1,25 @@
 /// @file
 /// @brief Contains xtd::strings class.
 #pragma once
+#include "boolean_styles.h"
+#include "char_set.h"
+#include "fixed_string.h"
+#include "fixed_string_overflow.h"
 #include "format.h"
 #include "istring.h"
+#include "number_reader.h"
 #include "number_styles.h"
 #include "parse.h"
+#include "pattern_set.h"
+#include "prefix_trie.h"
+#include "rope.h"
+#include "searcher.h"
+#include "split_view.h"
+#include "string_builder.h"
 #include "string_comparison.h"
+#include "string_equal_to.h"
+#include "string_hasher.h"
+#include "string_pool.h"
 #include "string_split_options.h"
 #include "strings.h"
 #include "to_string.h"
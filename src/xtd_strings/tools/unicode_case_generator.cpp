@@ -0,0 +1,188 @@
+// Generates include/xtd/internal/__unicode_case_tables.h from the UnicodeData.txt and CaseFolding.txt files of the Unicode Character Database.
+// usage: unicode_case_generator UnicodeData.txt CaseFolding.txt __unicode_case_tables.h
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+  constexpr uint32_t code_point_count = 0x110000;
+
+  struct record {
+    int32_t lower = 0;
+    int32_t upper = 0;
+    int32_t fold = 0;
+    bool operator<(const record& other) const noexcept {return std::tie(lower, upper, fold) < std::tie(other.lower, other.upper, other.fold);}
+    bool operator==(const record& other) const noexcept {return std::tie(lower, upper, fold) == std::tie(other.lower, other.upper, other.fold);}
+  };
+
+  std::vector<std::string> split(const std::string& line, char separator) {
+    std::vector<std::string> fields;
+    std::string field;
+    std::istringstream stream(line);
+    while (std::getline(stream, field, separator)) fields.push_back(field);
+    if (!line.empty() && line.back() == separator) fields.emplace_back();
+    return fields;
+  }
+
+  std::string trim(const std::string& str) {
+    size_t first = str.find_first_not_of(" \t\r");
+    if (first == std::string::npos) return {};
+    return str.substr(first, str.find_last_not_of(" \t\r") - first + 1);
+  }
+
+  uint32_t parse_code_point(const std::string& str) {return static_cast<uint32_t>(std::stoul(trim(str), nullptr, 16));}
+
+  // Fields 12 and 13 of UnicodeData.txt are the simple uppercase and lowercase mappings.
+  bool read_unicode_data(const std::string& path, std::vector<record>& records) {
+    std::ifstream file(path);
+    if (!file) return false;
+    for (std::string line; std::getline(file, line);) {
+      if (trim(line).empty() || line[0] == '#') continue;
+      auto fields = split(line, ';');
+      if (fields.size() < 14) continue;
+      uint32_t code_point = parse_code_point(fields[0]);
+      if (!trim(fields[12]).empty()) records[code_point].upper = static_cast<int32_t>(parse_code_point(fields[12])) - static_cast<int32_t>(code_point);
+      if (!trim(fields[13]).empty()) records[code_point].lower = static_cast<int32_t>(parse_code_point(fields[13])) - static_cast<int32_t>(code_point);
+    }
+    return true;
+  }
+
+  // The simple case folding is made of the C and S entries of CaseFolding.txt.
+  bool read_case_folding(const std::string& path, std::vector<record>& records) {
+    std::ifstream file(path);
+    if (!file) return false;
+    for (std::string line; std::getline(file, line);) {
+      line = line.substr(0, line.find('#'));
+      if (trim(line).empty()) continue;
+      auto fields = split(line, ';');
+      if (fields.size() < 3) continue;
+      std::string status = trim(fields[1]);
+      if (status != "C" && status != "S") continue;
+      uint32_t code_point = parse_code_point(fields[0]);
+      records[code_point].fold = static_cast<int32_t>(parse_code_point(fields[2])) - static_cast<int32_t>(code_point);
+    }
+    return true;
+  }
+
+  struct tables {
+    unsigned shift = 0;
+    uint32_t limit = 0;
+    std::vector<record> records;
+    std::vector<uint32_t> blocks;
+    std::vector<uint32_t> indexes;
+    size_t size() const noexcept {return records.size() * 12 + blocks.size() * (indexes.size() / (1u << shift) < 256 ? 1 : 2) + indexes.size() * (records.size() < 256 ? 1 : 2);}
+  };
+
+  // Builds the two-level tables for a block size of 1 << shift: code points are mapped to the index of their record through the index of their block, identical blocks are shared.
+  tables build(const std::vector<record>& records, uint32_t limit, unsigned shift) {
+    tables result;
+    result.shift = shift;
+    uint32_t block_size = 1u << shift;
+    result.limit = (limit + block_size - 1) & ~(block_size - 1);
+    std::map<record, uint32_t> record_indexes {{record {}, 0}};
+    result.records.push_back(record {});
+    std::map<std::vector<uint32_t>, uint32_t> block_indexes;
+    for (uint32_t first = 0; first < result.limit; first += block_size) {
+      std::vector<uint32_t> block;
+      for (uint32_t code_point = first; code_point < first + block_size; ++code_point) {
+        auto iterator = record_indexes.find(records[code_point]);
+        if (iterator == record_indexes.end()) {
+          iterator = record_indexes.emplace(records[code_point], static_cast<uint32_t>(result.records.size())).first;
+          result.records.push_back(records[code_point]);
+        }
+        block.push_back(iterator->second);
+      }
+      auto iterator = block_indexes.find(block);
+      if (iterator == block_indexes.end()) {
+        iterator = block_indexes.emplace(block, static_cast<uint32_t>(block_indexes.size())).first;
+        result.indexes.insert(result.indexes.end(), block.begin(), block.end());
+      }
+      result.blocks.push_back(iterator->second);
+    }
+    return result;
+  }
+
+  void write_array(std::ostream& stream, const std::string& type, const std::string& name, const std::vector<uint32_t>& values) {
+    stream << "inline constexpr " << type << " " << name << "[] = {";
+    for (size_t index = 0; index < values.size(); ++index)
+      stream << (index % 32 == 0 ? "\n  " : " ") << values[index] << (index + 1 < values.size() ? "," : "");
+    stream << "\n};\n";
+  }
+}
+
+int main(int argc, char* argv[]) {
+  if (argc != 4) {
+    std::cerr << "usage: unicode_case_generator UnicodeData.txt CaseFolding.txt __unicode_case_tables.h" << std::endl;
+    return 1;
+  }
+  std::vector<record> records(code_point_count);
+  if (!read_unicode_data(argv[1], records) || !read_case_folding(argv[2], records)) {
+    std::cerr << "unicode_case_generator: cannot read " << argv[1] << " or " << argv[2] << std::endl;
+    return 1;
+  }
+
+  // UTF-16 strings are converted in place: no mapping may cross the boundary of the basic multilingual plane.
+  uint32_t limit = 0;
+  for (uint32_t code_point = 0; code_point < code_point_count; ++code_point) {
+    const record& mapping = records[code_point];
+    if (mapping == record {}) continue;
+    limit = code_point + 1;
+    for (int32_t delta : {mapping.lower, mapping.upper, mapping.fold}) {
+      if ((code_point < 0x10000) != (static_cast<uint32_t>(static_cast<int32_t>(code_point) + delta) < 0x10000)) {
+        std::cerr << "unicode_case_generator: the mapping of U+" << std::hex << code_point << " crosses the basic multilingual plane" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  tables best = build(records, limit, 4);
+  for (unsigned shift = 5; shift <= 10; ++shift) {
+    tables candidate = build(records, limit, shift);
+    if (candidate.size() < best.size()) best = candidate;
+  }
+
+  std::ostringstream stream;
+  stream << "/// @file\n";
+  stream << "/// @brief Contains the Unicode simple case mapping and case folding tables.\n";
+  stream << "#pragma once\n";
+  stream << "\n";
+  stream << "/// @cond\n";
+  stream << "#ifndef __XTD_STRINGS_INCLUDE__\n";
+  stream << "#error \"Do not include this file yourself, use only #include <xtd/xtd.strings>\"\n";
+  stream << "#endif\n";
+  stream << "/// @endcond\n";
+  stream << "\n";
+  stream << "#include <cstdint>\n";
+  stream << "\n";
+  stream << "/// @cond\n";
+  stream << "// Generated by tools/unicode_case_generator.cpp from data/unicode/UnicodeData.txt and data/unicode/CaseFolding.txt; do not edit.\n";
+  stream << "// The record of a code point below __unicode_case_limit is __unicode_case_records[__unicode_case_indexes[(__unicode_case_blocks[code_point >> __unicode_case_shift] << __unicode_case_shift) + (code_point & ((1 << __unicode_case_shift) - 1))]]; every other code point maps to itself.\n";
+  stream << "struct __unicode_case_record {\n";
+  stream << "  int32_t lower;\n";
+  stream << "  int32_t upper;\n";
+  stream << "  int32_t fold;\n";
+  stream << "};\n";
+  stream << "\n";
+  stream << "inline constexpr unsigned __unicode_case_shift = " << best.shift << ";\n";
+  stream << "inline constexpr char32_t __unicode_case_limit = 0x" << std::hex << std::uppercase << best.limit << std::dec << ";\n";
+  stream << "\n";
+  stream << "inline constexpr __unicode_case_record __unicode_case_records[] = {";
+  for (size_t index = 0; index < best.records.size(); ++index)
+    stream << (index % 8 == 0 ? "\n  " : " ") << "{" << best.records[index].lower << ", " << best.records[index].upper << ", " << best.records[index].fold << "}" << (index + 1 < best.records.size() ? "," : "");
+  stream << "\n};\n";
+  stream << "\n";
+  write_array(stream, best.indexes.size() >> best.shift < 256 ? "uint8_t" : "uint16_t", "__unicode_case_blocks", best.blocks);
+  stream << "\n";
+  write_array(stream, best.records.size() < 256 ? "uint8_t" : "uint16_t", "__unicode_case_indexes", best.indexes);
+  stream << "/// @endcond\n";
+
+  std::ofstream output(argv[3], std::ios::binary);
+  output << stream.str();
+  return output ? 0 : 1;
+}
@@ -0,0 +1,64 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_char_set) {
+  public:
+    void test_method_(contains) {
+      char_set<char> set {',', ';', '\xE9'};
+      assert::is_true(set.contains(','));
+      assert::is_true(set.contains('\xE9'));
+      assert::is_false(set.contains('.'));
+      assert::is_true(char_set<char>().empty());
+    }
+
+    void test_method_(contains_wide_characters) {
+      char_set<char32_t> set {U',', U'é', U'中', U'\U0001F600'};
+      assert::is_true(set.contains(U'中'));
+      assert::is_true(set.contains(U'\U0001F600'));
+      assert::is_false(set.contains(U'丮'));
+      assert::are_equal(2U, set.find_first(U"ab中c,"));
+      assert::are_equal(4U, set.find_last(U"ab中c,"));
+    }
+
+    void test_method_(find_first) {
+      char_set<char> set {'=', ';'};
+      string line = string(40, 'x') + "=" + string(20, 'y') + ";";
+      assert::are_equal(40U, set.find_first(line));
+      assert::are_equal(61U, set.find_first(line, 41));
+      assert::are_equal(char_set<char>::npos, set.find_first(line, 62));
+      assert::are_equal(char_set<char>::npos, set.find_first(string(100, 'x')));
+    }
+
+    void test_method_(find_last) {
+      char_set<char> set {'=', ';'};
+      string line = ";" + string(40, 'x') + "=" + string(20, 'y');
+      assert::are_equal(41U, set.find_last(line));
+      assert::are_equal(0U, set.find_last(line.substr(0, 41)));
+      assert::are_equal(char_set<char>::npos, set.find_last(""));
+    }
+
+    void test_method_(find_with_many_high_nibbles) {
+      string values;
+      for (auto c = 0x21; c < 0x100; c += 0x11)
+        values += static_cast<char>(c);
+      char_set<char> set {string_view(values)};
+      string text = string(32, ' ') + "\x21" + string(32, ' ') + "\xFE";
+      assert::are_equal(32U, set.find_first(text));
+      assert::are_equal(65U, set.find_last(text));
+      assert::are_equal(char_set<char>::npos, set.find_first(string(64, ')')));
+    }
+
+    void test_method_(find_first_not_and_find_last_not) {
+      const auto& set = char_set<char>::white_spaces();
+      assert::are_equal(2U, set.find_first_not(" \tabc \n"));
+      assert::are_equal(4U, set.find_last_not(" \tabc \n"));
+      assert::are_equal(char_set<char>::npos, set.find_first_not(" \t\n"));
+    }
+  };
+}
@@ -0,0 +1,109 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+
+#include <time.h>
+
+using namespace std;
+using namespace std::chrono;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace {
+  system_clock::time_point make_utc_time_point(int year, int month, int day, int hour, int minute, int second) {
+    std::tm time {};
+    time.tm_year = year - 1900;
+    time.tm_mon = month - 1;
+    time.tm_mday = day;
+    time.tm_hour = hour;
+    time.tm_min = minute;
+    time.tm_sec = second;
+#if defined (WIN32)
+    return system_clock::from_time_t(_mkgmtime(&time));
+#else
+    return system_clock::from_time_t(timegm(&time));
+#endif
+  }
+
+  system_clock::time_point make_local_time_point(int year, int month, int day, int hour, int minute, int second) {
+    std::tm time {};
+    time.tm_year = year - 1900;
+    time.tm_mon = month - 1;
+    time.tm_mday = day;
+    time.tm_hour = hour;
+    time.tm_min = minute;
+    time.tm_sec = second;
+    time.tm_isdst = -1;
+    return system_clock::from_time_t(mktime(&time));
+  }
+}
+
+namespace unit_tests {
+  class test_class_(test_date_time_parse) {
+  public:
+    void test_method_(parse_iso_8601_with_utc_designator) {
+      assert::are_equal(make_utc_time_point(2021, 1, 2, 3, 4, 5), xtd::parse<system_clock::time_point>("2021-01-02T03:04:05Z", "s"));
+    }
+
+    void test_method_(parse_iso_8601_with_fraction_and_offset) {
+      assert::are_equal(make_utc_time_point(2021, 1, 2, 1, 34, 5) + duration_cast<system_clock::duration>(milliseconds(250)), xtd::parse<system_clock::time_point>("2021-01-02T03:04:05.250+01:30", "s"));
+    }
+
+    void test_method_(parse_iso_8601_local) {
+      assert::are_equal(make_local_time_point(2021, 1, 2, 3, 4, 5), xtd::parse<system_clock::time_point>(L"2021-01-02T03:04:05"s, L"s"s));
+    }
+
+    void test_method_(parse_universal_sortable) {
+      assert::are_equal(make_utc_time_point(2021, 12, 31, 23, 59, 59), xtd::parse<system_clock::time_point>("2021-12-31 23:59:59Z", "u"));
+    }
+
+    void test_method_(parse_rfc_1123) {
+      assert::are_equal(make_utc_time_point(1994, 11, 15, 8, 12, 31), xtd::parse<system_clock::time_point>("Tue, 15 Nov 1994 08:12:31 GMT", "U"));
+    }
+
+    void test_method_(parse_tm_from_formated_string) {
+      std::tm time = xtd::parse<std::tm>("Wednesday, 29 February 2012 9:08:07", "U");
+      assert::are_equal(112, time.tm_year);
+      assert::are_equal(1, time.tm_mon);
+      assert::are_equal(29, time.tm_mday);
+      assert::are_equal(9, time.tm_hour);
+      assert::are_equal(8, time.tm_min);
+      assert::are_equal(7, time.tm_sec);
+      assert::are_equal(3, time.tm_wday);
+      assert::are_equal(59, time.tm_yday);
+    }
+
+    void test_method_(parse_short_date) {
+      std::tm time = xtd::parse<std::tm>(u"07/04/1976"s, u"d"s);
+      assert::are_equal(76, time.tm_year);
+      assert::are_equal(6, time.tm_mon);
+      assert::are_equal(4, time.tm_mday);
+    }
+
+    void test_method_(round_trip_with_to_string) {
+      std::tm time = xtd::parse<std::tm>("1 January 2000", "O");
+      assert::are_equal("01/01/2000", xtd::to_string(time, "d"));
+    }
+
+    void test_method_(parse_invalid_date) {
+      assert::throws<std::out_of_range>([]{xtd::parse<std::tm>("2021-02-29T00:00:00", "s");});
+    }
+
+    void test_method_(parse_weekday_not_matching_date) {
+      assert::are_equal(2, xtd::parse<std::tm>("Tue, 2 Jan 2024", "n").tm_wday);
+      assert::throws<std::invalid_argument>([]{xtd::parse<std::tm>("Mon, 2 Jan 2024", "n");});
+      assert::throws<std::invalid_argument>([]{xtd::parse<system_clock::time_point>(L"Mon, 15 Nov 1994 08:12:31 GMT"s, L"U"s);});
+    }
+
+    void test_method_(parse_invalid_format) {
+      assert::throws<std::invalid_argument>([]{xtd::parse<std::tm>("2021-01-02", "s");});
+      assert::throws<std::invalid_argument>([]{xtd::parse<std::tm>("2021-01-02", "x");});
+    }
+
+    void test_method_(parse_non_ascii_format) {
+      assert::throws<std::invalid_argument>([]{xtd::parse<std::chrono::system_clock::time_point>(std::string("2020"), std::string("\xE9"));});
+      assert::throws<std::invalid_argument>([]{xtd::parse<std::tm>("2020", "\x80");});
+    }
+  };
+}
@@ -0,0 +1,60 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+
+using namespace std;
+using namespace std::chrono;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_duration_parse) {
+  public:
+    void test_method_(parse_constant) {
+      assert::are_equal(seconds(3723), xtd::parse<seconds>("01:02:03", "c"));
+    }
+
+    void test_method_(parse_constant_with_days_and_nanoseconds) {
+      assert::are_equal(hours(26) + minutes(3) + seconds(4) + nanoseconds(5), xtd::parse<nanoseconds>("1.02:03:04:000000005", "c"));
+    }
+
+    void test_method_(parse_negative_general_short) {
+      assert::are_equal(-seconds(3723), xtd::parse<seconds>("-1:02:03", "g"));
+    }
+
+    void test_method_(parse_general_long_is_default) {
+      assert::are_equal(minutes(90), xtd::parse<minutes>(L"01:30:00"s));
+    }
+
+    void test_method_(parse_full) {
+      assert::are_equal(hours(48) + milliseconds(500), xtd::parse<milliseconds>(u"2:00:00:00:500000000"s, u"F"s));
+    }
+
+    void test_method_(round_trip_with_to_string) {
+      nanoseconds value = hours(49) + minutes(59) + seconds(1) + nanoseconds(42);
+      assert::are_equal(value, xtd::parse<nanoseconds>(xtd::to_string(value, "G"), "G"));
+      assert::are_equal(value, xtd::parse<nanoseconds>(xtd::to_string(value, "f"), "f"));
+    }
+
+    void test_method_(parse_invalid) {
+      assert::throws<std::invalid_argument>([]{xtd::parse<seconds>("1:2:3", "c");});
+      assert::throws<std::invalid_argument>([]{xtd::parse<seconds>("01:60:00", "c");});
+      assert::throws<std::invalid_argument>([]{xtd::parse<seconds>("01:00:00", "h");});
+    }
+
+    void test_method_(parse_wide_format) {
+      assert::are_equal(seconds(3723), xtd::parse<seconds>(L"01:02:03"s, L"c"s));
+      assert::are_equal(seconds(3723), xtd::parse<seconds>(u"01:02:03"s, u"g"s));
+      assert::throws<std::invalid_argument>([]{xtd::parse<seconds>(u"01:02:03"s, u"\u0163"s);});
+      assert::throws<std::invalid_argument>([]{xtd::parse<seconds>(U"01:02:03"s, U"\U00010047"s);});
+      assert::throws<std::invalid_argument>([]{xtd::parse<seconds>(L"01:02:03"s, L"\u0147"s);});
+    }
+
+    void test_method_(try_parse_duration) {
+      seconds value {};
+      assert::is_true(xtd::try_parse("00:00:42", value));
+      assert::are_equal(seconds(42), value);
+      assert::is_false(xtd::try_parse("forty-two", value));
+    }
+  };
+}
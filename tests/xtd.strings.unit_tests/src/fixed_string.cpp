@@ -0,0 +1,110 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+#include <sstream>
+#include <type_traits>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_fixed_string) {
+  public:
+    void test_method_(trivially_copyable) {
+      assert::is_true(is_trivially_copyable<fixed_string<char, 64>>::value);
+      assert::is_true(is_trivially_copyable<fixed_string<wchar_t, 16>>::value);
+      assert::are_equal(64U, (fixed_string<char, 64>::capacity()));
+    }
+
+    void test_method_(construct) {
+      fixed_string<char, 8> empty;
+      assert::is_true(empty.empty());
+      assert::are_equal("", empty.c_str());
+      fixed_string<char, 8> str("key");
+      assert::are_equal(3U, str.size());
+      assert::are_equal("key", str.c_str());
+      assert::is_true(str == "key");
+      assert::is_true(fixed_string<char, 8>("0123456789", fixed_string_overflow::truncate) == "01234567");
+      assert::throws<length_error>([] {fixed_string<char, 8> {"0123456789"};});
+    }
+
+    void test_method_(append) {
+      fixed_string<char, 8> str;
+      str.append("0123").append("45"s);
+      str.push_back('6');
+      assert::are_equal("0123456", str.c_str());
+      assert::throws<length_error>([&] {str.append("89");});
+      assert::are_equal("0123456", str.c_str());
+      assert::is_false(str.append("789", fixed_string_overflow::truncate));
+      assert::are_equal("01234567", str.c_str());
+      assert::is_true(str.full());
+      str.clear();
+      assert::is_true(str.append(3, '*'));
+      assert::are_equal("***", str.c_str());
+    }
+
+    void test_method_(format_to) {
+      fixed_string<char, 64> line;
+      assert::is_true(strings::format_to(line, "{0}={1,6}|{2,-4}|{{{3}}}", "key", 42, 'c', -7));
+      assert::are_equal("key=    42|c   |{-7}", line.c_str());
+      assert::is_true(strings::format_to(line, "; {0:D3} {1}", 7, 1.5));
+      assert::are_equal("key=    42|c   |{-7}; 007 1.5", line.c_str());
+    }
+
+    void test_method_(format_to_same_as_format) {
+      fixed_string<char, 256> line;
+      int number = 1234567;
+      const int constant = 1234567;
+      const int small_constant = -123456;
+      strings::format_to(line, "{0}|{1}|{2}|{3}|{4}|{5}|{6}|{7}|{1}", number, constant, small_constant, 999999U, -999999L, true, istring("istring"), "text"s);
+      assert::are_equal(strings::format("{0}|{1}|{2}|{3}|{4}|{5}|{6}|{7}|{1}", number, constant, small_constant, 999999U, -999999L, true, istring("istring"), "text"s), string(line));
+    }
+
+    void test_method_(format_to_empty_alignment) {
+      fixed_string<char, 16> line;
+      assert::is_true(strings::format_to(line, "{0,}|{1,:D2}", 5, 7));
+      assert::are_equal(strings::format("{0,}|{1,:D2}", 5, 7), string(line));
+      assert::are_equal("5|07", line.c_str());
+    }
+
+    void test_method_(format_to_error) {
+      fixed_string<char, 8> str("ab");
+      assert::throws<length_error>([&] {strings::format_to(str, "{0}", "0123456789");});
+      assert::are_equal("ab", str.c_str());
+      assert::throws<invalid_argument>([&] {strings::format_to(str, "{0", 1);});
+      assert::throws<invalid_argument>([&] {strings::format_to(str, "0}", 1);});
+      assert::are_equal("ab", str.c_str());
+    }
+
+    void test_method_(format_to_truncate) {
+      fixed_string<char, 8> str;
+      assert::is_false(strings::format_to(str, fixed_string_overflow::truncate, "{0}-{1}", "abcde", 123456));
+      assert::are_equal("abcde-12", str.c_str());
+    }
+
+    void test_method_(to_string) {
+      fixed_string<char, 16> str;
+      assert::is_true(xtd::to_string(str, 42, "D5"));
+      str.push_back(' ');
+      assert::is_true(xtd::to_string(str, true));
+      assert::are_equal("00042 true", str.c_str());
+      assert::throws<length_error>([&] {xtd::to_string(str, "0123456789");});
+      assert::are_equal("00042 true", str.c_str());
+      assert::is_false(xtd::to_string(str, 0x123456789, "X", fixed_string_overflow::truncate));
+      assert::are_equal("00042 true123456", str.c_str());
+    }
+
+    void test_method_(wide_string) {
+      fixed_string<wchar_t, 32> str;
+      strings::format_to(str, L"{0} {1,3}", L"\u03A3", 7);
+      assert::are_equal(L"\u03A3   7", str.c_str());
+    }
+
+    void test_method_(write) {
+      stringstream stream;
+      stream << fixed_string<char, 8>("key");
+      assert::are_equal("key", stream.str());
+    }
+  };
+}
@@ -0,0 +1,154 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+#include <memory_resource>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::string_literals;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_istring) {
+  public:
+    void test_method_(copy_shares_buffer) {
+      istring str = "Hello, World!";
+      istring copy = str;
+      istring assigned;
+      assigned = copy;
+      assert::are_equal(str.data(), copy.data());
+      assert::are_equal(str.data(), assigned.data());
+      assert::is_true(copy == "Hello, World!");
+    }
+
+    void test_method_(move) {
+      istring str = "Hello, World!";
+      const char* data = str.data();
+      istring moved = std::move(str);
+      assert::are_equal(data, moved.data());
+      assert::is_true(moved == "Hello, World!");
+    }
+
+    void test_method_(empty) {
+      istring str;
+      assert::is_true(str.empty());
+      assert::is_zero(str.size());
+      assert::are_equal("", str.c_str());
+      assert::is_true(istring("") == str);
+    }
+
+    void test_method_(substr_shares_buffer) {
+      istring str = "Hello, World!";
+      istring world = str.substr(7, 5);
+      assert::are_equal(str.data() + 7, world.data());
+      assert::is_true(world == "World");
+      assert::is_true(str.substr(7) == "World!");
+      assert::is_true(str.substr(13).empty());
+      assert::throws<out_of_range>([&] {str.substr(14);});
+    }
+
+    void test_method_(c_str_of_slice_is_terminated) {
+      istring str = "Hello, World!";
+      istring hello = str.substr(0, 5);
+      assert::are_equal("Hello", hello.c_str());
+      assert::are_equal(hello.c_str(), hello.c_str());
+      istring end = str.substr(7);
+      assert::are_equal(end.data(), end.c_str());
+    }
+
+    void test_method_(get_hash_code) {
+      istring str = "Content-Length";
+      assert::are_equal(strings::get_hash_code("Content-Length"), str.get_hash_code());
+      assert::are_equal(str.get_hash_code(), str.get_hash_code());
+      assert::are_equal(str.get_hash_code(), istring(str).get_hash_code());
+      assert::are_equal(strings::get_hash_code("Length"), str.substr(8).get_hash_code());
+      assert::are_equal(str.get_hash_code(), hash<istring> {}(str));
+    }
+
+    void test_method_(compare) {
+      istring str = "abc";
+      assert::is_true(str == "abc");
+      assert::is_true("abc" == str);
+      assert::is_true(str == "abc"s);
+      assert::is_true("abc"s == str);
+      assert::is_true(str == "abc"sv);
+      assert::is_true(str != "abd");
+      assert::is_true(str < istring("abd"));
+      assert::is_true(istring("abd") > str);
+      assert::is_zero(str.compare("abc"));
+      assert::is_true(str.compare("abd"s) < 0);
+    }
+
+    void test_method_(find) {
+      istring str = "Hello, World!";
+      assert::are_equal(4U, str.find('o'));
+      assert::are_equal(8U, str.rfind('o'));
+      assert::are_equal(8U, str.find_last_of("o"));
+      assert::are_equal(7U, str.find("World"s));
+      assert::are_equal(istring::npos, str.find("world"));
+    }
+
+    void test_method_(at) {
+      istring str = "abc";
+      assert::are_equal('b', str.at(1));
+      assert::are_equal('c', str.back());
+      assert::throws<out_of_range>([&] {str.at(3);});
+    }
+
+    void test_method_(conversions) {
+      istring str = "Hello"s;
+      string std_str = str;
+      string_view view = str;
+      assert::are_equal("Hello", std_str);
+      assert::are_equal(str.data(), view.data());
+      assert::is_true(iwstring(L"Hello") == L"Hello");
+      assert::is_true(iu16string(u"Hello") == u"Hello");
+      assert::are_equal("Hello", string(str.begin(), str.end()));
+    }
+
+    void test_method_(unordered_set) {
+      std::unordered_set<istring> set {"one", "two", "three"};
+      assert::are_equal(1U, set.count("two"));
+      assert::is_zero(set.count("four"));
+    }
+
+    void test_method_(copies_across_threads) {
+      istring str(1000, 'a');
+      vector<thread> threads;
+      for (int index = 0; index < 4; ++index)
+        threads.emplace_back([str] {
+          for (int count = 0; count < 10000; ++count) {
+            istring copy = str;
+            istring slice = copy.substr(1);
+          }
+        });
+      for (auto& thread : threads)
+        thread.join();
+      assert::are_equal(1000U, str.size());
+      assert::are_equal('a', str[999]);
+    }
+
+    void test_method_(pmr_allocator) {
+      using pmr_istring = immutable_basic_string<char, char_traits<char>, pmr::polymorphic_allocator<char>>;
+      pmr::monotonic_buffer_resource arena;
+      pmr::monotonic_buffer_resource other;
+      pmr_istring str("Hello, World!", &arena);
+      assert::is_true(str.get_allocator().resource() == &arena);
+      assert::is_true(str.data() == pmr_istring(str, &arena).data());
+      pmr_istring copy(str, &other);
+      assert::is_true(str.data() != copy.data());
+      assert::is_true(copy.get_allocator().resource() == &other);
+      assert::is_true(copy == str);
+      pmr_istring world(str, 7, 5, &other);
+      assert::is_true(world.get_allocator().resource() == &other);
+      assert::are_equal("World", world.c_str());
+    }
+
+    void test_method_(format) {
+      assert::are_equal("Hello, World!", strings::format("{0}, {1}!", istring("Hello"), "World"_is));
+    }
+  };
+}
@@ -0,0 +1,85 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_number_reader) {
+  public:
+    void test_method_(read_from_stream) {
+      istringstream stream("1 2\n3\t-4 ");
+      number_reader<char> reader(stream);
+      vector<int> values;
+      for (auto value : reader.values<int>())
+        values.push_back(value);
+      collection_assert::are_equal({1, 2, 3, -4}, values);
+    }
+
+    void test_method_(read_tokens_straddling_chunks) {
+      istringstream stream("12345 67890 1234567890123");
+      number_reader<char> reader(stream, 4);
+      long long value = 0;
+      assert::is_true(reader.read(value));
+      assert::are_equal(12345LL, value);
+      assert::is_true(reader.read(value));
+      assert::are_equal(67890LL, value);
+      assert::is_true(reader.read(value));
+      assert::are_equal(1234567890123LL, value);
+      assert::is_false(reader.read(value));
+    }
+
+    void test_method_(read_from_memory_with_styles_and_separators) {
+      wstring data = L"0x2A,ff\n10";
+      number_reader<wchar_t> reader(data.data(), data.size(), number_styles::hex_number);
+      reader.separators(L",\n");
+      vector<int> values;
+      for (auto value : reader.values<int>())
+        values.push_back(value);
+      collection_assert::are_equal({42, 255, 16}, values);
+    }
+
+    void test_method_(read_from_file) {
+      string path = "number_reader_test.txt";
+      ofstream(path) << "1.5 2.5\n3";
+      double sum = 0;
+      {
+        auto reader = number_reader<char>::from_file(path);
+        for (auto value : reader.values<double>())
+          sum += value;
+      }
+      remove(path.c_str());
+      assert::are_equal(7.0, sum);
+    }
+
+    void test_method_(read_from_wide_file) {
+      string path = "number_reader_wide_test.txt";
+      u16string content = u"12 -3 4";
+      ofstream(path, ios::binary).write(reinterpret_cast<const char*>(content.data()), static_cast<streamsize>(content.size() * sizeof(char16_t)));
+      vector<int> values;
+      {
+        auto reader = number_reader<char16_t>::from_file(path);
+        for (auto value : reader.values<int>())
+          values.push_back(value);
+      }
+      ofstream(path, ios::binary | ios::app) << 'x';
+      assert::throws<std::invalid_argument>([&]{number_reader<char16_t>::from_file(path);});
+      remove(path.c_str());
+      collection_assert::are_equal({12, -3, 4}, values);
+    }
+
+    void test_method_(read_invalid_token) {
+      istringstream stream("1 two");
+      number_reader<char> reader(stream);
+      int value = 0;
+      assert::is_true(reader.read(value));
+      assert::throws<std::invalid_argument>([&]{reader.read(value);});
+    }
+  };
+}
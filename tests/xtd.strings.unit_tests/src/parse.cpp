@@ -3,6 +3,7 @@
 
 using namespace std;
 using namespace std::string_literals;
+using namespace std::string_view_literals;
 using namespace xtd;
 using namespace xtd::tunit;
 
@@ -12,5 +13,74 @@ namespace unit_tests {
     void test_method_(parse_string) {
       assert::are_equal("string", xtd::parse<string>("string"));
     }
+    
+    void test_method_(parse_wstring) {
+      assert::are_equal(L"string"s, xtd::parse<wstring>(L"string"s));
+    }
+    
+    void test_method_(parse_int_from_wstring) {
+      assert::are_equal(-42, xtd::parse<int>(L"-42"s));
+    }
+    
+    void test_method_(parse_int_from_u16string) {
+      assert::are_equal(42, xtd::parse<int>(u" 42 "s));
+    }
+    
+    void test_method_(parse_hex_from_u32string) {
+      assert::are_equal(42, xtd::parse<int>(U"0x2A"s, number_styles::hex_number));
+    }
+    
+    void test_method_(parse_double_from_wstring) {
+      assert::are_equal(-42.5, xtd::parse<double>(L"-42.5"s));
+    }
+    
+    void test_method_(parse_double_with_trailing_characters) {
+      assert::are_equal(1e5, xtd::parse<double>("1e5"s));
+      assert::throws<std::invalid_argument>([]{xtd::parse<double>("1e5e5"s);});
+      assert::throws<std::invalid_argument>([]{xtd::parse<double>(L"1.5.5"s);});
+      assert::throws<std::invalid_argument>([]{xtd::parse<int>("1e5e5"s, number_styles::allow_exponent);});
+    }
+    
+    void test_method_(parse_int_from_string_view) {
+      assert::are_equal(42, xtd::parse<int>("4242"sv.substr(2)));
+    }
+    
+    void test_method_(parse_int_out_of_range) {
+      assert::throws<std::out_of_range>([]{xtd::parse<signed char>("128");});
+    }
+    
+    void test_method_(parse_int_without_digits) {
+      assert::throws<std::invalid_argument>([]{xtd::parse<int>(L""s);});
+    }
+    
+    void test_method_(try_parse_with_styles) {
+      int value = 0;
+      assert::is_true(xtd::try_parse(u"2A"s, value, number_styles::hex_number));
+      assert::are_equal(42, value);
+      assert::is_false(xtd::try_parse(U"2A"s, value));
+      assert::are_equal(42, value);
+    }
+    
+    void test_method_(parse_bool) {
+      assert::is_true(xtd::parse<bool>(" TRUE\n"));
+      assert::is_false(xtd::parse<bool>(L"False"s));
+      assert::is_true(xtd::parse<bool>(u"1"s));
+      assert::throws<std::invalid_argument>([]{xtd::parse<bool>("yes");});
+    }
+    
+    void test_method_(parse_bool_with_styles) {
+      assert::is_true(xtd::parse<bool>("Yes", boolean_styles::allow_yes_no));
+      assert::is_false(xtd::parse<bool>(U"OFF"s, boolean_styles::allow_on_off));
+      assert::throws<std::invalid_argument>([]{xtd::parse<bool>(" true", boolean_styles::none);});
+      assert::throws<std::invalid_argument>([]{xtd::parse<bool>("1", boolean_styles::allow_yes_no);});
+    }
+    
+    void test_method_(try_parse_bool) {
+      bool value = false;
+      assert::is_true(xtd::try_parse("\ton ", value, boolean_styles::any));
+      assert::is_true(value);
+      assert::is_false(xtd::try_parse("maybe"s, value));
+      assert::is_true(value);
+    }
   };
 }
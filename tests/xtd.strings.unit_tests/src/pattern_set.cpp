@@ -0,0 +1,79 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_pattern_set) {
+  public:
+    void test_method_(contains_any) {
+      pattern_set<char> patterns {{"he", "she", "his", "hers"}};
+      assert::is_true(patterns.contains_any("ushers"));
+      assert::is_true(patterns.contains_any("this"));
+      assert::is_false(patterns.contains_any("sh"));
+      assert::is_false(patterns.contains_any(""));
+    }
+
+    void test_method_(contains_any_empty_set) {
+      pattern_set<char> patterns;
+      assert::is_false(patterns.contains_any("abc"));
+      assert::are_equal(pattern_set<char>::npos, patterns.index_of_any("abc").index);
+    }
+
+    void test_method_(index_of_any) {
+      pattern_set<char> patterns {{"he", "she", "his", "hers"}};
+      auto result = patterns.index_of_any("ushers");
+      assert::are_equal(1U, result.index);
+      assert::are_equal(3U, result.length);
+      assert::are_equal(1U, result.pattern);
+      result = patterns.index_of_any("ushers", 2);
+      assert::are_equal(2U, result.index);
+      assert::are_equal(4U, result.length);
+      assert::are_equal(3U, result.pattern);
+      assert::are_equal(pattern_set<char>::npos, patterns.index_of_any("ushers", 5).index);
+    }
+
+    void test_method_(index_of_any_leftmost) {
+      pattern_set<char> patterns {{"bcd", "abcdef", "x"}};
+      auto result = patterns.index_of_any("zabcdex abcdefx");
+      assert::are_equal(2U, result.index);
+      assert::are_equal(0U, result.pattern);
+      result = patterns.index_of_any("zabcdefx");
+      assert::are_equal(1U, result.index);
+      assert::are_equal(1U, result.pattern);
+    }
+
+    void test_method_(index_of_any_ignore_case) {
+      pattern_set<char> patterns {{"Error", "WARN"}, true};
+      assert::is_true(patterns.ignore_case());
+      auto result = patterns.index_of_any("2024 [warn] disk; [ERROR] io");
+      assert::are_equal(6U, result.index);
+      assert::are_equal(1U, result.pattern);
+      assert::is_false(pattern_set<char> {{"Error"}}.contains_any("ERROR"));
+    }
+
+    void test_method_(index_of_any_wstring) {
+      pattern_set<wchar_t> patterns {{L"été", L"中文"}};
+      auto result = patterns.index_of_any(L"un 中文 été");
+      assert::are_equal(3U, result.index);
+      assert::are_equal(1U, result.pattern);
+    }
+
+    void test_method_(for_each_match) {
+      pattern_set<char> patterns {{"he", "she", "his", "hers"}};
+      vector<string> matches;
+      patterns.for_each_match("ushers", [&](const pattern_set<char>::match& match) {matches.push_back(to_string(match.index) + ":" + patterns.patterns()[match.pattern]);});
+      collection_assert::are_equal({"1:she", "2:he", "2:hers"}, matches);
+    }
+
+    void test_method_(for_each_match_stop) {
+      pattern_set<char> patterns {{"a"}};
+      size_t count = 0;
+      patterns.for_each_match("aaaaa", [&](const pattern_set<char>::match&) {return ++count < 2;});
+      assert::are_equal(2U, count);
+    }
+  };
+}
@@ -0,0 +1,56 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_prefix_trie) {
+  public:
+    void test_method_(match_longest_prefix) {
+      prefix_trie<char> routes {{"/api/", "/api/v2/", "/static/"}};
+      assert::are_equal(1U, routes.match("/api/v2/users"));
+      assert::are_equal(0U, routes.match("/api/v1/users"));
+      assert::are_equal(2U, routes.match("/static/"));
+    }
+
+    void test_method_(match_without_prefix) {
+      prefix_trie<char> routes {{"/api/", "/static/"}};
+      assert::are_equal(prefix_trie<char>::npos, routes.match("/ap"));
+      assert::are_equal(prefix_trie<char>::npos, routes.match(""));
+      assert::is_false(prefix_trie<char>().matches("/api/"));
+    }
+
+    void test_method_(match_duplicate_and_empty_prefix) {
+      prefix_trie<char> routes {{"", "/a", "/a"}};
+      assert::are_equal(0U, routes.match("/b"));
+      assert::are_equal(1U, routes.match("/a/b"));
+    }
+
+    void test_method_(match_ignore_case) {
+      prefix_trie<wchar_t> schemes {{L"http://", L"https://", L"ftp://"}, true};
+      assert::is_true(schemes.ignore_case());
+      assert::are_equal(1U, schemes.match(L"HTTPS://example.com"));
+      assert::is_false(prefix_trie<wchar_t>({L"http://"}).matches(L"HTTP://example.com"));
+    }
+
+    void test_method_(match_many_prefixes) {
+      vector<string> values;
+      for (auto index = 0; index < 500; ++index)
+        values.push_back("/route" + to_string(index) + "/");
+      prefix_trie<char> routes {values};
+      assert::are_equal(250U, routes.match("/route250/index.html"));
+      assert::are_equal(prefix_trie<char>::npos, routes.match("/route500/index.html"));
+    }
+
+    void test_method_(match_longest_suffix) {
+      suffix_trie<char> extensions {{".h", ".hpp", ".cpp", ".tar.gz", ".gz"}, true};
+      assert::are_equal(2U, extensions.match("main.CPP"));
+      assert::are_equal(3U, extensions.match("archive.tar.gz"));
+      assert::are_equal(4U, extensions.match("archive.gz"));
+      assert::are_equal(suffix_trie<char>::npos, extensions.match("README"));
+    }
+  };
+}
@@ -0,0 +1,142 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_rope) {
+  public:
+    void test_method_(create) {
+      rope<char> value = "Hello, World!";
+      assert::are_equal(13U, value.size());
+      assert::are_equal("Hello, World!", value.to_string());
+      assert::is_true(rope<char>().empty());
+      assert::is_true(rope<char>("").empty());
+      assert::are_equal('W', value[7]);
+      assert::throws<out_of_range>([&] {value.at(13);});
+    }
+
+    void test_method_(istring_buffer_is_shared) {
+      istring str(1000, 'a');
+      rope<char> value = str;
+      assert::are_equal(str.data(), value.to_istring().data());
+      assert::are_equal(str.data() + 10, (*value.substr(10, 500).pieces().begin()).data());
+    }
+
+    void test_method_(insert) {
+      rope<char> value = "Hello World";
+      value.insert(5, ",").insert(value.size(), "!").insert(0, ">> ");
+      assert::is_true(value == ">> Hello, World!");
+      assert::throws<out_of_range>([&] {value.insert(value.size() + 1, "x");});
+    }
+
+    void test_method_(remove_and_replace) {
+      rope<char> value = "Hello, World!";
+      value.remove(5, 7);
+      assert::is_true(value == "Hello!");
+      value.replace(0, 5, "Goodbye");
+      assert::is_true(value == "Goodbye!");
+      value.remove(7);
+      assert::is_true(value == "Goodbye");
+    }
+
+    void test_method_(replace_all) {
+      rope<char> value = "${HOST}:80, ${HOST}:443";
+      value.replace("${HOST}", "example.com");
+      assert::is_true(value == "example.com:80, example.com:443");
+      value.replace("missing", "x");
+      assert::is_true(value == "example.com:80, example.com:443");
+      assert::throws<invalid_argument>([&] {value.replace("", "x");});
+    }
+
+    void test_method_(large_document_edits) {
+      rope<char> value;
+      string expected;
+      for (int index = 0; index < 20000; ++index) {
+        auto line = strings::format("line {0}\n", index);
+        size_t position = (static_cast<size_t>(index) * 7919) % (expected.size() + 1);
+        value.insert(position, line);
+        expected.insert(position, line);
+      }
+      assert::are_equal(expected, value.to_string());
+      assert::is_true(value.depth() < 40);
+      for (int index = 0; index < 1000; ++index) {
+        size_t position = (static_cast<size_t>(index) * 104729) % expected.size();
+        value.remove(position, 100);
+        expected.erase(position, 100);
+      }
+      assert::are_equal(expected, value.to_string());
+    }
+
+    void test_method_(copy_is_not_affected_by_edits) {
+      rope<char> value = "abc";
+      value.append(string(1000, 'd'));
+      rope<char> copy = value;
+      value.remove(0, 3);
+      assert::are_equal(1003U, copy.size());
+      assert::are_equal(1000U, value.size());
+    }
+
+    void test_method_(substr) {
+      rope<char> value = rope<char>("Hello, ").append(string(300, '-')).append("World!");
+      assert::is_true(value.substr(0, 5) == "Hello");
+      assert::is_true(value.substr(307) == "World!");
+      assert::is_true(value.substr(value.size()).empty());
+      assert::throws<out_of_range>([&] {value.substr(value.size() + 1);});
+    }
+
+    void test_method_(index_of) {
+      rope<char> value = rope<char>(string(300, 'a')).append("Hel").append(string(300, 'b')).insert(303, "lo, World");
+      assert::are_equal(300U, value.index_of("Hello"));
+      assert::are_equal(307U, value.index_of('W'));
+      assert::are_equal(300U, value.index_of('H', 300));
+      assert::are_equal(rope<char>::npos, value.index_of('H', 301));
+      assert::are_equal(rope<char>::npos, value.index_of("world"));
+    }
+
+    void test_method_(split) {
+      rope<char> value = rope<char>("red green").append(string(300, ' ')).append("blue");
+      auto words = value.split({' '}, string_split_options::remove_empty_entries);
+      assert::are_equal(3U, words.size());
+      assert::is_true(words[0] == "red");
+      assert::is_true(words[1] == "green");
+      assert::is_true(words[2] == "blue");
+      assert::are_equal(4U, rope<char>("a,b,,c").split({','}).size());
+    }
+
+    void test_method_(pieces) {
+      rope<char> value = rope<char>(string(300, 'a')).append(string(300, 'b'));
+      size_t count = 0, length = 0;
+      for (string_view piece : value.pieces()) {
+        ++count;
+        length += piece.size();
+      }
+      assert::are_equal(2U, count);
+      assert::are_equal(600U, length);
+      assert::are_equal(600, static_cast<int>(std::distance(value.begin(), value.end())));
+    }
+
+    void test_method_(view) {
+      rope<char> value = rope<char>(string(300, 'a')).append("TODO").append(string(300, 'b'));
+      assert::is_true(strings::contains(value.view(), "TODO"sv));
+      assert::is_zero(value.depth());
+      assert::are_equal(value.view().data(), value.to_istring().data());
+    }
+
+    void test_method_(compare_and_write) {
+      rope<char> a = rope<char>(string(300, 'a')).append("b");
+      rope<char> b = rope<char>(string(100, 'a')).append(string(200, 'a') + "b");
+      assert::is_true(a == b);
+      assert::is_true(a != rope<char>("a"));
+      assert::is_true(a == string(300, 'a') + "b");
+      stringstream stream;
+      stream << a;
+      assert::are_equal(a.to_string(), stream.str());
+    }
+  };
+}
@@ -0,0 +1,77 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_searcher) {
+  public:
+    void test_method_(find_character) {
+      searcher<char> value {"x"};
+      assert::are_equal(3U, value.find("abcxx"));
+      assert::are_equal(4U, value.find("abcxx", 4));
+      assert::are_equal(4U, value.find_last("abcxx"));
+      assert::are_equal(searcher<char>::npos, value.find("abc"));
+    }
+
+    void test_method_(find_empty_value) {
+      searcher<char> value;
+      assert::are_equal(2U, value.find("abc", 2));
+      assert::are_equal(searcher<char>::npos, value.find("abc", 4));
+      assert::are_equal(3U, value.find_last("abc"));
+    }
+
+    void test_method_(find_short_value) {
+      searcher<char> value {"needle"};
+      string text = string(100, 'n') + "needle" + string(10, 'e') + "needle";
+      assert::are_equal(100U, value.find(text));
+      assert::are_equal(116U, value.find(text, 101));
+      assert::are_equal(116U, value.find_last(text));
+      assert::are_equal(100U, value.find_last(text, 115));
+    }
+
+    void test_method_(find_medium_value) {
+      searcher<wchar_t> value {L"the quick brown fox jumps"};
+      wstring text = L"the quick brown fox jumped; the quick brown fox jumps over the lazy dog";
+      assert::are_equal(28U, value.find(text));
+      assert::are_equal(searcher<wchar_t>::npos, value.find(text, 29));
+    }
+
+    void test_method_(find_long_periodic_value) {
+      string needle = string(70, 'a') + "b";
+      searcher<char> value {needle};
+      string text = string(500, 'a') + "b" + string(100, 'a');
+      assert::are_equal(430U, value.find(text));
+      assert::are_equal(430U, value.find_last(text));
+      assert::are_equal(searcher<char>::npos, value.find(string(1000, 'a')));
+    }
+
+    void test_method_(find_ignore_case) {
+      searcher<char> value {"ERROR", string_comparison::ordinal_ignore_case};
+      assert::are_equal("error"s, value.value());
+      assert::are_equal(string_comparison::ordinal_ignore_case, value.comparison_type());
+      string text = string(40, '.') + "Error: " + string(40, '.') + "eRRoR";
+      assert::are_equal(40U, value.find(text));
+      assert::are_equal(87U, value.find_last(text));
+    }
+
+    void test_method_(find_unicode_ignore_case) {
+      searcher<wchar_t> value {L"\u03A3\u03A6\u0391\u039B\u039C\u0391", string_comparison::ordinal_ignore_case};
+      assert::are_equal(L"\u03C3\u03C6\u03B1\u03BB\u03BC\u03B1"s, value.value());
+      wstring text = L"... \u03A3\u03C6\u03AC\u03BB\u03BC\u03B1, \u03C3\u03C6\u03B1\u03BB\u03BC\u03B1 ...";
+      assert::are_equal(12U, value.find(text));
+      assert::are_equal(12U, value.find_last(text));
+    }
+
+    void test_method_(find_long_value_ignore_case) {
+      u16string needle = u"0123456789 the quick brown fox jumps over the lazy dog 0123456789";
+      searcher<char16_t> value {needle, string_comparison::ordinal_ignore_case};
+      u16string text = u"... 0123456789 THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 0123456789 ...";
+      assert::are_equal(4U, value.find(text));
+      assert::are_equal(searcher<char16_t>::npos, searcher<char16_t>(needle).find(text));
+    }
+  };
+}
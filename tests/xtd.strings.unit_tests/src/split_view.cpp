@@ -0,0 +1,59 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_split_view) {
+  public:
+    template<typename range_t>
+    static vector<string> to_vector(const range_t& range) {
+      vector<string> result;
+      for (auto token : range)
+        result.emplace_back(token);
+      return result;
+    }
+
+    void test_method_(split_char) {
+      collection_assert::are_equal({"", "a", "b", "", "c"}, to_vector(split_view<char, char>(",a,b,,c,", ',')));
+    }
+
+    void test_method_(split_string) {
+      collection_assert::are_equal({"a", "b", "", "c"}, to_vector(split_view<char, string_view>("a, b, , c", ", ")));
+      collection_assert::are_equal({"a, b"}, to_vector(split_view<char, string_view>("a, b", "")));
+    }
+
+    void test_method_(split_char_set) {
+      char_set<char> separators {' ', '\t'};
+      collection_assert::are_equal({"a", "b", "c"}, to_vector(split_view<char, char_set<char>>(" a\t b  c", separators, string_split_options::remove_empty_entries)));
+    }
+
+    void test_method_(split_searcher) {
+      searcher<char> separator {"AND", string_comparison::ordinal_ignore_case};
+      collection_assert::are_equal({"x ", " y ", " z"}, to_vector(split_view<char, searcher<char>>("x and y AND z", separator)));
+    }
+
+    void test_method_(split_count) {
+      collection_assert::are_equal({"a", "b", "c,d"}, to_vector(split_view<char, char>("a,b,c,d", ',', 3)));
+      collection_assert::are_equal({"a,b,c,d"}, to_vector(split_view<char, char>("a,b,c,d", ',', 1)));
+      assert::is_zero(to_vector(split_view<char, char>("a,b,c,d", ',', 0)).size());
+    }
+
+    void test_method_(split_empty_string) {
+      assert::is_zero(to_vector(split_view<char, char>("", ',')).size());
+    }
+
+    void test_method_(iterator) {
+      split_view<char, char> tokens("a,b", ',');
+      auto iterator = tokens.begin();
+      assert::are_equal("a", string(*iterator));
+      assert::are_equal(1U, (iterator++)->size());
+      assert::are_equal("b", string(*iterator));
+      assert::is_true(++iterator == tokens.end());
+      assert::is_true(tokens.begin() != tokens.end());
+    }
+  };
+}
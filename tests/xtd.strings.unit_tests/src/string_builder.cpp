@@ -0,0 +1,145 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+#include <cstdio>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_string_builder) {
+  public:
+    void test_method_(append) {
+      string_builder<char> builder;
+      builder.append("Hello").append(", "s).append("World"sv).append('!');
+      assert::are_equal("Hello, World!", builder.to_string());
+      assert::are_equal(13U, builder.size());
+      assert::are_equal(1U, builder.chunk_count());
+    }
+
+    void test_method_(append_values) {
+      string_builder<char> builder;
+      builder.append(42).append(' ').append(true).append(' ').append(3, '*').append(' ').append(istring("istring"));
+      assert::are_equal("42 1 *** istring", builder.to_string());
+    }
+
+    void test_method_(append_across_chunks) {
+      string_builder<char, 16> builder;
+      string expected;
+      for (int index = 0; index < 5000; ++index) {
+        builder.append(index).push_back(',');
+        expected += std::to_string(index) + ',';
+      }
+      builder.append(string(20000, 'x'));
+      expected += string(20000, 'x');
+      assert::is_true(builder.chunk_count() > 2);
+      assert::are_equal(expected, builder.to_string());
+      assert::are_equal('x', builder[expected.size() - 1]);
+      assert::throws<out_of_range>([&] {builder[expected.size()];});
+    }
+
+    void test_method_(append_format) {
+      string_builder<char> builder;
+      builder.append_format("{0}={1:D3}", "key", 7).append_format("; {0}"s, 1.5);
+      assert::are_equal("key=007; 1.5", builder.to_string());
+    }
+
+    void test_method_(append_join) {
+      string_builder<char> builder;
+      builder.append('[').append_join(", ", vector<string> {"red", "green", "blue"}).append("] ").append_join("+", {1, 2, 3});
+      assert::are_equal("[red, green, blue] 1+2+3", builder.to_string());
+    }
+
+    void test_method_(insert) {
+      string_builder<char, 8> builder;
+      builder.append("0123456789abcdef");
+      builder.insert(6, "--");
+      assert::are_equal("012345--6789abcdef", builder.to_string());
+      builder.insert(0, "<").insert(builder.size(), ">");
+      assert::are_equal("<012345--6789abcdef>", builder.to_string());
+      builder.insert(3, string(100, '.'));
+      assert::are_equal("<01" + string(100, '.') + "2345--6789abcdef>", builder.to_string());
+      assert::throws<out_of_range>([&] {builder.insert(builder.size() + 1, "x");});
+    }
+
+    void test_method_(remove) {
+      string_builder<char, 8> builder;
+      builder.append("0123456789").append(string(10000, 'x')).append("abcdef");
+      builder.remove(5, 10005);
+      assert::are_equal("01234abcdef", builder.to_string());
+      builder.remove(9);
+      assert::are_equal("01234abcd", builder.to_string());
+      builder.remove(0, 5);
+      assert::are_equal("abcd", builder.to_string());
+      builder.append("efgh");
+      assert::are_equal("abcdefgh", builder.to_string());
+    }
+
+    void test_method_(replace) {
+      string_builder<char, 4> builder;
+      builder.append("ab").append("cdab").append("cd").append("abcd");
+      builder.replace("abcd", "[]");
+      assert::are_equal("[][][]", builder.to_string());
+      builder.replace('[', '(').replace(']', ')');
+      assert::are_equal("()()()", builder.to_string());
+      builder.replace(2, 2, "<abcdefghij>");
+      assert::are_equal("()<abcdefghij>()", builder.to_string());
+      builder.replace("not found", "x");
+      assert::are_equal("()<abcdefghij>()", builder.to_string());
+      assert::throws<invalid_argument>([&] {builder.replace("", "x");});
+    }
+
+    void test_method_(index_of) {
+      string_builder<char, 4> builder;
+      builder.append("Hel").append("lo, Wor").append("ld!");
+      assert::are_equal(7U, builder.index_of("World"));
+      assert::are_equal(3U, builder.index_of("l", 3));
+      assert::are_equal(string_builder<char>::npos, builder.index_of("world"));
+    }
+
+    void test_method_(copy_and_move) {
+      string_builder<char, 8> builder;
+      builder.append("0123456789");
+      string_builder<char, 8> copy = builder;
+      string_builder<char, 8> moved = std::move(builder);
+      copy.append('a');
+      assert::are_equal("0123456789a", copy.to_string());
+      assert::are_equal("0123456789", moved.to_string());
+      assert::is_true(builder.empty());
+      moved.clear();
+      assert::is_true(moved.empty());
+      assert::are_equal(1U, moved.chunk_count());
+    }
+
+    void test_method_(write_to_stream) {
+      string_builder<char, 8> builder;
+      builder.append("0123456789").append(string(10000, 'x'));
+      stringstream stream;
+      stream << builder;
+      assert::are_equal(builder.to_string(), stream.str());
+    }
+
+    void test_method_(write_to_file_descriptor) {
+      string_builder<char, 8> builder;
+      for (int index = 0; index < 1000; ++index)
+        builder.append_format("line {0}\n", index).insert(0, "#");
+      FILE* file = tmpfile();
+      builder.write_to(fileno(file));
+      rewind(file);
+      string content(builder.size() + 1, '\0');
+      assert::are_equal(builder.size(), fread(content.data(), 1, content.size(), file));
+      fclose(file);
+      content.pop_back();
+      assert::are_equal(builder.to_string(), content);
+    }
+
+    void test_method_(wide_string) {
+      string_builder<wchar_t> builder;
+      builder.append(L"\u03A3").append(42).append_format(L" {0}", L"\u03C6");
+      assert::are_equal(L"\u03A342 \u03C6", builder.to_string());
+    }
+  };
+}
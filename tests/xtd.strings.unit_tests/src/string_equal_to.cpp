@@ -0,0 +1,33 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_string_equal_to) {
+  public:
+    void test_method_(equal_ordinal) {
+      string_equal_to<char> equal_to;
+      assert::are_equal(string_comparison::ordinal, equal_to.comparison_type());
+      assert::is_true(equal_to("abc"s, "abc"sv));
+      assert::is_false(equal_to("abc", "ABC"));
+      assert::is_false(equal_to("abc", "abcd"));
+    }
+
+    void test_method_(equal_ignore_case) {
+      string_equal_to<char> equal_to {string_comparison::ordinal_ignore_case};
+      assert::is_true(equal_to("Content-Length"s, "CONTENT-length"));
+      assert::is_false(equal_to("Content-Length", "Content-Lengths"));
+      assert::is_false(equal_to("@", "`"));
+    }
+
+    void test_method_(equal_ignore_case_wide_strings) {
+      string_equal_to<char16_t> equal_to {string_comparison::ordinal_ignore_case};
+      assert::is_true(equal_to(u"\u041F\u0420\u0418\u0412\u0415\u0422", u"\u043F\u0440\u0438\u0432\u0435\u0442"));
+      assert::is_false(equal_to(u"\u041F\u0420\u0418\u0412\u0415\u0422", u"\u043F\u0440\u0438\u0432\u0435"));
+    }
+  };
+}
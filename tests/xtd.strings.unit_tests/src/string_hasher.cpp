@@ -0,0 +1,53 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+#include <unordered_map>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_string_hasher) {
+  public:
+    void test_method_(hash_ordinal) {
+      string_hasher<char> hasher;
+      assert::are_equal(string_comparison::ordinal, hasher.comparison_type());
+      assert::are_equal(hasher("Content-Length"s), hasher("Content-Length"sv));
+      assert::are_equal(hasher("Content-Length"), hasher("xContent-Lengthx"sv.substr(1, 14)));
+      assert::are_not_equal(hasher("Content-Length"), hasher("content-length"));
+      assert::are_equal(strings::get_hash_code("Content-Length"), hasher("Content-Length"));
+    }
+
+    void test_method_(hash_ignore_case) {
+      string_hasher<char> hasher {string_comparison::ordinal_ignore_case};
+      assert::are_equal(hasher("Content-Length"), hasher("CONTENT-length"));
+      assert::are_not_equal(hasher("Content-Length"), hasher("Content-Lengths"));
+      string long_key(1000, 'A');
+      long_key[700] = 'z';
+      assert::are_equal(hasher(long_key), hasher(strings::to_lower(long_key)));
+      assert::are_equal(hasher(""), hasher(string()));
+    }
+
+    void test_method_(hash_ignore_case_wide_strings) {
+      string_hasher<wchar_t> hasher {string_comparison::ordinal_ignore_case};
+      assert::are_equal(hasher(L"\u03A3\u03A6\u0391\u039B\u039C\u0391"), hasher(L"\u03C3\u03C6\u03B1\u03BB\u03BC\u03B1"));
+      assert::are_equal(hasher(L"\u03C3\u03C2"), hasher(L"\u03A3\u03A3"));
+    }
+
+    void test_method_(hash_seed) {
+      string_hasher<char> hasher {string_comparison::ordinal, 42};
+      assert::are_equal(hasher("key"), string_hasher<char>(string_comparison::ordinal, 42)("key"));
+      assert::are_not_equal(hasher("key"), string_hasher<char>(string_comparison::ordinal, 43)("key"));
+    }
+
+    void test_method_(unordered_map_ignore_case) {
+      unordered_map<string, int, string_hasher<char>, string_equal_to<char>> headers {0, string_hasher<char> {string_comparison::ordinal_ignore_case}, string_equal_to<char> {string_comparison::ordinal_ignore_case}};
+      headers["Content-Length"] = 42;
+      headers["CONTENT-LENGTH"] = 24;
+      headers["Host"] = 1;
+      assert::are_equal(2U, headers.size());
+      assert::are_equal(24, headers.at("content-length"));
+    }
+  };
+}
@@ -0,0 +1,105 @@
+#include <xtd/xtd.strings>
+#include <xtd/xtd.tunit>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace std::string_literals;
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_string_pool) {
+  public:
+    void test_method_(intern) {
+      string_pool<char> pool;
+      interned_istring a = pool.intern("http.requests");
+      interned_istring b = pool.intern("http.requests"s);
+      interned_istring c = pool.intern("http.responses"sv);
+      assert::is_true(a == b);
+      assert::is_true(a != c);
+      assert::are_equal(a.c_str(), b.c_str());
+      assert::are_equal("http.requests", a.c_str());
+      assert::are_equal(13U, a.size());
+      assert::are_equal(2U, pool.size());
+    }
+
+    void test_method_(intern_istring) {
+      string_pool<char> pool;
+      istring str = "host";
+      assert::is_true(pool.intern(str) == pool.intern("host"));
+      assert::is_true(pool.intern(str).to_istring() == str);
+      assert::are_equal(1U, pool.size());
+    }
+
+    void test_method_(intern_empty) {
+      string_pool<char> pool;
+      assert::is_true(pool.intern("").empty());
+      assert::is_true(pool.intern("") == interned_istring());
+      assert::are_equal("", interned_istring().c_str());
+      assert::is_zero(pool.size());
+    }
+
+    void test_method_(get_hash_code) {
+      string_pool<char> pool;
+      assert::are_equal(strings::get_hash_code("region"), pool.intern("region").get_hash_code());
+      assert::are_equal(strings::get_hash_code(""), interned_istring().get_hash_code());
+      assert::are_equal(pool.intern("region").get_hash_code(), hash<interned_istring> {}(pool.intern("region")));
+    }
+
+    void test_method_(many_strings) {
+      string_pool<char> pool;
+      vector<interned_istring> interned;
+      for (int index = 0; index < 10000; ++index)
+        interned.push_back(pool.intern(strings::format("tag{0}", index)));
+      interned.push_back(pool.intern(string(100000, 'x')));
+      assert::are_equal(10001U, pool.size());
+      for (int index = 0; index < 10000; ++index)
+        assert::is_true(interned[index] == pool.intern(strings::format("tag{0}", index)));
+      assert::are_equal(10001U, pool.size());
+      assert::are_equal(100000U, interned.back().size());
+    }
+
+    void test_method_(intern_wstring) {
+      string_pool<wchar_t> pool;
+      interned_iwstring str = pool.intern(L"\u03A3\u03C6");
+      assert::is_true(str == pool.intern(wstring(L"\u03A3\u03C6")));
+      assert::is_true(wstring_view(str) == L"\u03A3\u03C6");
+    }
+
+    void test_method_(unordered_map) {
+      auto& pool = string_pool<char>::shared();
+      std::unordered_map<interned_istring, int> metrics;
+      metrics[pool.intern("cpu")] += 1;
+      metrics[pool.intern("cpu"s)] += 1;
+      metrics[pool.intern("memory")] += 1;
+      assert::are_equal(2U, metrics.size());
+      assert::are_equal(2, metrics[pool.intern("cpu")]);
+    }
+
+    void test_method_(intern_across_threads) {
+      string_pool<char> pool;
+      vector<vector<interned_istring>> results(4);
+      vector<thread> threads;
+      for (size_t index = 0; index < results.size(); ++index)
+        threads.emplace_back([&pool, &result = results[index]] {
+          for (int count = 0; count < 1000; ++count)
+            result.push_back(pool.intern(to_string(count)));
+        });
+      for (auto& thread : threads)
+        thread.join();
+      assert::are_equal(1000U, pool.size());
+      for (size_t index = 1; index < results.size(); ++index)
+        assert::is_true(results[0] == results[index]);
+    }
+
+    void test_method_(write) {
+      string_pool<char> pool;
+      stringstream stream;
+      stream << pool.intern("key");
+      assert::are_equal("key", stream.str());
+    }
+  };
+}
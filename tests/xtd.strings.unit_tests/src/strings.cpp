@@ -1,8 +1,11 @@
 #include <xtd/xtd.strings>
 #include <xtd/xtd.tunit>
+#include <clocale>
+#include <memory_resource>
 
 using namespace std;
 using namespace std::string_literals;
+using namespace std::string_view_literals;
 using namespace xtd;
 using namespace xtd::tunit;
 
@@ -23,6 +26,19 @@ namespace unit_tests {
       assert::is_zero(strings::compare("a", "A", true));
     }
     
+    void test_method_(compare_ignore_case_unicode) {
+      assert::is_zero(strings::compare(L"\u03A3\u038A\u03A3\u03A5\u03A6\u039F\u03A3"s, L"\u03C3\u03AF\u03C3\u03C5\u03C6\u03BF\u03C2"s, true));
+      assert::is_true(strings::equals(U"\u041F\u0420\u0418\u0412\u0415\u0422"s, U"\u043F\u0440\u0438\u0432\u0435\u0442"s, true));
+      assert::is_true(strings::equals(u"\u13A0\u13F0"s, u"\uAB70\u13F8"s, true));
+      assert::is_false(strings::equals(L"stra\u00DFe"s, L"STRASSE"s, true));
+    }
+    
+    void test_method_(compare_ignore_case_non_ascii_bytes) {
+      assert::is_negative(strings::compare("a", "\xC3\xA9", string_comparison::ordinal_ignore_case));
+      assert::is_positive(strings::compare("\xC3\xA9", "A", string_comparison::ordinal_ignore_case));
+      assert::is_negative(strings::compare("a", "\xC3\xA9", string_comparison::ordinal));
+    }
+    
     void test_method_(compare_index_length) {
       assert::is_not_zero(strings::compare("abcde", 1, "debcaf", 1, 2));
       assert::is_zero(strings::compare("abcde", 1, "debcaf", 2, 2));
@@ -35,6 +51,17 @@ namespace unit_tests {
     void test_method_(compare_index_length_ingore_case_true) {
       assert::is_zero(strings::compare("abcde", 1, "DEBCAF", 2, 2, true));
     }
+    
+    void test_method_(compare_string_view) {
+      assert::is_zero(strings::compare("xabcx"sv.substr(1, 3), "ABC"sv, true));
+      assert::is_negative(strings::compare(L"abc"sv, L"abd"sv));
+    }
+    
+    void test_method_(compare_ignore_case_long_strings) {
+      assert::is_zero(strings::compare("The Quick Brown Fox Jumps Over The Lazy Dog"s, "the quick brown fox jumps over the lazy dog"s, true));
+      assert::is_negative(strings::compare("the quick brown fox jumps over the lazy cat"s, "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG"s, true));
+      assert::is_positive(strings::compare("the quick brown fox jumps over the lazy ~og"s, "THE QUICK BROWN FOX JUMPS OVER THE LAZY dog"s, true));
+    }
 
     void test_method_(concat_char_pointers) {
       assert::are_equal("abcd", strings::concat("a", "b", "c", "d"));
@@ -52,10 +79,30 @@ namespace unit_tests {
       assert::are_equal("12434.2", strings::concat("1", 24, '3', 4.2));
     }
     
+    void test_method_(concat_bool_and_floating_points) {
+      assert::are_equal("10 0.333333 1e+300 -2.5", strings::concat(true, false, ' ', 1.0 / 3, ' ', 1e300, ' ', -2.5f));
+    }
+    
+    void test_method_(concat_floating_points_ignore_c_locale) {
+      string previous = setlocale(LC_NUMERIC, nullptr);
+      setlocale(LC_NUMERIC, "de_DE.UTF-8");
+      string result = strings::concat(0.5, ' ', 1e6, ' ', 0.0001, ' ', 2.25L);
+      setlocale(LC_NUMERIC, previous.c_str());
+      assert::are_equal("0.5 1e+06 0.0001 2.25", result);
+    }
+    
+    void test_method_(concat_many_arguments) {
+      assert::are_equal("a1b2c3d4e5", strings::concat("a", 1, "b"s, 2, "c"sv, 3, 'd', 4, "e", 5U));
+    }
+    
     void test_method_(concat_initializer_list) {
       assert::are_equal(L"1234", strings::concat({L"1", L"2", L"3", L"4"}));
     }
     
+    void test_method_(concat_wstrings) {
+      assert::are_equal(L"ab5c", strings::concat(L"a"s, L"b", 5, L'c'));
+    }
+    
     void test_method_(concat_vector) {
       assert::are_equal(L"1234", strings::concat(std::vector {L"1", L"2", L"3", L"4"}));
     }
@@ -69,6 +116,22 @@ namespace unit_tests {
       assert::is_false(strings::contains("abcd", "ad"));
     }
     
+    void test_method_(contains_string_view) {
+      assert::is_true(strings::contains(u"abcd"sv, u"bc"sv));
+    }
+    
+    void test_method_(contains_searcher) {
+      strings::searcher<char> error {"error", string_comparison::ordinal_ignore_case};
+      assert::is_true(strings::contains("2021-01-01 ERROR: disk full"s, error));
+      assert::is_false(strings::contains("2021-01-01 INFO: started", error));
+    }
+    
+    void test_method_(contains_any_pattern_set) {
+      strings::pattern_set<char> levels {{"error", "fatal"}, true};
+      assert::is_true(strings::contains_any("2021-01-01 FATAL: disk full"s, levels));
+      assert::is_false(strings::contains_any("2021-01-01 INFO: started", levels));
+    }
+    
     void test_method_(ends_with_char) {
       assert::is_true(strings::ends_with("abcd", 'd'));
       assert::is_false(strings::ends_with("abcd", 'D'));
@@ -92,6 +155,32 @@ namespace unit_tests {
       assert::is_false(strings::ends_with("abcd", "AB", true));
     }
 
+    void test_method_(ends_with_any) {
+      assert::is_true(strings::ends_with_any("main.cpp"s, {".h"s, ".cpp"s}));
+      assert::is_false(strings::ends_with_any("main.CPP", {".h"s, ".cpp"s}));
+      assert::is_true(strings::ends_with_any("main.CPP", {".h"s, ".cpp"s}, true));
+      assert::is_true(strings::ends_with_any("main.CPP", suffix_trie<char>({".h", ".cpp"}, true)));
+    }
+    
+    void test_method_(equals) {
+      assert::is_true(strings::equals("abc"s, "abc"s));
+      assert::is_false(strings::equals("abc"s, "ABC"s));
+      assert::is_false(strings::equals("abc", "abcd"));
+    }
+    
+    void test_method_(equals_ignore_case) {
+      assert::is_true(strings::equals("abc"s, "ABC"s, true));
+      assert::is_true(strings::equals(L"Abc", L"aBC", xtd::string_comparison::ordinal_ignore_case));
+      assert::is_false(strings::equals("abc"s, "abd"s, true));
+      assert::is_false(strings::equals("@", "`", true));
+    }
+    
+    void test_method_(equals_ignore_case_long_strings) {
+      assert::is_true(strings::equals("0123456789 The Quick Brown Fox Jumps Over The Lazy Dog"s, "0123456789 the quick brown fox jumps over the lazy dog"s, true));
+      assert::is_false(strings::equals("0123456789 The Quick Brown Fox Jumps Over The Lazy Dog"s, "0123456789 the quick brown fox jumps over the lazy dot"s, true));
+      assert::is_false(strings::equals(std::string(40, '['), std::string(40, '{'), true));
+    }
+    
     void test_method_(string_format_with_automatic_arguments) {
       assert::are_equal("42 str 24", strings::format("{} {} {}", 42, "str", 24));
     }
@@ -139,6 +228,17 @@ namespace unit_tests {
       assert::are_not_equal(strings::get_hash_code("01235"), strings::get_hash_code("01234"));
     }
     
+    void test_method_(get_hash_code_ignore_case) {
+      assert::are_equal(strings::get_hash_code("Content-Length", string_comparison::ordinal_ignore_case), strings::get_hash_code("content-LENGTH"s, string_comparison::ordinal_ignore_case));
+      assert::are_equal(strings::get_hash_code("abc"), strings::get_hash_code("abc", string_comparison::ordinal));
+      assert::are_not_equal(strings::get_hash_code("abc", string_comparison::ordinal_ignore_case), strings::get_hash_code("abd", string_comparison::ordinal_ignore_case));
+      assert::are_equal(strings::get_hash_code(L"\u0100bc", string_comparison::ordinal_ignore_case), strings::get_hash_code(L"\u0101BC", string_comparison::ordinal_ignore_case));
+    }
+    
+    void test_method_(get_hash_code_string_view) {
+      assert::are_equal(strings::get_hash_code("01234"s), strings::get_hash_code("x01234x"sv.substr(1, 5)));
+    }
+    
     void test_method_(index_of_char) {
       assert::are_equal(3, strings::index_of("01234", '3'));
       assert::are_equal(3, strings::index_of("0123434", '3'));
@@ -149,6 +249,11 @@ namespace unit_tests {
       assert::are_equal(2, strings::index_of("0123423", "23"));
     }
     
+    void test_method_(index_of_string_view) {
+      assert::are_equal(2, strings::index_of("0123423"sv, "23"sv));
+      assert::are_equal(5, strings::last_index_of("0123423"sv, "23"sv));
+    }
+    
     void test_method_(index_of_char_start_index) {
       assert::are_equal(5, strings::index_of("0123434", '3', 4));
     }
@@ -178,6 +283,27 @@ namespace unit_tests {
       assert::are_equal(std::string::npos, strings::index_of_any("01234", {'5', '3'}, 0, 2));
     }
     
+    void test_method_(index_of_any_char_set) {
+      char_set<char> values {'5', '3', '2'};
+      assert::are_equal(2U, strings::index_of_any("01234"s, values));
+      assert::are_equal(3U, strings::index_of_any("01234", values, 3));
+      assert::are_equal(std::string::npos, strings::index_of_any("01234", values, 5));
+    }
+    
+    void test_method_(index_of_any_pattern_set) {
+      strings::pattern_set<char> values {{"34", "12"}};
+      assert::are_equal(1U, strings::index_of_any("01234"s, values));
+      assert::are_equal(3U, strings::index_of_any("01234", values, 2));
+      assert::are_equal(std::string::npos, strings::index_of_any("01234", values, 4));
+    }
+    
+    void test_method_(index_of_searcher) {
+      strings::searcher<char> value {"23"};
+      assert::are_equal(2U, strings::index_of("0123423"s, value));
+      assert::are_equal(5U, strings::index_of("0123423", value, 3));
+      assert::are_equal(std::string::npos, strings::index_of("0123423", value, 3, 1));
+    }
+    
     void test_method_(insert) {
       assert::are_equal("012345", strings::insert("345", 0, "012"));
     }
@@ -186,6 +312,10 @@ namespace unit_tests {
       assert::are_equal("One, Two, Three", strings::join(", ", {"One", "Two", "Three"}));
     }
 
+    void test_method_(join_double_vector) {
+      assert::are_equal("1.5; 2; -0.25", strings::join("; ", vector<double> {1.5, 2, -0.25}));
+    }
+    
     void test_method_(join_int_array) {
       assert::are_equal("1, 2, 3", strings::join(", ", {1, 2, 3}));
     }
@@ -237,6 +367,20 @@ namespace unit_tests {
       assert::are_equal(std::string::npos, strings::last_index_of_any("01234", {'5', '3'}, 0, 2));
     }
 
+    void test_method_(last_index_of_any_char_set) {
+      char_set<wchar_t> values {L'5', L'3', L'2'};
+      assert::are_equal(3U, strings::last_index_of_any(L"01234"s, values));
+      assert::are_equal(2U, strings::last_index_of_any(L"01234", values, 2, 0));
+      assert::are_equal(std::wstring::npos, strings::last_index_of_any(L"01234", values, 4));
+    }
+    
+    void test_method_(last_index_of_searcher) {
+      strings::searcher<char> value {"23"};
+      assert::are_equal(5U, strings::last_index_of("0123423"s, value));
+      assert::are_equal(2U, strings::last_index_of("0123423", value, 0, 5));
+      assert::are_equal(std::string::npos, strings::last_index_of("0123423", value, 3, 3));
+    }
+    
     void test_method_(pad_left) {
       assert::are_equal("       str", strings::pad_left("str", 10));
     }
@@ -277,6 +421,32 @@ namespace unit_tests {
       assert::are_equal("hola world and hola me", strings::replace("hello world and hello me", "hello", "hola"));
     }
     
+    void test_method_(replace_string_empty_old_string) {
+      assert::are_equal("abc", strings::replace("abc", "", ""));
+      assert::are_equal("-a-b-", strings::replace("ab", "", "-"));
+    }
+    
+    void test_method_(replace_string_growing) {
+      assert::are_equal("aaaaaa", strings::replace("aaa"s, "a"s, "aa"s));
+      assert::are_equal("b-b", strings::replace("aa-aa", "aa", "b"));
+      assert::are_equal("abc", strings::replace("abc", "x", "y"));
+    }
+    
+    void test_method_(replace_pairs) {
+      assert::are_equal("&lt;a href=&quot;x&quot;&gt;&amp;&lt;/a&gt;", strings::replace("<a href=\"x\">&</a>"s, {{"&", "&amp;"}, {"<", "&lt;"}, {">", "&gt;"}, {"\"", "&quot;"}}));
+      assert::are_equal("ab", strings::replace("ba", {{"a", "b"}, {"b", "a"}}));
+      assert::are_equal("[name]!", strings::replace("{{name}}!", {{"{{", "["}, {"{{name}}", "[name]"}, {"}}", "]"}}));
+      assert::are_equal("abc", strings::replace("abc", {{"x", "y"}, {"", "z"}}));
+      assert::are_equal(L"xé", strings::replace(L"aé", {{L"a", L"x"}}));
+    }
+    
+    void test_method_(replace_searcher) {
+      strings::searcher<char> value {"ab", string_comparison::ordinal_ignore_case};
+      assert::are_equal("x-x-c-x", strings::replace("ab-AB-c-aB"s, value, "x"s));
+      assert::are_equal("c", strings::replace("c", value, "x"));
+      assert::are_equal("", strings::replace("ABab"s, value, ""s));
+    }
+    
     void test_method_(split) {
       collection_assert::are_equal({"One", "Two", "Three", "Four", "Five", "Six", "Seven"}, strings::split("One Two\vThree\fFour\rFive\nSix\nSeven"));
     }
@@ -305,6 +475,23 @@ namespace unit_tests {
       collection_assert::are_equal({"One", "Two", "Three,:Four......Five/Six,,,,,,,Seven"}, strings::split("One      Two::Three,:Four......Five/Six,,,,,,,Seven", {' ', ',', ':', '.', '/'}, 3, string_split_options::remove_empty_entries));
     }
     
+    void test_method_(split_char_set) {
+      char_set<char> separators {' ', ',', ':', '.', '/'};
+      collection_assert::are_equal({"One", "Two", "", "Three", "", "Four", "Five", "Six", "Seven"}, strings::split("One Two::Three,:Four.Five/Six,Seven", separators));
+      collection_assert::are_equal({"One", "Two", "Three,:Four......Five/Six,,,,,,,Seven"}, strings::split("One      Two::Three,:Four......Five/Six,,,,,,,Seven"s, separators, 3, string_split_options::remove_empty_entries));
+    }
+    
+    void test_method_(split_wstring) {
+      collection_assert::are_equal({L"One", L"Two", L"Three"}, strings::split(L"One,Two;Three", {L',', L';'}));
+    }
+    
+    void test_method_(split_searcher) {
+      strings::searcher<char> separator {", "};
+      collection_assert::are_equal({"One", "Two", "", "Three"}, strings::split("One, Two, , Three"s, separator));
+      collection_assert::are_equal({"One", "Two", "Three"}, strings::split("One, Two, , Three", separator, string_split_options::remove_empty_entries));
+      collection_assert::are_equal({"One", "Two, , Three"}, strings::split("One, Two, , Three", separator, 2, string_split_options::none));
+    }
+    
     void test_method_(start_with_char) {
       assert::is_true(strings::starts_with("Hello, World!", 'H'));
       assert::is_false(strings::starts_with("Hello, World!", 'h'));
@@ -335,6 +522,144 @@ namespace unit_tests {
       assert::is_true(strings::starts_with("Hello, World!", "hello", true));
     }
     
+    void test_method_(start_with_and_ends_with_string_view) {
+      assert::is_true(strings::starts_with(U"abcd"sv, U"AB"sv, true));
+      assert::is_true(strings::ends_with(U"abcd"sv, U"cd"sv));
+      assert::is_false(strings::ends_with(U"d"sv, U"cd"sv));
+    }
+    
+    void test_method_(split_into) {
+      vector<string> fields {"a long field that does not fit in a small string buffer", "b", "c", "d"};
+      const char* capacity = fields[0].data();
+      assert::are_equal(2U, strings::split_into("x;y"s, ';', fields));
+      collection_assert::are_equal({"x", "y"}, fields);
+      assert::are_equal(capacity, fields[0].data());
+      assert::are_equal(5U, strings::split_into(" p  q r ", fields));
+      collection_assert::are_equal({"", "p", "", "q", "r"}, fields);
+    }
+    
+    void test_method_(split_into_options_and_count) {
+      vector<string> fields;
+      strings::split_into("a,,b,c", ',', string_split_options::remove_empty_entries, fields);
+      collection_assert::are_equal({"a", "b", "c"}, fields);
+      strings::split_into("a,,b;c", vector<char> {',', ';'}, 3, string_split_options::none, fields);
+      collection_assert::are_equal({"a", "", "b;c"}, fields);
+      strings::split_into("a and b", strings::searcher<char> {" and "}, fields);
+      collection_assert::are_equal({"a", "b"}, fields);
+    }
+    
+    void test_method_(split_into_views) {
+      string record = "id=42&name=xtd";
+      vector<string_view> fields;
+      assert::are_equal(2U, strings::split_into(record, '&', fields));
+      assert::are_equal(record.data() + 6, fields[1].data());
+      assert::are_equal("name=xtd", string(fields[1]));
+    }
+    
+    void test_method_(split_into_pmr) {
+      char buffer[4096];
+      pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), pmr::null_memory_resource());
+      pmr::vector<pmr::string> fields(&arena);
+      strings::split_into("alpha beta gamma delta epsilon zeta eta theta iota kappa lambda", ' ', fields);
+      assert::are_equal(11U, fields.size());
+      assert::are_equal("lambda", string(fields.back()));
+      assert::is_true(fields.back().get_allocator().resource() == &arena);
+    }
+    
+    void test_method_(split_pmr) {
+      pmr::monotonic_buffer_resource arena;
+      auto fields = strings::split(pmr::string("alpha beta gamma delta epsilon zeta eta theta iota kappa lambda", &arena));
+      assert::are_equal(11U, fields.size());
+      assert::are_equal("lambda", string(fields.back()));
+      assert::is_true(fields.get_allocator().resource() == &arena);
+      assert::is_true(fields.back().get_allocator().resource() == &arena);
+    }
+    
+    void test_method_(join_pmr) {
+      pmr::monotonic_buffer_resource arena;
+      pmr::string result = strings::join(pmr::string(", ", &arena), vector<string> {"red", "green", "blue"});
+      assert::are_equal("red, green, blue", string(result));
+      assert::is_true(result.get_allocator().resource() == &arena);
+    }
+    
+    void test_method_(format_pmr) {
+      pmr::monotonic_buffer_resource arena;
+      pmr::string result = strings::format(pmr::string("{0}={1,4}", &arena), "key", 42);
+      assert::are_equal("key=  42", string(result));
+      assert::is_true(result.get_allocator().resource() == &arena);
+      result = strings::format(allocator_arg, pmr::polymorphic_allocator<char>(&arena), "{0}/{1}", "a", "b");
+      assert::are_equal("a/b", string(result));
+      assert::is_true(result.get_allocator().resource() == &arena);
+    }
+    
+    void test_method_(concat_pmr) {
+      pmr::monotonic_buffer_resource arena;
+      auto result = strings::concat(allocator_arg, pmr::polymorphic_allocator<char>(&arena), "user:", 42, ':', "name"s);
+      assert::are_equal("user:42:name", string(result));
+      assert::is_true(result.get_allocator().resource() == &arena);
+    }
+    
+    void test_method_(transform_pmr) {
+      pmr::monotonic_buffer_resource arena;
+      pmr::string str("  Hello, World!  ", &arena);
+      assert::is_true(strings::to_lower(str).get_allocator().resource() == &arena);
+      assert::is_true(strings::to_upper(pmr::string(str, &arena)).get_allocator().resource() == &arena);
+      assert::are_equal("Hello, World!", string(strings::trim(str)));
+      assert::is_true(strings::trim(str).get_allocator().resource() == &arena);
+      assert::is_true(strings::trim_start(str, ' ').get_allocator().resource() == &arena);
+      assert::is_true(strings::pad_left(str, 20, '*').get_allocator().resource() == &arena);
+      assert::is_true(strings::pad_right(str, 4).get_allocator().resource() == &arena);
+      assert::are_equal("  Hello, xtd!  ", string(strings::replace(str, "World", "xtd")));
+      assert::is_true(strings::replace(str, "World", "xtd").get_allocator().resource() == &arena);
+      assert::is_true(strings::replace(str, 'o', '0').get_allocator().resource() == &arena);
+    }
+    
+    void test_method_(replace_pmr) {
+      pmr::monotonic_buffer_resource arena;
+      pmr::string str("one two one", &arena);
+      pmr::string result = strings::replace(str, pmr::string("one", &arena), pmr::string("1", &arena));
+      assert::are_equal("1 two 1", string(result));
+      assert::is_true(result.get_allocator().resource() == &arena);
+      assert::are_equal("one 2 one", string(strings::replace(str, "two", pmr::string("2", &arena))));
+      assert::are_equal("one 2 one", string(strings::replace(str, pmr::string("two", &arena), "2")));
+      assert::are_equal("1 two 1", strings::replace("one two one", pmr::string("one", &arena), pmr::string("1", &arena)));
+      assert::are_equal("1 two 1", string(strings::replace(str, strings::searcher<char> {"ONE", string_comparison::ordinal_ignore_case}, pmr::string("1", &arena))));
+    }
+    
+    void test_method_(split_view) {
+      string line = "  GET /index.html  HTTP/1.1 ";
+      vector<string_view> fields(strings::split_view(line).begin(), strings::split_view(line).end());
+      collection_assert::are_equal({"", "", "GET", "/index.html", "", "HTTP/1.1"}, fields);
+      vector<string> tokens;
+      for (auto token : strings::split_view(line, ' ', string_split_options::remove_empty_entries))
+        tokens.emplace_back(token);
+      collection_assert::are_equal({"GET", "/index.html", "HTTP/1.1"}, tokens);
+      tokens.clear();
+      for (auto token : strings::split_view("k1=v1; k2=v2; k3=v3", "; ", 2))
+        tokens.emplace_back(token);
+      collection_assert::are_equal({"k1=v1", "k2=v2; k3=v3"}, tokens);
+    }
+    
+    void test_method_(split_view_wstring) {
+      wstring line = L"a,b;c";
+      char_set<wchar_t> separators {L',', L';'};
+      vector<wstring> tokens;
+      for (auto token : strings::split_view(line, separators))
+        tokens.emplace_back(token);
+      collection_assert::are_equal({L"a", L"b", L"c"}, tokens);
+      tokens.clear();
+      for (auto token : strings::split_view(line, L','))
+        tokens.emplace_back(token);
+      collection_assert::are_equal({L"a", L"b;c"}, tokens);
+    }
+    
+    void test_method_(starts_with_any) {
+      assert::is_true(strings::starts_with_any("/api/users"s, {"/static/"s, "/api/"s}));
+      assert::is_false(strings::starts_with_any(L"/API/users", {L"/static/"s, L"/api/"s}));
+      assert::is_true(strings::starts_with_any(L"/API/users", {L"/static/"s, L"/api/"s}, true));
+      assert::is_true(strings::starts_with_any("/api/users"sv, prefix_trie<char>({"/static/", "/api/"})));
+    }
+    
     void test_method_(substring) {
       assert::are_equal("23456", strings::substring("0123456", 2));
     }
@@ -375,10 +700,80 @@ namespace unit_tests {
       assert::are_equal("abcdef", strings::to_lower("ABCDEF"));
     }
     
+    void test_method_(to_lower_long_string) {
+      assert::are_equal("the quick brown fox @[`{ jumps over the lazy dog 0123456789 \xC9t\xE9", strings::to_lower("The Quick Brown FOX @[`{ Jumps Over The Lazy DOG 0123456789 \xC9t\xE9"));
+    }
+    
+    void test_method_(to_lower_wstring) {
+      assert::are_equal(L"abc\u0101\u0142z \u03C3\u03C6\u03B1\u03BB\u03BC\u03B1 \u043E\u0448\u0438\u0431\u043A\u0430", strings::to_lower(std::wstring(L"ABC\u0100\u0141Z \u03A3\u03A6\u0391\u039B\u039C\u0391 \u041E\u0428\u0418\u0411\u041A\u0410")));
+    }
+    
+    void test_method_(to_lower_u16string_surrogate_pairs) {
+      assert::is_true(u"\U00010428\U00010429 \u03C3 \U0001E922" == strings::to_lower(u16string(u"\U00010400\U00010401 \u03A3 \U0001E900")));
+      assert::is_true(u"\xD801" == strings::to_lower(u16string(u"\xD801")));
+    }
+    
+    void test_method_(to_lower_rvalue) {
+      string str = "ABCDEFGHIJKLMNOPQRSTUVWXYZ ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+      const char* data = str.data();
+      string result = strings::to_lower(std::move(str));
+      assert::are_equal("abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz", result);
+      assert::is_true(result.data() == data);
+    }
+    
+    void test_method_(to_lower_locale) {
+      assert::are_equal(L"abc\u00C9", strings::to_lower(L"ABC\u00C9", std::locale::classic()));
+    }
+    
     void test_method_(to_upper) {
       assert::are_equal("ABCDEF", strings::to_upper("abcdef"));
     }
     
+    void test_method_(to_upper_long_string) {
+      assert::are_equal("THE QUICK BROWN FOX @[`{ JUMPS OVER THE LAZY DOG 0123456789 \xC9T\xE9", strings::to_upper("The Quick Brown fox @[`{ Jumps Over The Lazy dog 0123456789 \xC9t\xE9"));
+    }
+    
+    void test_method_(to_upper_u32string) {
+      assert::is_true(U"ABC\u0100\U0001F600Z\U00010400" == strings::to_upper(std::u32string(U"abc\u0101\U0001F600z\U00010428")));
+    }
+    
+    void test_method_(to_upper_rvalue) {
+      string str = "abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz";
+      const char* data = str.data();
+      string result = strings::to_upper(std::move(str));
+      assert::are_equal("ABCDEFGHIJKLMNOPQRSTUVWXYZ ABCDEFGHIJKLMNOPQRSTUVWXYZ", result);
+      assert::is_true(result.data() == data);
+    }
+    
+    void test_method_(to_upper_locale) {
+      assert::are_equal("ABC", strings::to_upper(string("abc"), std::locale::classic()));
+    }
+    
+    void test_method_(trim_view) {
+      string str = "  \tabc \n";
+      string_view result = strings::trim_view(str);
+      assert::are_equal("abc", string(result));
+      assert::are_equal(str.data() + 3, result.data());
+      assert::are_equal("abc", string(strings::trim_view("**abc*", '*')));
+      assert::are_equal(0U, strings::trim_view("  ").size());
+      assert::are_equal(0U, strings::trim_view("").size());
+    }
+    
+    void test_method_(trim_start_view_and_trim_end_view) {
+      char_set<char> zeros {'0'};
+      assert::are_equal("120", string(strings::trim_start_view("00120", zeros)));
+      assert::are_equal("0012", string(strings::trim_end_view("00120", zeros)));
+      assert::are_equal("", string(strings::trim_end_view("", '0')));
+      assert::are_equal(L"x", wstring(strings::trim_start_view(L"  x")));
+    }
+    
+    void test_method_(trim_char_set) {
+      char_set<char> trim_chars {'*', ' ', '+'};
+      assert::are_equal("abcdef", strings::trim("+* abcdef****   +++"s, trim_chars));
+      assert::are_equal("", strings::trim("+* ****   +++", trim_chars));
+      assert::are_equal("", strings::trim(""s));
+    }
+    
     void test_method_(trim_end) {
       assert::are_equal("abcdef", strings::trim_end("abcdef   "));
     }
@@ -391,6 +786,11 @@ namespace unit_tests {
       assert::are_equal("abcdef", strings::trim_end("abcdef****   +++", {'*', ' ', '+'}));
     }
     
+    void test_method_(trim_end_white_spaces_only) {
+      assert::are_equal("", strings::trim_end(" \t\n"));
+      assert::are_equal("", strings::trim_end(""s));
+    }
+    
     void test_method_(trim_start) {
       assert::are_equal("abcdef", strings::trim_start("   abcdef"));
     }
@@ -403,6 +803,11 @@ namespace unit_tests {
       assert::are_equal("abcdef", strings::trim_start("****   +++abcdef", {'*', ' ', '+'}));
     }
     
+    void test_method_(trim_start_white_spaces_only) {
+      assert::are_equal("", strings::trim_start(" \t\n"));
+      assert::are_equal(L"abc ", strings::trim_start(L" \tabc "s));
+    }
+    
     void test_method_(trim) {
       assert::are_equal("abcdef", strings::trim("   abcdef     "));
     }